@@ -258,6 +258,16 @@ if(IME_FOUND)
   set(ADIOS2_HAVE_IME TRUE)
 endif()
 
+# io_uring
+if(ADIOS2_USE_IOUring STREQUAL AUTO)
+  find_package(LibURing)
+elseif(ADIOS2_USE_IOUring)
+  find_package(LibURing REQUIRED)
+endif()
+if(LibURing_FOUND)
+  set(ADIOS2_HAVE_IOUring TRUE)
+endif()
+
 
 # Python
 
@@ -337,6 +347,17 @@ if(ADIOS2_USE_SST AND NOT WIN32)
       set(ADIOS2_SST_HAVE_CRAY_DRC TRUE)
     endif()
   endif()
+  include(CheckSymbolExists)
+  check_symbol_exists(shm_open "sys/mman.h" ADIOS2_SST_HAVE_POSIX_SHM)
+  if(NOT ADIOS2_SST_HAVE_POSIX_SHM)
+    set(CMAKE_REQUIRED_LIBRARIES rt)
+    check_symbol_exists(shm_open "sys/mman.h" ADIOS2_SST_HAVE_POSIX_SHM_RT)
+    unset(CMAKE_REQUIRED_LIBRARIES)
+    if(ADIOS2_SST_HAVE_POSIX_SHM_RT)
+      set(ADIOS2_SST_HAVE_POSIX_SHM TRUE)
+      set(ADIOS2_SST_POSIX_SHM_LIBRARIES rt)
+    endif()
+  endif()
 endif()
 
 # DAOS
@@ -354,6 +375,8 @@ endif()
 if(UNIX)
   include(CheckSymbolExists)
   CHECK_SYMBOL_EXISTS(shmget "sys/ipc.h;sys/shm.h" HAVE_shmget)
+  # Positioned vectored writes for the POSIX file transport
+  CHECK_SYMBOL_EXISTS(pwritev "sys/uio.h" HAVE_pwritev)
   if(HAVE_shmget)
     set(ADIOS2_HAVE_SysVShMem ON)
   else()
@@ -0,0 +1,60 @@
+#------------------------------------------------------------------------------#
+# Distributed under the OSI-approved Apache License, Version 2.0.  See
+# accompanying file Copyright.txt for details.
+#------------------------------------------------------------------------------#
+#
+# FindLibURing
+# -----------
+#
+# Try to find the liburing library
+#
+# This module defines the following variables:
+#
+#   LibURing_FOUND        - System has liburing
+#   LibURing_INCLUDE_DIRS - The liburing include directory
+#   LibURing_LIBRARIES    - Link these to use liburing
+#
+# and the following imported targets:
+#   LibURing::LibURing - The liburing library target
+#
+# You can also set the following variable to help guide the search:
+#   LibURing_ROOT - The install prefix for liburing containing the
+#                   include and lib folders
+#                   Note: this can be set as a CMake variable or an
+#                         environment variable.  If specified as a CMake
+#                         variable, it will override any setting specified
+#                         as an environment variable.
+
+if(NOT LibURing_FOUND)
+  if((NOT LibURing_ROOT) AND (NOT (ENV{LibURing_ROOT} STREQUAL "")))
+    set(LibURing_ROOT "$ENV{LibURing_ROOT}")
+  endif()
+  if(LibURing_ROOT)
+    set(LibURing_INCLUDE_OPTS HINTS ${LibURing_ROOT}/include NO_DEFAULT_PATHS)
+    set(LibURing_LIBRARY_OPTS
+      HINTS ${LibURing_ROOT}/lib ${LibURing_ROOT}/lib64
+      NO_DEFAULT_PATHS
+    )
+  endif()
+
+  find_path(LibURing_INCLUDE_DIR liburing.h ${LibURing_INCLUDE_OPTS})
+  find_library(LibURing_LIBRARY NAMES uring ${LibURing_LIBRARY_OPTS})
+
+  include(FindPackageHandleStandardArgs)
+  find_package_handle_standard_args(LibURing
+    FOUND_VAR LibURing_FOUND
+    REQUIRED_VARS LibURing_LIBRARY LibURing_INCLUDE_DIR
+  )
+  if(LibURing_FOUND)
+    set(LibURing_INCLUDE_DIRS ${LibURing_INCLUDE_DIR})
+    set(LibURing_LIBRARIES ${LibURing_LIBRARY})
+    if(LibURing_FOUND AND NOT TARGET LibURing::LibURing)
+      add_library(LibURing::LibURing UNKNOWN IMPORTED)
+      set_target_properties(LibURing::LibURing PROPERTIES
+        IMPORTED_LOCATION             "${LibURing_LIBRARY}"
+        INTERFACE_LINK_LIBRARIES      "${LibURing_LIBRARIES}"
+        INTERFACE_INCLUDE_DIRECTORIES "${LibURing_INCLUDE_DIR}"
+      )
+    endif()
+  endif()
+endif()
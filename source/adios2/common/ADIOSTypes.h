@@ -213,6 +213,18 @@ using Steps = size_t;
 template <class T>
 using Box = std::pair<T, T>;
 
+namespace core
+{
+/** memory region for gathered (vectored) writes, mirrors POSIX iovec */
+struct iovec
+{
+    // Base address of a memory region for input or output.
+    const void *iov_base;
+    // The size of the memory pointed to by iov_base.
+    size_t iov_len;
+};
+} // end namespace core
+
 /**
  * TypeInfo
  * used to map from primitive types to stdint-based types
@@ -11,6 +11,7 @@
 #include "ADIOS.h"
 
 #include <algorithm> // std::transform
+#include <cstdlib>   // std::getenv
 #include <fstream>
 #include <ios> //std::ios_base::failure
 #include <mutex>
@@ -341,6 +342,28 @@ bool ADIOS::RemoveIO(const std::string name)
 
 void ADIOS::RemoveAllIOs() noexcept { m_IOs.clear(); }
 
+helper::ThreadPool &ADIOS::GetThreadPool()
+{
+    std::lock_guard<std::mutex> lock(m_ThreadPoolMutex);
+    if (!m_ThreadPool)
+    {
+        size_t maxWorkers = 0;
+        bool pin = false;
+        if (const char *size = std::getenv("ADIOS2_THREAD_POOL_SIZE"))
+        {
+            maxWorkers =
+                helper::StringToSizeT(size, " in ADIOS2_THREAD_POOL_SIZE");
+        }
+        if (const char *pinValue = std::getenv("ADIOS2_THREAD_POOL_PIN"))
+        {
+            pin = helper::StringTo<bool>(pinValue,
+                                         " in ADIOS2_THREAD_POOL_PIN");
+        }
+        m_ThreadPool.reset(new helper::ThreadPool(maxWorkers, pin));
+    }
+    return *m_ThreadPool;
+}
+
 // PRIVATE FUNCTIONS
 void ADIOS::CheckOperator(const std::string name) const
 {
@@ -14,6 +14,7 @@
 #include <functional> //std::function
 #include <map>
 #include <memory> //std::shared_ptr
+#include <mutex>
 #include <string>
 #include <vector>
 /// \endcond
@@ -22,6 +23,7 @@
 #include "adios2/common/ADIOSTypes.h"
 #include "adios2/core/Operator.h"
 #include "adios2/helper/adiosComm.h"
+#include "adios2/helper/adiosThreadPool.h"
 
 namespace adios2
 {
@@ -165,6 +167,14 @@ public:
      */
     void RemoveAllIOs() noexcept;
 
+    /**
+     * Worker threads shared by the engines of this ADIOS object, created on
+     * first use. Environment variables ADIOS2_THREAD_POOL_SIZE sets the
+     * maximum number of workers (default: hardware threads - 1) and
+     * ADIOS2_THREAD_POOL_PIN=ON binds them to processors.
+     */
+    helper::ThreadPool &GetThreadPool();
+
 private:
     /** Communicator given to parallel constructor. */
     helper::Comm m_Comm;
@@ -172,6 +182,10 @@ private:
     /** XML File to be read containing configuration information */
     const std::string m_ConfigFile;
 
+    /** declared before m_IOs, engines may use it until they are closed */
+    std::unique_ptr<helper::ThreadPool> m_ThreadPool;
+    std::mutex m_ThreadPoolMutex;
+
     /**
      * @brief List of IO class objects defined from either ADIOS
      * configuration file (XML) or the DeclareIO function explicitly.
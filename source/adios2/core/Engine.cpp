@@ -79,6 +79,8 @@ void Engine::Flush(const int /*transportIndex*/) { ThrowUp("Flush"); }
 
 size_t Engine::Steps() const { return DoSteps(); }
 
+void Engine::LoadVariableStatistics(const VariableBase & /*variable*/) {}
+
 void Engine::LockWriterDefinitions() noexcept
 {
     m_WriterDefinitionsLocked = true;
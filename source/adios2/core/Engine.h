@@ -430,6 +430,13 @@ public:
 
     size_t Steps() const;
 
+    /**
+     * Completes the statistics (m_Min, m_Max) of a read variable when the
+     * engine parses them on demand, default: nothing to complete
+     * @param variable input variable defined by this engine
+     */
+    virtual void LoadVariableStatistics(const VariableBase &variable);
+
     /**
      * @brief Promise that no more definitions or changes to defined variables
      * will occur. Useful information if called before the first EndStep() of an
@@ -36,6 +36,9 @@ public:
     std::pair<size_t, size_t> m_MinMaxDataPositions;
     std::pair<size_t, size_t> m_MinMaxMetadataPositions;
     size_t m_PayloadPosition = 0;
+    /** buffer holding the payload, passed as bufferID to BufferData, for
+     * engines that buffer a step in several blocks */
+    size_t m_BufferIdx = 0;
     T m_Value = T{};
 
     Span(Engine &engine, const size_t size);
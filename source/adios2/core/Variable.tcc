@@ -159,6 +159,10 @@ std::pair<T, T> Variable<T>::DoMinMax(const size_t step) const
     }
     else
     {
+        if (m_Engine != nullptr)
+        {
+            m_Engine->LoadVariableStatistics(*this);
+        }
         minMax.first = m_Min;
         minMax.second = m_Max;
     }
@@ -218,7 +222,7 @@ size_t Span<T>::Size() const noexcept
 template <class T>
 T *Span<T>::Data() const noexcept
 {
-    return m_Engine.BufferData<T>(m_PayloadPosition);
+    return m_Engine.BufferData<T>(m_PayloadPosition, m_BufferIdx);
 }
 
 template <class T>
@@ -252,7 +256,8 @@ const T &Span<T>::At(const size_t position) const
 template <class T>
 T &Span<T>::operator[](const size_t position)
 {
-    T &data = *m_Engine.BufferData<T>(m_PayloadPosition + position * sizeof(T));
+    T &data = *m_Engine.BufferData<T>(m_PayloadPosition + position * sizeof(T),
+                                      m_BufferIdx);
     return data;
 }
 
@@ -260,7 +265,8 @@ template <class T>
 const T &Span<T>::operator[](const size_t position) const
 {
     const T &data =
-        *m_Engine.BufferData<T>(m_PayloadPosition + position * sizeof(T));
+        *m_Engine.BufferData<T>(m_PayloadPosition + position * sizeof(T),
+                                m_BufferIdx);
     return data;
 }
 
@@ -126,6 +126,7 @@ void BP3Reader::Init()
             " " + m_EndMessage);
     }
 
+    m_BP3Deserializer.m_ThreadPool = &m_IO.m_ADIOS.GetThreadPool();
     InitTransports();
     InitBuffer();
 }
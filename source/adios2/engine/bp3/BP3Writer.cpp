@@ -160,6 +160,7 @@ ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
 void BP3Writer::InitParameters()
 {
     m_BP3Serializer.Init(m_IO.m_Parameters, "in call to BP3::Open for writing");
+    m_BP3Serializer.m_ThreadPool = &m_IO.m_ADIOS.GetThreadPool();
 }
 
 void BP3Writer::InitTransports()
@@ -11,6 +11,7 @@
 #include "BP4Reader.h"
 #include "BP4Reader.tcc"
 
+#include "adios2/toolkit/transport/file/FileFStream.h"
 #include <adios2-perfstubs-interface.h>
 
 #include <chrono>
@@ -139,6 +140,27 @@ void BP4Reader::PerformGets()
     m_BP4Deserializer.m_DeferredVariables.clear();
 }
 
+void BP4Reader::LoadVariableStatistics(const VariableBase &variable)
+{
+    if (!m_BP4Deserializer.m_Parameters.LazyMetadata)
+    {
+        return;
+    }
+
+    const DataType type = variable.m_Type;
+    if (type == DataType::Compound)
+    {
+    }
+#define declare_type(T)                                                        \
+    else if (type == helper::GetDataType<T>())                                 \
+    {                                                                          \
+        m_BP4Deserializer.LoadVariableStatistics(                              \
+            FindVariable<T>(variable.m_Name, "in call to MinMax"));            \
+    }
+    ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
+#undef declare_type
+}
+
 // PRIVATE
 void BP4Reader::Init()
 {
@@ -150,6 +172,12 @@ void BP4Reader::Init()
     }
 
     m_BP4Deserializer.Init(m_IO.m_Parameters, "in call to BP4::Open to write");
+    m_BP4Deserializer.m_ThreadPool = &m_IO.m_ADIOS.GetThreadPool();
+    if (m_BP4Deserializer.m_Parameters.Trace)
+    {
+        profiling::Tracer::Enable();
+        m_TraceStart = profiling::Tracer::Now();
+    }
     InitTransports();
 
     /* Do a collective wait for the file(s) to appear within timeout.
@@ -413,6 +441,8 @@ void BP4Reader::InitBuffer(const TimePoint &timeoutInstant,
     // Put all metadata in buffer
     if (m_BP4Deserializer.m_RankMPI == 0)
     {
+        profiling::ScopedTrace trace(
+            profiling::TraceEvent::BP4ReaderReadMetadata, m_CurrentStep);
         /* Read metadata index table into memory */
         const size_t metadataIndexFileSize =
             m_MDIndexFileManager.GetFileSize(0);
@@ -480,6 +510,9 @@ void BP4Reader::InitBuffer(const TimePoint &timeoutInstant,
         // broadcast metadata index buffer to all ranks from zero
         m_Comm.BroadcastVector(m_BP4Deserializer.m_MetadataIndex.m_Buffer);
 
+        profiling::ScopedTrace trace(
+            profiling::TraceEvent::BP4ReaderInstallMetadata, m_CurrentStep);
+
         /* Parse metadata index table */
         m_BP4Deserializer.ParseMetadataIndex(m_BP4Deserializer.m_MetadataIndex,
                                              0, true, false);
@@ -510,6 +543,8 @@ size_t BP4Reader::UpdateBuffer(const TimePoint &timeoutInstant,
     std::vector<size_t> sizes(3, 0);
     if (m_BP4Deserializer.m_RankMPI == 0)
     {
+        profiling::ScopedTrace trace(
+            profiling::TraceEvent::BP4ReaderReadMetadata, m_CurrentStep);
         const size_t idxFileSize = m_MDIndexFileManager.GetFileSize(0);
         if (idxFileSize > m_MDIndexFileAlreadyReadSize)
         {
@@ -611,6 +646,9 @@ size_t BP4Reader::UpdateBuffer(const TimePoint &timeoutInstant,
 }
 void BP4Reader::ProcessMetadataForNewSteps(const size_t newIdxSize)
 {
+    profiling::ScopedTrace trace(
+        profiling::TraceEvent::BP4ReaderInstallMetadata, m_CurrentStep);
+
     /* Remove all existing variables from previous steps
        It seems easier than trying to update them */
     m_IO.RemoveAllVariables();
@@ -762,6 +800,21 @@ void BP4Reader::DoClose(const int transportIndex)
     PerformGets();
     m_DataFileManager.CloseFiles();
     m_MDFileManager.CloseFiles();
+
+    if (m_BP4Deserializer.m_Parameters.Trace)
+    {
+        const std::vector<char> traceJSON(
+            profiling::Tracer::AggregateChromeTraceJSON(m_Comm, m_TraceStart));
+        if (m_BP4Deserializer.m_RankMPI == 0)
+        {
+            transport::FileFStream traceJSONStream(m_Comm);
+            traceJSONStream.Open(m_BP4Deserializer.GetBPBaseNames({m_Name})[0] +
+                                     "/reader_trace.json",
+                                 Mode::Write);
+            traceJSONStream.Write(traceJSON.data(), traceJSON.size());
+            traceJSONStream.Close();
+        }
+    }
 }
 
 #define declare_type(T)                                                        \
@@ -15,6 +15,7 @@
 #include "adios2/core/Engine.h"
 #include "adios2/helper/adiosComm.h"
 #include "adios2/toolkit/format/bp/bp4/BP4Deserializer.h"
+#include "adios2/toolkit/profiling/tracing/Tracer.h"
 #include "adios2/toolkit/transportman/TransportMan.h"
 
 #include <chrono>
@@ -51,6 +52,8 @@ public:
 
     void PerformGets() final;
 
+    void LoadVariableStatistics(const VariableBase &variable) final;
+
 private:
     typedef std::chrono::duration<double> Seconds;
     typedef std::chrono::time_point<
@@ -91,6 +94,9 @@ private:
     bool m_FirstStep = true;
     bool m_IdxHeaderParsed = false; // true after first index parsing
 
+    /** profiling::Tracer time at Open, events before it are not exported */
+    uint64_t m_TraceStart = 0;
+
     void Init();
     void InitTransports();
 
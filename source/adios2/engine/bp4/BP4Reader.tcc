@@ -63,6 +63,8 @@ void BP4Reader::GetDeferredCommon(Variable<T> &variable, T *data)
 template <class T>
 void BP4Reader::ReadVariableBlocks(Variable<T> &variable)
 {
+    profiling::ScopedTrace trace(profiling::TraceEvent::BP4ReaderReadData,
+                                 m_CurrentStep);
     const bool profile = m_BP4Deserializer.m_Profiler.m_IsActive;
 
     for (typename Variable<T>::BPInfo &blockInfo : variable.m_BlocksInfo)
@@ -90,7 +92,24 @@ void BP4Reader::ReadVariableBlocks(Variable<T> &variable)
 
                     m_DataFileManager.OpenFileID(
                         subFileName, subStreamBoxInfo.SubStreamID, Mode::Read,
-                        {{"transport", "File"}}, profile);
+                        m_IO.m_TransportsParameters[0], profile);
+                }
+
+                if (subStreamBoxInfo.OperationsInfo.empty())
+                {
+                    // clip straight out of the file if the transport maps it
+                    const size_t payloadStart = subStreamBoxInfo.Seeks.first;
+                    const char *payload = m_DataFileManager.MappedData(
+                        subStreamBoxInfo.Seeks.second - payloadStart,
+                        payloadStart, subStreamBoxInfo.SubStreamID);
+                    if (payload != nullptr)
+                    {
+                        m_BP4Deserializer.PostDataRead(
+                            variable, blockInfo, subStreamBoxInfo,
+                            helper::IsRowMajor(m_IO.m_HostLanguage), 0,
+                            payload);
+                        continue;
+                    }
                 }
 
                 char *buffer = nullptr;
@@ -90,13 +90,17 @@ void BP4Writer::PerformPuts()
 void BP4Writer::EndStep()
 {
     PERFSTUBS_SCOPED_TIMER("BP4Writer::EndStep");
-    if (m_BP4Serializer.m_DeferredVariables.size() > 0)
     {
-        PerformPuts();
-    }
+        profiling::ScopedTrace trace(profiling::TraceEvent::BP4WriterMarshal,
+                                     CurrentStep());
+        if (m_BP4Serializer.m_DeferredVariables.size() > 0)
+        {
+            PerformPuts();
+        }
 
-    // true: advances step
-    m_BP4Serializer.SerializeData(m_IO, true);
+        // true: advances step
+        m_BP4Serializer.SerializeData(m_IO, true);
+    }
 
     const size_t currentStep = CurrentStep();
     const size_t flushStepsCount = m_BP4Serializer.m_Parameters.FlushStepsCount;
@@ -162,6 +166,12 @@ ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
 void BP4Writer::InitParameters()
 {
     m_BP4Serializer.Init(m_IO.m_Parameters, "in call to BP4::Open to write");
+    m_BP4Serializer.m_ThreadPool = &m_IO.m_ADIOS.GetThreadPool();
+    if (m_BP4Serializer.m_Parameters.Trace)
+    {
+        profiling::Tracer::Enable();
+        m_TraceStart = profiling::Tracer::Now();
+    }
     m_WriteToBB = !(m_BP4Serializer.m_Parameters.BurstBufferPath.empty());
     m_DrainBB = m_WriteToBB && m_BP4Serializer.m_Parameters.BurstBufferDrain;
 }
@@ -428,6 +438,11 @@ void BP4Writer::DoClose(const int transportIndex)
         // std::cout << "write profiling file!" << std::endl;
         WriteProfilingJSONFile();
     }
+    if (m_BP4Serializer.m_Parameters.Trace &&
+        m_FileDataManager.AllTransportsClosed())
+    {
+        WriteTraceJSONFile();
+    }
     if (m_BP4Serializer.m_Aggregator.m_IsActive)
     {
         m_BP4Serializer.m_Aggregator.Close();
@@ -547,6 +562,33 @@ void BP4Writer::WriteProfilingJSONFile()
     }
 }
 
+void BP4Writer::WriteTraceJSONFile()
+{
+    PERFSTUBS_SCOPED_TIMER("BP4Writer::WriteTraceJSONFile");
+    const std::vector<char> traceJSON(
+        profiling::Tracer::AggregateChromeTraceJSON(m_Comm, m_TraceStart));
+
+    if (m_BP4Serializer.m_RankMPI == 0)
+    {
+        if (m_DrainBB)
+        {
+            const std::string traceFileName =
+                m_BP4Serializer.GetBPBaseNames({m_Name})[0] + "/trace.json";
+            m_FileDrainer.AddOperationWrite(traceFileName, traceJSON.size(),
+                                            traceJSON.data());
+        }
+        else
+        {
+            const std::string traceFileName =
+                m_BP4Serializer.GetBPBaseNames({m_BBName})[0] + "/trace.json";
+            transport::FileFStream traceJSONStream(m_Comm);
+            traceJSONStream.Open(traceFileName, Mode::Write);
+            traceJSONStream.Write(traceJSON.data(), traceJSON.size());
+            traceJSONStream.Close();
+        }
+    }
+}
+
 /*write the content of metadata index file*/
 void BP4Writer::PopulateMetadataIndexFileContent(
     format::BufferSTL &b, const uint64_t currentStep, const uint64_t mpirank,
@@ -590,6 +632,8 @@ void BP4Writer::WriteCollectiveMetadataFile(const bool isFinal)
 {
 
     PERFSTUBS_SCOPED_TIMER("BP4Writer::WriteCollectiveMetadataFile");
+    profiling::ScopedTrace trace(profiling::TraceEvent::BP4WriterWriteMetadata,
+                                 CurrentStep());
 
     if (isFinal && m_BP4Serializer.m_MetadataSet.DataPGCount == 0)
     {
@@ -696,6 +740,8 @@ void BP4Writer::WriteCollectiveMetadataFile(const bool isFinal)
 void BP4Writer::WriteData(const bool isFinal, const int transportIndex)
 {
     PERFSTUBS_SCOPED_TIMER("BP4Writer::WriteData");
+    profiling::ScopedTrace trace(profiling::TraceEvent::BP4WriterWriteData,
+                                 CurrentStep());
     size_t dataSize;
 
     // write data without footer
@@ -725,6 +771,8 @@ void BP4Writer::WriteData(const bool isFinal, const int transportIndex)
 void BP4Writer::AggregateWriteData(const bool isFinal, const int transportIndex)
 {
     PERFSTUBS_SCOPED_TIMER("BP4Writer::AggregateWriteData");
+    profiling::ScopedTrace trace(profiling::TraceEvent::BP4WriterAggregate,
+                                 CurrentStep());
     m_BP4Serializer.CloseStream(m_IO, false);
     size_t totalBytesWritten = 0;
     const size_t dataBufferSize = m_BP4Serializer.m_Data.m_Position;
@@ -747,6 +795,8 @@ void BP4Writer::AggregateWriteData(const bool isFinal, const int transportIndex)
                     m_BP4Serializer.m_Data);
             if (bufferSTL.m_Position > 0)
             {
+                profiling::ScopedTrace writeTrace(
+                    profiling::TraceEvent::BP4WriterWriteData, CurrentStep());
                 m_FileDataManager.WriteFiles(
                     bufferSTL.Data(), bufferSTL.m_Position, transportIndex);
 
@@ -16,6 +16,7 @@
 #include "adios2/helper/adiosComm.h"
 #include "adios2/toolkit/burstbuffer/FileDrainerSingleThread.h"
 #include "adios2/toolkit/format/bp/bp4/BP4Serializer.h"
+#include "adios2/toolkit/profiling/tracing/Tracer.h"
 #include "adios2/toolkit/transportman/TransportMan.h"
 
 namespace adios2
@@ -76,6 +77,9 @@ private:
      * m_Name is a constant of Engine and is the user provided target path
      */
     std::string m_BBName;
+
+    /** profiling::Tracer time at Open, events before it are not exported */
+    uint64_t m_TraceStart = 0;
     /* Name of subfiles to directly write to (for all transports)
      * This is either original target or burst buffer if used */
     std::vector<std::string> m_SubStreamNames;
@@ -131,6 +135,10 @@ private:
      * profilers*/
     void WriteProfilingJSONFile();
 
+    /** Write the Tracer events of all ranks as trace.json next to
+     * profiling.json */
+    void WriteTraceJSONFile();
+
     void PopulateMetadataIndexFileContent(
         format::BufferSTL &buffer, const uint64_t currentStep,
         const uint64_t mpirank, const uint64_t pgIndexStart,
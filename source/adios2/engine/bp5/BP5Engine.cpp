@@ -177,6 +177,19 @@ void BP5Engine::ParseParams(IO &io, struct BP5Params &Params)
         return false;
     };
 
+    auto lf_SetSizeBytesParameter = [&](const std::string key,
+                                        size_t &parameter, size_t def) {
+        auto itKey = io.m_Parameters.find(key);
+        parameter = def;
+        if (itKey != io.m_Parameters.end())
+        {
+            parameter = helper::StringToByteUnits(
+                itKey->second, "for Parameter key=" + key + " in call to Open");
+            return true;
+        }
+        return false;
+    };
+
     auto lf_SetStringParameter = [&](const std::string key,
                                      std::string &parameter, const char *def) {
         auto itKey = io.m_Parameters.find(key);
@@ -188,6 +201,63 @@ void BP5Engine::ParseParams(IO &io, struct BP5Params &Params)
         return false;
     };
 
+    auto lf_SetBufferVTypeParameter = [&](const std::string key,
+                                          int &parameter, int def) {
+        auto itKey = io.m_Parameters.find(key);
+        parameter = def;
+        if (itKey != io.m_Parameters.end())
+        {
+            std::string value = itKey->second;
+            std::transform(value.begin(), value.end(), value.begin(),
+                           ::tolower);
+            if (value == "malloc")
+            {
+                parameter = (int)BufferVType::MallocVType;
+            }
+            else if (value == "chunk")
+            {
+                parameter = (int)BufferVType::ChunkVType;
+            }
+            else
+            {
+                throw std::invalid_argument(
+                    "ERROR: Unknown BP5 BufferVType parameter \"" + value +
+                    "\" (must be \"malloc\" or \"chunk\")");
+            }
+            return true;
+        }
+        return false;
+    };
+
+    auto lf_SetAggregationTypeParameter = [&](const std::string key,
+                                              int &parameter, int def) {
+        auto itKey = io.m_Parameters.find(key);
+        parameter = def;
+        if (itKey != io.m_Parameters.end())
+        {
+            std::string value = itKey->second;
+            std::transform(value.begin(), value.end(), value.begin(),
+                           ::tolower);
+            if (value == "everyonewrites")
+            {
+                parameter = (int)AggregationType::EveryoneWrites;
+            }
+            else if (value == "twolevelshm")
+            {
+                parameter = (int)AggregationType::TwoLevelShm;
+            }
+            else
+            {
+                throw std::invalid_argument(
+                    "ERROR: Unknown BP5 AggregationType parameter \"" +
+                    value +
+                    "\" (must be \"EveryoneWrites\" or \"TwoLevelShm\")");
+            }
+            return true;
+        }
+        return false;
+    };
+
 #define get_params(Param, Type, Typedecl, Default)                             \
     lf_Set##Type##Parameter(#Param, Params.Param, Default);
     BP5_FOREACH_PARAMETER_TYPE_4ARGS(get_params);
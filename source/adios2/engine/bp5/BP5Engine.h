@@ -79,6 +79,33 @@ public:
                                    const bool hasSubFiles = true,
                                    const bool isReader = false) const noexcept;
 
+    /** BufferV implementation holding the data of a step */
+    enum class BufferVType
+    {
+        MallocVType, // single contiguous block, grown by realloc
+        ChunkVType   // list of fixed-size chunks recycled across steps
+    };
+
+    /** How the data of the writers reaches the subfiles */
+    enum class AggregationType
+    {
+        EveryoneWrites, // each writer writes its own data, in a chain
+        TwoLevelShm     // writers of a node pass data through shared memory
+    };
+
+    /** default size of a ChunkV chunk, 16Mb, in bytes */
+    static constexpr size_t DefaultBufferChunkSize = 16 * 1024 * 1024;
+
+    /** default largest shared memory segment per writer, 16Mb, in bytes */
+    static constexpr size_t DefaultMaxShmSize = 16 * 1024 * 1024;
+
+    /** default sub-block size of the min/max statistics, as in BP4, in
+     * elements, large enough that blocks are never divided */
+    static constexpr size_t DefaultStatsBlockSize = 1125899906842624ULL;
+
+    /** default largest hole between two data blocks read as one, 1Mb */
+    static constexpr size_t DefaultReadCoalesceGap = 1024 * 1024;
+
 #define BP5_FOREACH_PARAMETER_TYPE_4ARGS(MACRO)                                \
     MACRO(OpenTimeoutSecs, Int, int, 3600)                                     \
     MACRO(BeginStepPollingFrequencySecs, Int, int, 0)                          \
@@ -90,7 +117,21 @@ public:
     MACRO(CollectiveMetadata, Bool, bool, true)                                \
     MACRO(NumAggregators, UInt, unsigned int, 999999999)                       \
     MACRO(AsyncTasks, Bool, bool, true)                                        \
-    MACRO(ReaderShortCircuitReads, Bool, bool, false)
+    MACRO(ReaderShortCircuitReads, Bool, bool, false)                          \
+    MACRO(BufferVType, BufferVType, int, (int)BufferVType::ChunkVType)         \
+    MACRO(BufferChunkSize, SizeBytes, size_t, DefaultBufferChunkSize)          \
+    MACRO(Threads, UInt, unsigned int, 0)                                      \
+    MACRO(ReadCoalesceGap, SizeBytes, size_t, DefaultReadCoalesceGap)          \
+    MACRO(AsyncWrite, Bool, bool, false)                                       \
+    MACRO(AsyncWriteBufferedSteps, UInt, unsigned int, 1)                      \
+    MACRO(AggregationType, AggregationType, int,                               \
+          (int)AggregationType::EveryoneWrites)                                \
+    MACRO(MaxShmSize, SizeBytes, size_t, DefaultMaxShmSize)                    \
+    MACRO(MetadataCacheSteps, UInt, unsigned int, 16)                          \
+    MACRO(Trace, Bool, bool, false)                                            \
+    MACRO(StatsLevel, UInt, unsigned int, 1)                                   \
+    MACRO(StatsBlockSize, SizeBytes, size_t, DefaultStatsBlockSize)            \
+    MACRO(LazyMetadata, Bool, bool, false)
 
     struct BP5Params
     {
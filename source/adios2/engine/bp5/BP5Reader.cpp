@@ -9,10 +9,16 @@
 #include "BP5Reader.h"
 #include "BP5Reader.tcc"
 
+#include "adios2/toolkit/transport/file/FileFStream.h"
 #include <adios2-perfstubs-interface.h>
 
+#include <algorithm> // std::sort, std::min, std::max
+#include <atomic>
 #include <chrono>
+#include <cstdlib> // malloc
+#include <cstring> // std::memcpy
 #include <errno.h>
+#include <thread>
 
 namespace adios2
 {
@@ -54,15 +60,14 @@ StepStatus BP5Reader::BeginStep(StepMode mode, const float timeoutSeconds)
     {
         if (m_StepsCount == 0)
         {
-            //            status = CheckForNewSteps(Seconds(timeoutSeconds));
+            status = CheckForNewSteps(Seconds(timeoutSeconds));
         }
     }
     else
     {
         if (m_CurrentStep + 1 >= m_StepsCount)
         {
-            // status = CheckForNewSteps(Seconds(timeoutSeconds));
-            status = StepStatus::EndOfStream;
+            status = CheckForNewSteps(Seconds(timeoutSeconds));
         }
     }
     if (status == StepStatus::OK)
@@ -92,18 +97,23 @@ StepStatus BP5Reader::BeginStep(StepMode mode, const float timeoutSeconds)
         m_IO.RemoveAllVariables();
         m_BP5Deserializer->SetupForTimestep(m_CurrentStep);
 
-        size_t pgstart = m_MetadataIndexTable[m_CurrentStep][0];
-        size_t Position = pgstart + sizeof(uint64_t); // skip total data size
+        ReadStepMetadata(m_CurrentStep);
+        profiling::ScopedTrace trace(
+            profiling::TraceEvent::BP5ReaderInstallMetadata, m_CurrentStep);
+        size_t Position = sizeof(uint64_t); // skip total data size
         size_t MDPosition = Position + 2 * sizeof(uint64_t) * m_WriterCount;
+        std::vector<void *> MetadataBlocks(m_WriterCount);
+        std::vector<size_t> MetadataSizes(m_WriterCount);
         for (size_t i = 0; i < m_WriterCount; i++)
         {
             // variable metadata for timestep
-            size_t ThisMDSize = helper::ReadValue<uint64_t>(
+            MetadataSizes[i] = helper::ReadValue<uint64_t>(
                 m_Metadata.m_Buffer, Position, m_Minifooter.IsLittleEndian);
-            char *ThisMD = m_Metadata.m_Buffer.data() + MDPosition;
-            m_BP5Deserializer->InstallMetaData(ThisMD, ThisMDSize, i);
-            MDPosition += ThisMDSize;
+            MetadataBlocks[i] = m_Metadata.m_Buffer.data() + MDPosition;
+            MDPosition += MetadataSizes[i];
         }
+        // the writers' blocks are independent, decoded concurrently
+        m_BP5Deserializer->InstallMetaData(MetadataBlocks, MetadataSizes);
         for (size_t i = 0; i < m_WriterCount; i++)
         {
             // attribute metadata for timestep
@@ -134,37 +144,172 @@ void BP5Reader::EndStep()
     PerformGets();
 }
 
-void BP5Reader::ReadData(const size_t WriterRank, const size_t Timestep,
-                         const size_t StartOffset, const size_t Length,
-                         char *Destination)
+void BP5Reader::OpenSubfile(transportman::TransportMan &fileManager,
+                            const size_t SubfileNum)
 {
-    size_t DataStartPos = m_MetadataIndexTable[Timestep][2];
-    size_t SubfileNum = m_WriterToFileMap[WriterRank];
-    DataStartPos += WriterRank * sizeof(uint64_t);
-    size_t DataStart = helper::ReadValue<uint64_t>(
-        m_MetadataIndex.m_Buffer, DataStartPos, m_Minifooter.IsLittleEndian);
     // check if subfile is already opened
-    if (m_DataFileManager.m_Transports.count(SubfileNum) == 0)
+    if (fileManager.m_Transports.count(SubfileNum) == 0)
     {
         const std::string subFileName = GetBPSubStreamName(
             m_Name, SubfileNum, m_Minifooter.HasSubFiles, true);
 
-        m_DataFileManager.OpenFileID(subFileName, SubfileNum, Mode::Read,
-                                     {{"transport", "File"}}, false);
+        fileManager.OpenFileID(subFileName, SubfileNum, Mode::Read,
+                               m_IO.m_TransportsParameters[0], false);
+    }
+}
+
+void BP5Reader::ReadData(transportman::TransportMan &fileManager,
+                         const size_t SubfileNum, const size_t FileOffset,
+                         const size_t Length, char *Destination)
+{
+    OpenSubfile(fileManager, SubfileNum);
+    fileManager.ReadFile(Destination, Length, FileOffset, SubfileNum);
+}
+
+void BP5Reader::MapOrAllocate(
+    std::vector<format::BP5Deserializer::ReadRequest> &requests)
+{
+    for (auto &Req : requests)
+    {
+        const size_t SubfileNum = m_WriterToFileMap[Req.WriterRank];
+        const size_t FileOffset =
+            m_MetadataIndexTable.at(Req.Timestep)[2 + Req.WriterRank] +
+            Req.StartOffset;
+        OpenSubfile(m_DataFileManager, SubfileNum);
+        const char *mapped = (Req.ReadLength > 0)
+                                 ? m_DataFileManager.MappedData(
+                                       Req.ReadLength, FileOffset, SubfileNum)
+                                 : nullptr;
+        if (mapped != nullptr)
+        {
+            Req.DestinationAddr = const_cast<char *>(mapped);
+            Req.Mapped = true;
+        }
+        else
+        {
+            Req.DestinationAddr = (char *)malloc(Req.ReadLength);
+        }
+    }
+}
+
+std::vector<BP5Reader::ReadGroup> BP5Reader::PlanReads(
+    const std::vector<format::BP5Deserializer::ReadRequest> &requests) const
+{
+    struct Located
+    {
+        size_t SubfileNum;
+        size_t FileOffset;
+        size_t Index;
+    };
+    std::vector<Located> located;
+    located.reserve(requests.size());
+    for (size_t i = 0; i < requests.size(); ++i)
+    {
+        const auto &Req = requests[i];
+        if (Req.Mapped)
+        {
+            continue;
+        }
+        const size_t DataStart =
+            m_MetadataIndexTable.at(Req.Timestep)[2 + Req.WriterRank];
+        located.push_back({m_WriterToFileMap[Req.WriterRank],
+                           DataStart + Req.StartOffset, i});
+    }
+
+    std::sort(located.begin(), located.end(),
+              [](const Located &a, const Located &b) {
+                  return (a.SubfileNum != b.SubfileNum)
+                             ? a.SubfileNum < b.SubfileNum
+                             : a.FileOffset < b.FileOffset;
+              });
+
+    std::vector<ReadGroup> groups;
+    for (const auto &L : located)
+    {
+        const size_t length = requests[L.Index].ReadLength;
+        if (!groups.empty())
+        {
+            ReadGroup &G = groups.back();
+            const size_t groupEnd = G.FileOffset + G.Length;
+            const size_t newEnd = std::max(groupEnd, L.FileOffset + length);
+            if (G.SubfileNum == L.SubfileNum &&
+                L.FileOffset <= groupEnd + m_Parameters.ReadCoalesceGap &&
+                newEnd - G.FileOffset <= MaxCoalescedReadSize)
+            {
+                G.Length = newEnd - G.FileOffset;
+                G.Requests.emplace_back(L.Index, L.FileOffset - G.FileOffset);
+                continue;
+            }
+        }
+        groups.push_back({L.SubfileNum, L.FileOffset, length, {{L.Index, 0}}});
+    }
+    return groups;
+}
+
+void BP5Reader::ReadGroupData(
+    transportman::TransportMan &fileManager, const ReadGroup &group,
+    std::vector<format::BP5Deserializer::ReadRequest> &requests)
+{
+    if (group.Requests.size() == 1)
+    {
+        auto &Req = requests[group.Requests.front().first];
+        ReadData(fileManager, group.SubfileNum, group.FileOffset,
+                 Req.ReadLength, Req.DestinationAddr);
+        return;
+    }
+
+    std::vector<char> buffer(group.Length);
+    ReadData(fileManager, group.SubfileNum, group.FileOffset, group.Length,
+             buffer.data());
+    for (const auto &R : group.Requests)
+    {
+        auto &Req = requests[R.first];
+        std::memcpy(Req.DestinationAddr, buffer.data() + R.second,
+                    Req.ReadLength);
     }
-    m_DataFileManager.ReadFile(Destination, Length, DataStart + StartOffset,
-                               SubfileNum);
 }
 
 void BP5Reader::PerformGets()
 {
     PERFSTUBS_SCOPED_TIMER("BP5Reader::PerformGets");
-    auto ReadRequests = m_BP5Deserializer->GenerateReadRequests();
-    // Potentially optimize read requests, make contiguous, etc.
-    for (const auto &Req : ReadRequests)
+    profiling::ScopedTrace trace(profiling::TraceEvent::BP5ReaderReadData,
+                                 m_CurrentStep);
+    auto ReadRequests = m_BP5Deserializer->GenerateReadRequests(false);
+    MapOrAllocate(ReadRequests);
+    const std::vector<ReadGroup> groups = PlanReads(ReadRequests);
+
+    const size_t nThreads =
+        std::min(static_cast<size_t>(m_Threads), groups.size());
+    if (nThreads <= 1)
+    {
+        for (const auto &group : groups)
+        {
+            ReadGroupData(m_DataFileManager, group, ReadRequests);
+        }
+    }
+    else
     {
-        ReadData(Req.WriterRank, Req.Timestep, Req.StartOffset, Req.ReadLength,
-                 Req.DestinationAddr);
+        while (m_ThreadFileManagers.size() < nThreads - 1)
+        {
+            m_ThreadFileManagers.emplace_back(
+                new transportman::TransportMan(m_Comm));
+        }
+
+        // threads pick the next range in (subfile, offset) order, each
+        // reading lane has its own file manager
+        std::atomic<size_t> nextGroup(0);
+        auto lf_Reader = [&](const size_t lane) {
+            transportman::TransportMan &fileManager =
+                (lane == 0) ? m_DataFileManager
+                            : *m_ThreadFileManagers[lane - 1];
+            size_t g;
+            while ((g = nextGroup++) < groups.size())
+            {
+                ReadGroupData(fileManager, groups[g], ReadRequests);
+            }
+        };
+        m_IO.m_ADIOS.GetThreadPool().ParallelFor(
+            nThreads, static_cast<unsigned int>(nThreads), lf_Reader);
     }
 
     m_BP5Deserializer->FinalizeGets(ReadRequests);
@@ -181,6 +326,22 @@ void BP5Reader::Init()
     }
 
     ParseParams(m_IO, m_Parameters);
+    if (m_Parameters.Trace)
+    {
+        profiling::Tracer::Enable();
+        m_TraceStart = profiling::Tracer::Now();
+    }
+    m_Threads = m_Parameters.Threads;
+    if (m_Threads == 0)
+    {
+        // automatic: a few threads, reads are latency bound not CPU bound
+        const unsigned int hwThreads = std::thread::hardware_concurrency();
+        m_Threads = (hwThreads == 0) ? 1 : hwThreads;
+        if (m_Threads > DefaultReadThreads)
+        {
+            m_Threads = DefaultReadThreads;
+        }
+    }
     m_ReaderIsRowMajor = helper::IsRowMajor(m_IO.m_HostLanguage);
     InitTransports();
 
@@ -203,6 +364,7 @@ void BP5Reader::Init()
         /* non-stream reader gets as much steps as available now */
         InitBuffer(timeoutInstant, pollSeconds / 10, timeoutSeconds);
     }
+    /* stream reader picks up the steps in BeginStep */
 }
 
 bool BP5Reader::SleepOrQuit(const TimePoint &timeoutInstant,
@@ -370,168 +532,133 @@ void BP5Reader::InitTransports()
     }
 }
 
-uint64_t BP5Reader::MetadataExpectedMinFileSize(const std::string &IdxFileName,
-                                                bool hasHeader)
-{
-    size_t cur_idxsize = m_MetadataIndex.m_Buffer.size();
-    static constexpr size_t m_MinIndexRecordSize = 3 * sizeof(uint64_t);
-    if ((hasHeader && cur_idxsize < m_IndexHeaderSize + m_MinIndexRecordSize) ||
-        cur_idxsize < m_MinIndexRecordSize)
-    {
-        // no (new) step entry in the index, so no metadata is expected
-        return 0;
-    }
-    uint64_t lastpos =
-        *(uint64_t *)&(m_MetadataIndex.m_Buffer[cur_idxsize - 24]);
-    return lastpos;
-}
-
-void BP5Reader::InstallMetaMetaData(format::BufferSTL buffer)
+size_t BP5Reader::InstallMetaMetaData(format::BufferSTL &buffer)
 {
+    static constexpr size_t HeaderSize = 2 * sizeof(uint64_t);
     size_t Position = 0;
-    while (Position < buffer.m_Buffer.size())
+    while (Position + HeaderSize <= buffer.m_Buffer.size())
     {
         format::BP5Base::MetaMetaInfoBlock MMI;
 
+        size_t EntryPosition = Position;
         MMI.MetaMetaIDLen = helper::ReadValue<uint64_t>(
-            buffer.m_Buffer, Position, m_Minifooter.IsLittleEndian);
+            buffer.m_Buffer, EntryPosition, m_Minifooter.IsLittleEndian);
         MMI.MetaMetaInfoLen = helper::ReadValue<uint64_t>(
-            buffer.m_Buffer, Position, m_Minifooter.IsLittleEndian);
-        MMI.MetaMetaID = buffer.Data() + Position;
-        MMI.MetaMetaInfo = buffer.Data() + Position + MMI.MetaMetaIDLen;
+            buffer.m_Buffer, EntryPosition, m_Minifooter.IsLittleEndian);
+        if (EntryPosition + MMI.MetaMetaIDLen + MMI.MetaMetaInfoLen >
+            buffer.m_Buffer.size())
+        {
+            // the writer is still writing this entry
+            break;
+        }
+        MMI.MetaMetaID = buffer.Data() + EntryPosition;
+        MMI.MetaMetaInfo = buffer.Data() + EntryPosition + MMI.MetaMetaIDLen;
         m_BP5Deserializer->InstallMetaMetaData(MMI);
-        Position += MMI.MetaMetaIDLen + MMI.MetaMetaInfoLen;
+        Position = EntryPosition + MMI.MetaMetaIDLen + MMI.MetaMetaInfoLen;
     }
+    return Position;
 }
 
 void BP5Reader::InitBuffer(const TimePoint &timeoutInstant,
                            const Seconds &pollSeconds,
                            const Seconds &timeoutSeconds)
+{
+    /* Index all steps written so far, their metadata is read from md.0 in
+     * BeginStep */
+    UpdateBuffer(timeoutInstant, pollSeconds);
+}
+
+size_t BP5Reader::UpdateBuffer(const TimePoint &timeoutInstant,
+                               const Seconds &pollSeconds)
 {
     size_t newIdxSize = 0;
-    // Put all metadata in buffer
     if (m_Comm.Rank() == 0)
     {
-        /* Read metadata index table into memory */
-        const size_t metadataIndexFileSize =
-            m_MDIndexFileManager.GetFileSize(0);
-        if (metadataIndexFileSize > 0)
+        profiling::ScopedTrace trace(
+            profiling::TraceEvent::BP5ReaderReadMetadata, m_CurrentStep);
+        /* Read only what was appended to the index table since the last
+         * call, the tail may end with an incomplete record */
+        const size_t idxFileSize = m_MDIndexFileManager.GetFileSize(0);
+        if (idxFileSize > m_MDIndexFileAlreadyReadSize)
         {
-            m_MetadataIndex.Resize(metadataIndexFileSize,
+            newIdxSize = idxFileSize - m_MDIndexFileAlreadyReadSize;
+            m_MetadataIndex.Resize(newIdxSize,
                                    "allocating metadata index buffer, "
-                                   "in call to BPFileReader Open");
+                                   "in call to BP5Reader BeginStep/Open");
             m_MDIndexFileManager.ReadFile(m_MetadataIndex.m_Buffer.data(),
-                                          metadataIndexFileSize);
-
-            /* Read metametadata into memory */
-            const size_t metametadataFileSize =
-                m_FileMetaMetadataManager.GetFileSize(0);
-            m_MetaMetadata.Resize(metametadataFileSize,
-                                  "allocating metadata index buffer, "
-                                  "in call to BPFileReader Open");
-            m_FileMetaMetadataManager.ReadFile(m_MetaMetadata.m_Buffer.data(),
-                                               metametadataFileSize);
-
-            size_t fileSize = 0;
-            fileSize = m_MDFileManager.GetFileSize(0);
-#ifdef NOTDEF
-            /* Read metadata file into memory but first make sure
-             * it has the content that the index table refers to */
-            uint64_t expectedMinFileSize =
-                MetadataExpectedMinFileSize(m_Name, true);
-            do
-            {
-                fileSize = m_MDFileManager.GetFileSize(0);
-                if (fileSize >= expectedMinFileSize)
-                {
-                    break;
-                }
-            } while (SleepOrQuit(timeoutInstant, pollSeconds));
-
-            if (fileSize >= expectedMinFileSize)
+                                          newIdxSize,
+                                          m_MDIndexFileAlreadyReadSize);
+
+            /* The writer writes metametadata before the index records of
+             * the steps using it */
+            const size_t mmdFileSize = m_FileMetaMetadataManager.GetFileSize(0);
+            const size_t newMMDSize =
+                (mmdFileSize > m_MetaMetadataFileAlreadyReadSize)
+                    ? mmdFileSize - m_MetaMetadataFileAlreadyReadSize
+                    : 0;
+            m_MetaMetadata.Resize(newMMDSize,
+                                  "allocating metametadata buffer, "
+                                  "in call to BP5Reader BeginStep/Open");
+            if (newMMDSize > 0)
             {
-#endif
-                m_Metadata.Resize(
-                    fileSize,
-                    "allocating metadata buffer, in call to BP5Reader Open");
-
-                m_MDFileManager.ReadFile(m_Metadata.m_Buffer.data(), fileSize);
-                m_MDFileAlreadyReadSize = fileSize;
-                m_MDIndexFileAlreadyReadSize = metadataIndexFileSize;
-                newIdxSize = metadataIndexFileSize;
-#ifdef NOTDEF
+                m_FileMetaMetadataManager.ReadFile(
+                    m_MetaMetadata.m_Buffer.data(), newMMDSize,
+                    m_MetaMetadataFileAlreadyReadSize);
             }
-            else
-            {
-                throw std::ios_base::failure(
-                    "ERROR: File " + m_Name +
-                    " was found with an index file but md.0 "
-                    "has not contained enough data within "
-                    "the specified timeout of " +
-                    std::to_string(timeoutSeconds.count()) +
-                    " seconds. index size = " +
-                    std::to_string(metadataIndexFileSize) +
-                    " metadata size = " + std::to_string(fileSize) +
-                    " expected size = " + std::to_string(expectedMinFileSize) +
-                    ". One reason could be if the reader finds old data while "
-                    "the writer is creating the new files.");
-            }
-#endif
         }
     }
 
     newIdxSize = m_Comm.BroadcastValue(newIdxSize, 0);
-
-    if (newIdxSize > 0)
+    if (newIdxSize == 0)
     {
-        // broadcast buffer to all ranks from zero
-        m_Comm.BroadcastVector(m_Metadata.m_Buffer);
-
-        // broadcast metadata index buffer to all ranks from zero
-        m_Comm.BroadcastVector(m_MetadataIndex.m_Buffer);
+        return 0;
+    }
 
-        // broadcast metadata index buffer to all ranks from zero
-        m_Comm.BroadcastVector(m_MetaMetadata.m_Buffer);
+    // broadcast metadata index buffer to all ranks from zero
+    m_Comm.BroadcastVector(m_MetadataIndex.m_Buffer);
 
-        /* Parse metadata index table */
-        ParseMetadataIndex(m_MetadataIndex, 0, true, false);
-        // now we are sure the index header has been parsed, first step parsing
-        // done
+    // broadcast metametadata buffer to all ranks from zero
+    m_Comm.BroadcastVector(m_MetaMetadata.m_Buffer);
 
+    /* Parse the new index records, every rank keeps track of the position */
+    const size_t stepsBefore = m_StepsCount;
+    m_MDIndexFileAlreadyReadSize +=
+        ParseMetadataIndex(m_MetadataIndex, !m_IdxHeaderParsed);
+    if (!m_IdxHeaderParsed)
+    {
+        if (m_MDIndexFileAlreadyReadSize == 0)
+        {
+            // header is not complete yet
+            return 0;
+        }
+        m_IdxHeaderParsed = true;
         m_BP5Deserializer = new format::BP5Deserializer(
             m_WriterCount, m_WriterIsRowMajor, m_ReaderIsRowMajor);
         m_BP5Deserializer->m_Engine = this;
+        m_BP5Deserializer->m_Threads = m_Threads;
+        m_BP5Deserializer->m_ThreadPool = &m_IO.m_ADIOS.GetThreadPool();
+        m_BP5Deserializer->m_LazyMetadata = m_Parameters.LazyMetadata;
+    }
 
-        InstallMetaMetaData(m_MetaMetadata);
-
-        m_IdxHeaderParsed = true;
+    m_MetaMetadataFileAlreadyReadSize += InstallMetaMetaData(m_MetaMetadata);
 
-        // fills IO with Variables and Attributes
-        //        m_MDFileProcessedSize = ParseMetadata(
-        //            m_Metadata, *this, true);
-
-        /* m_MDFileProcessedSize is the position in the buffer where processing
-         * ends. The processing is controlled by the number of records in the
-         * Index, which may be less than the actual entries in the metadata in a
-         * streaming situation (where writer has just written metadata for step
-         * K+1,...,K+L while the index contains K steps when the reader looks at
-         * it).
-         *
-         * In ProcessMetadataForNewSteps(), we will re-read the metadata which
-         * is in the buffer but has not been processed yet.
-         */
-    }
+    return m_StepsCount - stepsBefore;
 }
 
-void BP5Reader::ParseMetadataIndex(format::BufferSTL &bufferSTL,
-                                   const size_t absoluteStartPos,
-                                   const bool hasHeader, const bool oneStepOnly)
+size_t BP5Reader::ParseMetadataIndex(format::BufferSTL &bufferSTL,
+                                     const bool hasHeader)
 {
     const auto &buffer = bufferSTL.m_Buffer;
     size_t &position = bufferSTL.m_Position;
+    position = 0;
 
     if (hasHeader)
     {
+        if (buffer.size() < m_IndexHeaderSize)
+        {
+            return 0;
+        }
+
         // Read header (64 bytes)
         // long version string
         position = m_VersionTagPosition;
@@ -582,40 +709,150 @@ void BP5Reader::ParseMetadataIndex(format::BufferSTL &bufferSTL,
             buffer, position, m_Minifooter.IsLittleEndian);
         m_WriterIsRowMajor = val == 'n';
         // move position to first row
-        position = 64;
+        position = m_IndexHeaderSize;
+
+        // subfile of each writer follows the header
+        if (buffer.size() < position + m_WriterCount * sizeof(uint64_t))
+        {
+            return 0;
+        }
+        m_WriterToFileMap.clear();
+        for (uint64_t i = 0; i < m_WriterCount; i++)
+        {
+            m_WriterToFileMap.push_back(helper::ReadValue<uint64_t>(
+                buffer, position, m_Minifooter.IsLittleEndian));
+        }
+    }
+
+    // Read each complete record now
+    const size_t recordSize = (2 + m_WriterCount) * sizeof(uint64_t);
+    while (position + recordSize <= buffer.size())
+    {
+        // metadata position and size in md.0, data position of each writer
+        std::vector<uint64_t> ptrs;
+        ptrs.reserve(2 + m_WriterCount);
+        for (uint64_t i = 0; i < 2 + m_WriterCount; i++)
+        {
+            ptrs.push_back(helper::ReadValue<uint64_t>(
+                buffer, position, m_Minifooter.IsLittleEndian));
+        }
+        m_MetadataIndexTable[m_StepsCount] = std::move(ptrs);
+        m_StepsCount++;
+    }
+    return position;
+}
+
+bool BP5Reader::CheckWriterActive()
+{
+    size_t flag = 0;
+    if (m_Comm.Rank() == 0)
+    {
+        char activeChar = '\0';
+        m_MDIndexFileManager.ReadFile(&activeChar, 1, m_ActiveFlagPosition, 0);
+        flag = (activeChar == '\1' ? 1 : 0);
+    }
+    flag = m_Comm.BroadcastValue(flag, 0);
+    m_WriterIsActive = (flag > 0);
+    return m_WriterIsActive;
+}
+
+StepStatus BP5Reader::CheckForNewSteps(Seconds timeoutSeconds)
+{
+    /* Do a collective wait for a step within timeout.
+       Make sure every reader comes to the same conclusion */
+    if (!m_Parameters.StreamReader)
+    {
+        // file reader has indexed all steps at Open
+        return StepStatus::EndOfStream;
+    }
+
+    if (timeoutSeconds < Seconds::zero())
+    {
+        timeoutSeconds = Seconds(999999999); // max 1 billion seconds wait
     }
+    const TimePoint timeoutInstant =
+        std::chrono::steady_clock::now() + timeoutSeconds;
 
-    for (uint64_t i = 0; i < m_WriterCount; i++)
+    auto pollSeconds = Seconds(m_Parameters.BeginStepPollingFrequencySecs);
+    if (pollSeconds > timeoutSeconds)
     {
-        m_WriterToFileMap.push_back(helper::ReadValue<uint64_t>(
-            buffer, position, m_Minifooter.IsLittleEndian));
+        pollSeconds = timeoutSeconds;
     }
 
-    // Read each record now
-    uint64_t currentStep = 0;
+    /* Poll, each round only reads what was appended to the index */
+    size_t newSteps = 0;
     do
     {
-        std::vector<uint64_t> ptrs;
-        const uint64_t MetadataPos = helper::ReadValue<uint64_t>(
-            buffer, position, m_Minifooter.IsLittleEndian);
-        const uint64_t MetadataSize = helper::ReadValue<uint64_t>(
-            buffer, position, m_Minifooter.IsLittleEndian);
+        newSteps = UpdateBuffer(timeoutInstant, pollSeconds / 10);
+        if (newSteps > 0)
+        {
+            break;
+        }
+        if (m_IdxHeaderParsed && !CheckWriterActive())
+        {
+            /* Race condition: the writer may have written its last steps
+             * and terminated since UpdateBuffer looked at the index */
+            newSteps = UpdateBuffer(timeoutInstant, pollSeconds / 10);
+            break;
+        }
+    } while (SleepOrQuit(timeoutInstant, pollSeconds));
 
-        ptrs.push_back(MetadataPos);
-        ptrs.push_back(MetadataSize);
-        ptrs.push_back(position);
-        m_MetadataIndexTable[currentStep] = ptrs;
-        for (uint64_t i = 0; i < m_WriterCount; i++)
+    if (newSteps > 0)
+    {
+        return StepStatus::OK;
+    }
+    return m_WriterIsActive ? StepStatus::NotReady : StepStatus::EndOfStream;
+}
+
+void BP5Reader::ReadStepMetadata(const size_t step)
+{
+    profiling::ScopedTrace trace(profiling::TraceEvent::BP5ReaderReadMetadata,
+                                 step);
+    auto it = m_MetadataCacheIndex.find(step);
+    if (it == m_MetadataCacheIndex.end())
+    {
+        /* Read this step and the indexed steps after it with one read */
+        const size_t cacheSteps =
+            std::max<size_t>(1, m_Parameters.MetadataCacheSteps);
+        const size_t last = std::min(step + cacheSteps, m_StepsCount) - 1;
+        const auto &firstPtrs = m_MetadataIndexTable.at(step);
+        const auto &lastPtrs = m_MetadataIndexTable.at(last);
+        const size_t start = firstPtrs[0];
+        const size_t size = lastPtrs[0] + lastPtrs[1] - start;
+
+        std::vector<char> buffer;
+        if (m_Comm.Rank() == 0)
         {
-            size_t DataPosPos = ptrs[2] + sizeof(uint64_t) * i;
-            const uint64_t DataPos = helper::ReadValue<uint64_t>(
-                buffer, DataPosPos, m_Minifooter.IsLittleEndian);
+            buffer.resize(size);
+            m_MDFileManager.ReadFile(buffer.data(), size, start);
         }
+        m_Comm.BroadcastVector(buffer);
 
-        position += sizeof(uint64_t) * m_WriterCount;
-        m_StepsCount++;
-        currentStep++;
-    } while (!oneStepOnly && position < buffer.size());
+        for (size_t s = last + 1; s-- > step;)
+        {
+            if (m_MetadataCacheIndex.count(s))
+            {
+                continue;
+            }
+            const auto &ptrs = m_MetadataIndexTable.at(s);
+            const auto begin = buffer.begin() + (ptrs[0] - start);
+            m_MetadataCache.emplace_front(
+                s, std::vector<char>(begin, begin + ptrs[1]));
+            m_MetadataCacheIndex[s] = m_MetadataCache.begin();
+        }
+        while (m_MetadataCache.size() > cacheSteps)
+        {
+            m_MetadataCacheIndex.erase(m_MetadataCache.back().first);
+            m_MetadataCache.pop_back();
+        }
+        it = m_MetadataCacheIndex.find(step);
+    }
+
+    /* The deserializer decodes the block in place and refers to it until
+     * the next step, so it is taken out of the cache */
+    m_Metadata.m_Buffer = std::move(it->second->second);
+    m_MetadataCache.erase(it->second);
+    m_MetadataCacheIndex.erase(it);
 }
 
 #define declare_type(T)                                                        \
@@ -636,7 +873,28 @@ void BP5Reader::DoClose(const int transportIndex)
 {
     PERFSTUBS_SCOPED_TIMER("BP5Reader::Close");
     m_DataFileManager.CloseFiles();
+    for (auto &fileManager : m_ThreadFileManagers)
+    {
+        fileManager->CloseFiles();
+    }
     m_MDFileManager.CloseFiles();
+    m_MDIndexFileManager.CloseFiles();
+    m_FileMetaMetadataManager.CloseFiles();
+
+    if (m_Parameters.Trace)
+    {
+        const std::vector<char> traceJSON(
+            profiling::Tracer::AggregateChromeTraceJSON(m_Comm, m_TraceStart));
+        if (m_Comm.Rank() == 0)
+        {
+            transport::FileFStream traceJSONStream(m_Comm);
+            traceJSONStream.Open(helper::RemoveTrailingSlash(m_Name) +
+                                     "/reader_trace.json",
+                                 Mode::Write);
+            traceJSONStream.Write(traceJSON.data(), traceJSON.size());
+            traceJSONStream.Close();
+        }
+    }
 }
 
 #define declare_type(T)                                                        \
@@ -16,9 +16,15 @@
 #include "adios2/engine/bp5/BP5Engine.h"
 #include "adios2/helper/adiosComm.h"
 #include "adios2/toolkit/format/bp5/BP5Deserializer.h"
+#include "adios2/toolkit/profiling/tracing/Tracer.h"
 #include "adios2/toolkit/transportman/TransportMan.h"
 
 #include <chrono>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace adios2
 {
@@ -84,6 +90,8 @@ private:
     transportman::TransportMan m_FileMetaMetadataManager;
     /* How many bytes of metadata index have we already read in? */
     size_t m_MDIndexFileAlreadyReadSize = 0;
+    /* How many bytes of metametadata have we already installed? */
+    size_t m_MetaMetadataFileAlreadyReadSize = 0;
 
     /* transport manager for managing the active flag file */
     transportman::TransportMan m_ActiveFlagFileManager;
@@ -95,6 +103,9 @@ private:
     bool m_FirstStep = true;
     bool m_IdxHeaderParsed = false; // true after first index parsing
 
+    /** profiling::Tracer time at Open, events before it are not exported */
+    uint64_t m_TraceStart = 0;
+
     Minifooter m_Minifooter;
 
     void Init();
@@ -124,16 +135,19 @@ private:
     void InitBuffer(const TimePoint &timeoutInstant, const Seconds &pollSeconds,
                     const Seconds &timeoutSeconds);
 
-    /** Read in more metadata if exist (throwing away old).
-     *  For streaming only.
-     *  @return size of new content from Index Table
+    /** Reads what was appended to the index table and the metametadata
+     *  file since the last call, and parses only that.
+     *  @return number of new steps
      */
     size_t UpdateBuffer(const TimePoint &timeoutInstant,
                         const Seconds &pollSeconds);
 
-    void ParseMetadataIndex(format::BufferSTL &bufferSTL,
-                            const size_t absoluteStartPos, const bool hasHeader,
-                            const bool oneStepOnly);
+    /** Parses the complete records in bufferSTL into m_MetadataIndexTable
+     *  @param hasHeader bufferSTL starts at the beginning of the file
+     *  @return number of bytes parsed, 0 if the header is incomplete
+     */
+    size_t ParseMetadataIndex(format::BufferSTL &bufferSTL,
+                              const bool hasHeader);
     /** Process the new metadata coming in (in UpdateBuffer)
      *  @param newIdxSize: the size of the new content from Index Table
      */
@@ -194,12 +208,68 @@ private:
     format::BufferSTL m_MetadataIndex;
     format::BufferSTL m_MetaMetadata;
     format::BufferSTL m_Metadata;
-    uint64_t MetadataExpectedMinFileSize(const std::string &IdxFileName,
-                                         bool hasHeader);
-    void InstallMetaMetaData(format::BufferSTL MetaMetadata);
-    void ReadData(const size_t WriterRank, const size_t Timestep,
-                  const size_t StartOffset, const size_t Length,
-                  char *Destination);
+    /** @return number of bytes of complete entries installed */
+    size_t InstallMetaMetaData(format::BufferSTL &MetaMetadata);
+
+    /** metadata blocks of steps read ahead from md.0, at most
+     * MetadataCacheSteps, the least recently read one is dropped first */
+    std::list<std::pair<size_t, std::vector<char>>> m_MetadataCache;
+    std::unordered_map<
+        size_t, std::list<std::pair<size_t, std::vector<char>>>::iterator>
+        m_MetadataCacheIndex;
+
+    /** Collective, moves the metadata block of step into m_Metadata. On a
+     * cache miss the block is read together with the next indexed steps. */
+    void ReadStepMetadata(const size_t step);
+
+    /** Contiguous range of a subfile covering one or more read requests */
+    struct ReadGroup
+    {
+        size_t SubfileNum;
+        size_t FileOffset;
+        size_t Length;
+        /** (index in the request list, offset of its data in the range) */
+        std::vector<std::pair<size_t, size_t>> Requests;
+    };
+
+    /** coalesced ranges are not grown beyond this size, 64Mb */
+    static constexpr size_t MaxCoalescedReadSize = 64 * 1024 * 1024;
+
+    /** Threads=0 uses up to this many threads, fewer on smaller hosts */
+    static constexpr unsigned int DefaultReadThreads = 4;
+
+    /** number of threads reading data in PerformGets */
+    unsigned int m_Threads = 1;
+    /** one data file manager per extra reader thread, each opening its own
+     * handles on the subfiles; thread 0 uses m_DataFileManager */
+    std::vector<std::unique_ptr<transportman::TransportMan>>
+        m_ThreadFileManagers;
+
+    /**
+     * Sorts the requests by subfile and file offset and merges requests that
+     * are at most ReadCoalesceGap bytes apart into one range, skipping
+     * mapped requests
+     */
+    std::vector<ReadGroup> PlanReads(
+        const std::vector<format::BP5Deserializer::ReadRequest> &requests)
+        const;
+
+    /** Points the requests into their subfiles if the data transport maps
+     * files, allocates their destination otherwise */
+    void MapOrAllocate(
+        std::vector<format::BP5Deserializer::ReadRequest> &requests);
+
+    /** Reads one range and scatters it to the destinations of its requests */
+    void ReadGroupData(
+        transportman::TransportMan &fileManager, const ReadGroup &group,
+        std::vector<format::BP5Deserializer::ReadRequest> &requests);
+
+    void OpenSubfile(transportman::TransportMan &fileManager,
+                     const size_t SubfileNum);
+
+    void ReadData(transportman::TransportMan &fileManager,
+                  const size_t SubfileNum, const size_t FileOffset,
+                  const size_t Length, char *Destination);
 };
 
 } // end namespace engine
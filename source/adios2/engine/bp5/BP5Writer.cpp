@@ -12,9 +12,13 @@
 #include "adios2/common/ADIOSMacros.h"
 #include "adios2/core/IO.h"
 #include "adios2/helper/adiosFunctions.h" //CheckIndexRange
+#include "adios2/toolkit/format/buffer/malloc/MallocV.h"
 #include "adios2/toolkit/transport/file/FileFStream.h"
 #include <adios2-perfstubs-interface.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <ctime>
 #include <iostream>
 
@@ -43,9 +47,20 @@ BP5Writer::BP5Writer(IO &io, const std::string &name, const Mode mode,
 StepStatus BP5Writer::BeginStep(StepMode mode, const float timeoutSeconds)
 {
     m_WriterStep++;
+    m_BetweenStepPairs = true;
+    m_BP5Serializer.InitStep(NewDataBuffer());
     return StepStatus::OK;
 }
 
+format::BufferV *BP5Writer::NewDataBuffer()
+{
+    if (m_Parameters.BufferVType == (int)BufferVType::ChunkVType)
+    {
+        return new format::ChunkV("BP5Writer", *m_ChunkPool);
+    }
+    return new format::MallocV("BP5Writer");
+}
+
 size_t BP5Writer::CurrentStep() const { return m_WriterStep; }
 
 void BP5Writer::PerformPuts()
@@ -94,7 +109,7 @@ uint64_t BP5Writer::WriteMetadata(
     MetaDataSize += sizeof(uint64_t);
     m_FileMetadataManager.WriteFiles((char *)SizeVector.data(),
                                      sizeof(uint64_t) * SizeVector.size());
-    MetaDataSize += sizeof(uint64_t) * AttrSizeVector.size();
+    MetaDataSize += sizeof(uint64_t) * SizeVector.size();
     m_FileMetadataManager.WriteFiles((char *)AttrSizeVector.data(),
                                      sizeof(uint64_t) * AttrSizeVector.size());
     MetaDataSize += sizeof(uint64_t) * AttrSizeVector.size();
@@ -120,61 +135,347 @@ uint64_t BP5Writer::WriteMetadata(
 
 void BP5Writer::WriteData(format::BufferV *Data)
 {
-    format::BufferV::BufferV_iovec DataVec = Data->DataVec();
+    profiling::ScopedTrace trace(profiling::TraceEvent::BP5WriterWriteData,
+                                 m_WriterStep);
+    if (m_Parameters.AggregationType == (int)AggregationType::TwoLevelShm)
+    {
+        WriteData_TwoLevelShm(Data);
+    }
+    else
+    {
+        WriteData_EveryoneWrites(Data);
+    }
+}
 
+void BP5Writer::WriteData_EveryoneWrites(format::BufferV *Data)
+{
     // new step writing starts at offset m_DataPos on aggregator
     // others will wait for the position to arrive from the rank below
 
-    if (m_Aggregator.m_Comm.Rank() > 0)
+    if (m_Aggregator->m_Comm.Rank() > 0)
     {
-        m_Aggregator.m_Comm.Recv(&m_DataPos, 1, m_Aggregator.m_Comm.Rank() - 1,
-                                 0, "Chain token in BP5Writer::WriteData");
+        m_Aggregator->m_Comm.Recv(&m_DataPos, 1,
+                                  m_Aggregator->m_Comm.Rank() - 1, 0,
+                                  "Chain token in BP5Writer::WriteData");
     }
     m_StartDataPos = m_DataPos;
+    m_DataPos += Data->Size();
 
-    int i = 0;
-    while (DataVec[i].iov_base != NULL)
+    if (!m_Parameters.AsyncWrite)
     {
-        if (i == 0)
-        {
-            m_FileDataManager.WriteFileAt((char *)DataVec[i].iov_base,
-                                          DataVec[i].iov_len, m_StartDataPos);
-        }
-        else
-        {
-            m_FileDataManager.WriteFiles((char *)DataVec[i].iov_base,
-                                         DataVec[i].iov_len);
-        }
-        m_DataPos += DataVec[i].iov_len;
-        i++;
+        WriteDataVec(Data, m_StartDataPos);
     }
 
-    if (m_Aggregator.m_Comm.Rank() < m_Aggregator.m_Comm.Size() - 1)
+    if (m_Aggregator->m_Comm.Rank() < m_Aggregator->m_Comm.Size() - 1)
     {
-        m_Aggregator.m_Comm.Isend(&m_DataPos, 1, m_Aggregator.m_Comm.Rank() + 1,
-                                  0, "Chain token in BP5Writer::WriteData");
+        m_Aggregator->m_Comm.Isend(&m_DataPos, 1,
+                                   m_Aggregator->m_Comm.Rank() + 1, 0,
+                                   "Chain token in BP5Writer::WriteData");
     }
 
-    if (m_Aggregator.m_Comm.Size() > 1)
+    if (m_Aggregator->m_Comm.Size() > 1)
     {
         // at the end, last rank sends back the final data pos to first rank
         // so it can update its data pos
-        if (m_Aggregator.m_Comm.Rank() == m_Aggregator.m_Comm.Size() - 1)
+        if (m_Aggregator->m_Comm.Rank() == m_Aggregator->m_Comm.Size() - 1)
         {
-            m_Aggregator.m_Comm.Isend(
+            m_Aggregator->m_Comm.Isend(
                 &m_DataPos, 1, 0, 0,
                 "Final chain token in BP5Writer::WriteData");
         }
-        if (m_Aggregator.m_Comm.Rank() == 0)
+        if (m_Aggregator->m_Comm.Rank() == 0)
+        {
+            m_Aggregator->m_Comm.Recv(&m_DataPos, 1,
+                                      m_Aggregator->m_Comm.Size() - 1, 0,
+                                      "Chain token in BP5Writer::WriteData");
+        }
+    }
+
+    if (m_Parameters.AsyncWrite)
+    {
+        // the position is passed on already, write after the chain moved on
+        AsyncWriteEnqueue(Data, m_StartDataPos);
+    }
+}
+
+namespace
+{
+/** Copies size bytes starting at offset start of the iovec list to dest */
+void CopyDataRange(const format::BufferV::iovec *DataVec, size_t start,
+                   size_t size, char *dest)
+{
+    for (size_t i = 0; size > 0 && DataVec[i].iov_base != NULL; ++i)
+    {
+        if (start >= DataVec[i].iov_len)
+        {
+            start -= DataVec[i].iov_len;
+            continue;
+        }
+        const size_t n = std::min(size, DataVec[i].iov_len - start);
+        const char *src = static_cast<const char *>(DataVec[i].iov_base);
+        std::memcpy(dest, src + start, n);
+        dest += n;
+        size -= n;
+        start = 0;
+    }
+}
+} // end anonymous namespace
+
+void BP5Writer::WriteData_TwoLevelShm(format::BufferV *Data)
+{
+    PERFSTUBS_SCOPED_TIMER("BP5Writer::WriteData_TwoLevelShm");
+    aggregator::MPIShmChain &a = m_AggregatorTwoLevelShm;
+
+    // every process computes the file layout of the group:
+    // aggregator data first, then the others in rank order
+    const uint64_t mySize = Data->Size();
+    const std::vector<uint64_t> sizes = a.m_Comm.AllGatherValues(mySize);
+    const uint64_t groupStart = a.m_Comm.BroadcastValue(m_DataPos, 0);
+    std::vector<uint64_t> starts(sizes.size());
+    uint64_t pos = groupStart;
+    uint64_t maxShared = 0;
+    for (size_t r = 0; r < sizes.size(); ++r)
+    {
+        starts[r] = pos;
+        pos += sizes[r];
+        if (r > 0)
+        {
+            maxShared = std::max(maxShared, sizes[r]);
+        }
+    }
+    m_StartDataPos = starts[a.m_Rank];
+    m_DataPos = pos;
+
+    const uint64_t segmentSize =
+        std::min(maxShared, static_cast<uint64_t>(m_Parameters.MaxShmSize));
+    if (segmentSize > 0)
+    {
+        a.AllocateSegments(segmentSize);
+    }
+    const size_t rounds =
+        segmentSize ? (maxShared + segmentSize - 1) / segmentSize : 0;
+
+    format::BufferV::BufferV_iovec DataVec = Data->DataVec();
+
+    if (!a.m_IsAggregator)
+    {
+        for (size_t round = 0; round < rounds; ++round)
         {
-            m_Aggregator.m_Comm.Recv(&m_DataPos, 1,
-                                     m_Aggregator.m_Comm.Size() - 1, 0,
-                                     "Chain token in BP5Writer::WriteData");
+            // wait until the aggregator wrote the previous round
+            a.Fence("in BP5Writer::WriteData_TwoLevelShm");
+            const uint64_t done = round * segmentSize;
+            if (done < mySize)
+            {
+                const size_t n = std::min(segmentSize, mySize - done);
+                CopyDataRange(DataVec, done, n, a.Segment(a.m_Rank));
+                m_ShmBytes += n;
+            }
+            a.Fence("in BP5Writer::WriteData_TwoLevelShm");
         }
+        delete[] DataVec;
+        return;
+    }
+
+    // contiguous runs of file are written with one vectored write
+    std::vector<core::iovec> run;
+    uint64_t runStart = starts[0];
+    uint64_t runEnd = starts[0];
+    auto lf_Add = [&](const void *base, const size_t len,
+                      const uint64_t offset) {
+        if (len == 0)
+        {
+            return;
+        }
+        if (offset != runEnd && !run.empty())
+        {
+            m_FileDataManager.WriteFileAt(run.data(), run.size(), runStart);
+            run.clear();
+        }
+        if (run.empty())
+        {
+            runStart = offset;
+            runEnd = offset;
+        }
+        run.push_back({base, len});
+        runEnd += len;
+        m_AggregatorBytes += len;
+    };
+    auto lf_Flush = [&]() {
+        if (!run.empty())
+        {
+            m_FileDataManager.WriteFileAt(run.data(), run.size(), runStart);
+            run.clear();
+        }
+    };
+
+    try
+    {
+        // own data goes in place, without a copy
+        uint64_t offset = starts[0];
+        for (size_t i = 0; DataVec[i].iov_base != NULL; ++i)
+        {
+            lf_Add(DataVec[i].iov_base, DataVec[i].iov_len, offset);
+            offset += DataVec[i].iov_len;
+        }
+        if (rounds == 0)
+        {
+            lf_Flush();
+        }
+
+        for (size_t round = 0; round < rounds; ++round)
+        {
+            a.Fence("in BP5Writer::WriteData_TwoLevelShm");
+            a.Fence("in BP5Writer::WriteData_TwoLevelShm");
+            const uint64_t done = round * segmentSize;
+            for (int r = 1; r < a.m_Size; ++r)
+            {
+                if (done < sizes[r])
+                {
+                    lf_Add(a.Segment(r), std::min(segmentSize, sizes[r] - done),
+                           starts[r] + done);
+                }
+            }
+            // segments are overwritten in the next round
+            lf_Flush();
+        }
+    }
+    catch (...)
+    {
+        delete[] DataVec;
+        throw;
     }
     delete[] DataVec;
 }
 
+void BP5Writer::WriteDataVec(format::BufferV *Data, const uint64_t StartPos)
+{
+    format::BufferV::BufferV_iovec DataVec = Data->DataVec();
+    size_t nDataVec = 0;
+    while (DataVec[nDataVec].iov_base != NULL)
+    {
+        nDataVec++;
+    }
+    try
+    {
+        if (nDataVec > 0)
+        {
+            // all blocks of this rank in one gathered write
+            m_FileDataManager.WriteFileAt(DataVec, nDataVec, StartPos);
+        }
+    }
+    catch (...)
+    {
+        delete[] DataVec;
+        throw;
+    }
+    delete[] DataVec;
+}
+
+void BP5Writer::AsyncWriteEnqueue(format::BufferV *Data,
+                                  const uint64_t StartPos)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_AsyncWriteMutex);
+        if (m_AsyncWritePending >= m_Parameters.AsyncWriteBufferedSteps)
+        {
+            PERFSTUBS_SCOPED_TIMER("BP5Writer::AsyncWriteBlocked");
+            const auto start = std::chrono::steady_clock::now();
+            m_AsyncWriteDone.wait(lock, [this] {
+                return m_AsyncWritePending <
+                       m_Parameters.AsyncWriteBufferedSteps;
+            });
+            const std::chrono::duration<double> blocked =
+                std::chrono::steady_clock::now() - start;
+            m_AsyncWriteBlockedSecs += blocked.count();
+            ++m_AsyncWriteBlockedSteps;
+        }
+        m_AsyncWriteQueue.push_back({Data, StartPos, m_WriterStep});
+        ++m_AsyncWritePending;
+    }
+    m_AsyncWriteQueued.notify_one();
+    AsyncWriteCheckError();
+}
+
+void BP5Writer::AsyncWriteDrain()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_AsyncWriteMutex);
+        m_AsyncWriteDone.wait(lock,
+                              [this] { return m_AsyncWritePending == 0; });
+    }
+    AsyncWriteCheckError();
+}
+
+void BP5Writer::AsyncWriteStop()
+{
+    if (!m_AsyncWriteThread.joinable())
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_AsyncWriteMutex);
+        m_AsyncWriteFinish = true;
+    }
+    m_AsyncWriteQueued.notify_one();
+    m_AsyncWriteThread.join();
+}
+
+void BP5Writer::AsyncWriteThread()
+{
+    while (true)
+    {
+        AsyncWriteTask task;
+        {
+            std::unique_lock<std::mutex> lock(m_AsyncWriteMutex);
+            m_AsyncWriteQueued.wait(lock, [this] {
+                return !m_AsyncWriteQueue.empty() || m_AsyncWriteFinish;
+            });
+            if (m_AsyncWriteQueue.empty())
+            {
+                return;
+            }
+            task = m_AsyncWriteQueue.front();
+            m_AsyncWriteQueue.pop_front();
+        }
+
+        std::exception_ptr error;
+        try
+        {
+            profiling::ScopedTrace trace(
+                profiling::TraceEvent::BP5WriterWriteData, task.Step);
+            WriteDataVec(task.Data, task.StartPos);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        delete task.Data;
+
+        {
+            std::lock_guard<std::mutex> lock(m_AsyncWriteMutex);
+            if (error && !m_AsyncWriteError)
+            {
+                m_AsyncWriteError = error;
+            }
+            --m_AsyncWritePending;
+        }
+        m_AsyncWriteDone.notify_all();
+    }
+}
+
+void BP5Writer::AsyncWriteCheckError()
+{
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(m_AsyncWriteMutex);
+        std::swap(error, m_AsyncWriteError);
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
 void BP5Writer::WriteMetadataFileIndex(uint64_t MetaDataPos,
                                        uint64_t MetaDataSize)
 {
@@ -256,26 +557,62 @@ void BP5Writer::MarshalAttributes()
     m_MarshaledAttributesCount = attributesCount;
 }
 
+void BP5Writer::ReleaseSpans()
+{
+    for (const std::string &variableName : m_SpanVariables)
+    {
+        const DataType type = m_IO.InquireVariableType(variableName);
+        if (type == DataType::Compound)
+        {
+            // not supported
+        }
+#define declare_template_instantiation(T)                                      \
+    else if (type == helper::GetDataType<T>())                                 \
+    {                                                                          \
+        Variable<T> &variable =                                                \
+            FindVariable<T>(variableName, "in call to EndStep");               \
+        PerformPutCommon(variable);                                            \
+    }
+
+        ADIOS2_FOREACH_PRIMITIVE_STDTYPE_1ARG(declare_template_instantiation)
+#undef declare_template_instantiation
+    }
+    m_SpanVariables.clear();
+}
+
 void BP5Writer::EndStep()
 {
     PERFSTUBS_SCOPED_TIMER("BP5Writer::EndStep");
+    m_BetweenStepPairs = false;
 
+    profiling::Tracer::Begin(profiling::TraceEvent::BP5WriterMarshal,
+                             m_WriterStep);
     MarshalAttributes();
 
     // true: advances step
     auto TSInfo = m_BP5Serializer.CloseTimestep(m_WriterStep);
+    ReleaseSpans();
+    profiling::Tracer::End(profiling::TraceEvent::BP5WriterMarshal,
+                           m_WriterStep);
 
     /* TSInfo includes NewMetaMetaBlocks, the MetaEncodeBuffer, the
      * AttributeEncodeBuffer and the data encode Vector */
     /* the first */
 
+    const uint64_t DataSize = TSInfo.DataBuffer->Size();
     WriteData(TSInfo.DataBuffer);
+    if (m_Parameters.AsyncWrite)
+    {
+        // owned by the write thread now
+        TSInfo.DataBuffer = NULL;
+    }
 
     std::vector<char> MetaBuffer = m_BP5Serializer.CopyMetadataToContiguous(
         TSInfo.NewMetaMetaBlocks, TSInfo.MetaEncodeBuffer,
-        TSInfo.AttributeEncodeBuffer, TSInfo.DataBuffer->Size(),
-        m_StartDataPos);
+        TSInfo.AttributeEncodeBuffer, DataSize, m_StartDataPos);
 
+    profiling::Tracer::Begin(profiling::TraceEvent::BP5WriterAggregate,
+                             m_WriterStep);
     size_t LocalSize = MetaBuffer.size();
     std::vector<size_t> RecvCounts = m_Comm.GatherValues(LocalSize, 0);
 
@@ -289,9 +626,13 @@ void BP5Writer::EndStep()
     }
     m_Comm.GathervArrays(MetaBuffer.data(), LocalSize, RecvCounts.data(),
                          RecvCounts.size(), RecvBuffer->data(), 0);
+    profiling::Tracer::End(profiling::TraceEvent::BP5WriterAggregate,
+                           m_WriterStep);
 
     if (m_Comm.Rank() == 0)
     {
+        profiling::ScopedTrace trace(
+            profiling::TraceEvent::BP5WriterWriteMetadata, m_WriterStep);
         std::vector<format::BP5Base::MetaMetaInfoBlock> UniqueMetaMetaBlocks;
         std::vector<uint64_t> DataSizes;
         std::vector<BufferV::iovec> AttributeBlocks;
@@ -317,14 +658,54 @@ void BP5Writer::Init()
         m_Parameters.NumAggregators = static_cast<unsigned int>(m_Comm.Size());
     }
     // in BP5, aggregation is "always on", but processes may be alone, so
-    // m_Aggregator.m_IsActive is always true
-    // m_Aggregator.m_Comm.Rank() will always succeed (not abort)
-    // m_Aggregator.m_SubFileIndex is always set
-    m_Aggregator.Init(m_Parameters.NumAggregators, m_Comm);
+    // m_Aggregator->m_IsActive is always true
+    // m_Aggregator->m_Comm.Rank() will always succeed (not abort)
+    // m_Aggregator->m_SubFileIndex is always set
+    if (m_Parameters.AggregationType == (int)AggregationType::TwoLevelShm)
+    {
+        m_Aggregator = &m_AggregatorTwoLevelShm;
+    }
+    else
+    {
+        m_Aggregator = &m_AggregatorEveryoneWrites;
+    }
+    m_Aggregator->Init(m_Parameters.NumAggregators, m_Comm);
     InitTransports();
     InitBPBuffer();
+    if (m_Parameters.AsyncWrite)
+    {
+        m_AsyncWriteThread = std::thread(&BP5Writer::AsyncWriteThread, this);
+    }
+}
+
+BP5Writer::~BP5Writer()
+{
+    // only without Close, the thread may write to files that are not closed
+    AsyncWriteStop();
 }
 
+#define declare_type(T)                                                        \
+    void BP5Writer::DoPut(Variable<T> &variable,                               \
+                          typename Variable<T>::Span &span,                    \
+                          const size_t bufferID, const T &value)               \
+    {                                                                          \
+        PERFSTUBS_SCOPED_TIMER("BP5Writer::Put");                              \
+        PutCommon(variable, span, bufferID, value);                            \
+    }
+
+ADIOS2_FOREACH_PRIMITIVE_STDTYPE_1ARG(declare_type)
+#undef declare_type
+
+#define declare_type(T, L)                                                     \
+    T *BP5Writer::DoBufferData_##L(const size_t payloadPosition,               \
+                                   const size_t bufferID) noexcept             \
+    {                                                                          \
+        return BufferDataCommon<T>(payloadPosition, bufferID);                 \
+    }
+
+ADIOS2_FOREACH_PRIMITVE_STDTYPE_2ARGS(declare_type)
+#undef declare_type
+
 #define declare_type(T)                                                        \
     void BP5Writer::DoPutSync(Variable<T> &variable, const T *data)            \
     {                                                                          \
@@ -341,8 +722,52 @@ ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
 void BP5Writer::InitParameters()
 {
     ParseParams(m_IO, m_Parameters);
+    if (m_Parameters.Trace)
+    {
+        profiling::Tracer::Enable();
+        m_TraceStart = profiling::Tracer::Now();
+    }
+    if (m_Parameters.AsyncWrite &&
+        m_Parameters.AggregationType == (int)AggregationType::TwoLevelShm)
+    {
+        throw std::invalid_argument(
+            "ERROR: AsyncWrite is not supported with "
+            "AggregationType=TwoLevelShm, the aggregator writes shared memory "
+            "that is synchronized collectively" +
+            m_EndMessage);
+    }
+    if (m_Parameters.AsyncWrite && m_Parameters.AsyncWriteBufferedSteps == 0)
+    {
+        throw std::invalid_argument(
+            "ERROR: AsyncWriteBufferedSteps must be at least 1 when "
+            "AsyncWrite is on" +
+            m_EndMessage);
+    }
+    if (m_Parameters.StatsBlockSize == 0)
+    {
+        throw std::invalid_argument(
+            "ERROR: StatsBlockSize must be at least 1" + m_EndMessage);
+    }
+    m_BP5Serializer.m_StatsLevel = m_Parameters.StatsLevel;
+    m_BP5Serializer.m_StatsBlockSize = m_Parameters.StatsBlockSize;
+    m_BP5Serializer.m_Threads = m_Parameters.Threads;
+    if (m_BP5Serializer.m_Threads == 0)
+    {
+        const unsigned int hwThreads = std::thread::hardware_concurrency();
+        m_BP5Serializer.m_Threads = (hwThreads == 0) ? 1 : hwThreads;
+        if (m_BP5Serializer.m_Threads > DefaultOperatorThreads)
+        {
+            m_BP5Serializer.m_Threads = DefaultOperatorThreads;
+        }
+    }
+    m_BP5Serializer.m_ThreadPool = &m_IO.m_ADIOS.GetThreadPool();
     m_WriteToBB = !(m_Parameters.BurstBufferPath.empty());
     m_DrainBB = m_WriteToBB && m_Parameters.BurstBufferDrain;
+    if (m_Parameters.BufferVType == (int)BufferVType::ChunkVType)
+    {
+        m_ChunkPool = std::unique_ptr<format::ChunkPool>(
+            new format::ChunkPool(m_Parameters.BufferChunkSize));
+    }
 }
 
 void BP5Writer::InitTransports()
@@ -367,9 +792,9 @@ void BP5Writer::InitTransports()
 
     // /path/name.bp.dir/name.bp.rank
     m_SubStreamNames =
-        GetBPSubStreamNames(transportsNames, m_Aggregator.m_SubStreamIndex);
+        GetBPSubStreamNames(transportsNames, m_Aggregator->m_SubStreamIndex);
 
-    if (m_Aggregator.m_IsAggregator)
+    if (m_Aggregator->m_IsAggregator)
     {
         // Only aggregators will run draining processes
         if (m_DrainBB)
@@ -378,7 +803,7 @@ void BP5Writer::InitTransports()
                 m_FileDataManager.GetFilesBaseNames(
                     m_Name, m_IO.m_TransportsParameters);
             m_DrainSubStreamNames = GetBPSubStreamNames(
-                drainTransportNames, m_Aggregator.m_SubStreamIndex);
+                drainTransportNames, m_Aggregator->m_SubStreamIndex);
             /* start up BB thread */
             //            m_FileDrainer.SetVerbose(
             //				     m_Parameters.BurstBufferVerbose,
@@ -420,11 +845,23 @@ void BP5Writer::InitTransports()
             m_IO.m_TransportsParameters[i]["asynctasks"] = "true";
         }
     }
-    m_FileDataManager.OpenFiles(m_SubStreamNames, m_OpenMode,
-                                m_IO.m_TransportsParameters, false,
-                                m_Aggregator.m_Comm);
+    if (m_Parameters.AggregationType == (int)AggregationType::TwoLevelShm)
+    {
+        // only aggregators write data
+        if (m_Aggregator->m_IsAggregator)
+        {
+            m_FileDataManager.OpenFiles(m_SubStreamNames, m_OpenMode,
+                                        m_IO.m_TransportsParameters, false);
+        }
+    }
+    else
+    {
+        m_FileDataManager.OpenFiles(m_SubStreamNames, m_OpenMode,
+                                    m_IO.m_TransportsParameters, false,
+                                    m_Aggregator->m_Comm);
+    }
 
-    if (m_Aggregator.m_IsAggregator)
+    if (m_Aggregator->m_IsAggregator)
     {
         if (m_DrainBB)
         {
@@ -598,7 +1035,7 @@ void BP5Writer::InitBPBuffer()
      * them yet so that Open() can stay free of writing to disk)
      */
 
-    const uint64_t a = static_cast<uint64_t>(m_Aggregator.m_SubStreamIndex);
+    const uint64_t a = static_cast<uint64_t>(m_Aggregator->m_SubStreamIndex);
     std::vector<uint64_t> Assignment = m_Comm.GatherValues(a, 0);
 
     if (m_Comm.Rank() == 0)
@@ -617,7 +1054,7 @@ void BP5Writer::InitBPBuffer()
                                               sizeof(Assignment[0]) *
                                                   Assignment.size());
     }
-    if (m_Aggregator.m_IsAggregator)
+    if (m_Aggregator->m_IsAggregator)
     {
         format::BufferSTL d;
         MakeHeader(d, "Data", false);
@@ -631,8 +1068,21 @@ void BP5Writer::InitBPBuffer()
     }
 }
 
+void BP5Writer::UpdateActiveFlag(const bool active)
+{
+    const char activeChar = (active ? '\1' : '\0');
+    m_FileMetadataIndexManager.WriteFileAt(&activeChar, 1,
+                                           m_ActiveFlagPosition);
+    m_FileMetadataIndexManager.FlushFiles();
+    m_FileMetadataIndexManager.SeekToFileEnd();
+}
+
 void BP5Writer::DoFlush(const bool isFinal, const int transportIndex)
 {
+    if (m_Parameters.AsyncWrite)
+    {
+        AsyncWriteDrain();
+    }
     m_FileMetadataManager.FlushFiles();
     m_FileMetaMetadataManager.FlushFiles();
     m_FileDataManager.FlushFiles();
@@ -642,7 +1092,7 @@ void BP5Writer::DoFlush(const bool isFinal, const int transportIndex)
     //    {
     //        WriteCollectiveMetadataFile();
     //    }
-    //    if (m_BP4Serializer.m_Aggregator.m_IsActive)
+    //    if (m_BP4Serializer.m_Aggregator->m_IsActive)
     //    {
     //        AggregateWriteData(isFinal, transportIndex);
     //    }
@@ -655,15 +1105,50 @@ void BP5Writer::DoFlush(const bool isFinal, const int transportIndex)
 void BP5Writer::DoClose(const int transportIndex)
 {
     PERFSTUBS_SCOPED_TIMER("BP5Writer::Close");
+    if (m_BetweenStepPairs)
+    {
+        EndStep();
+    }
     PerformPuts();
 
     DoFlush(true, transportIndex);
 
+    if (m_Parameters.AsyncWrite)
+    {
+        AsyncWriteStop();
+        if (m_Parameters.verbose > 0)
+        {
+            std::cout << "BP5Writer rank " << m_Comm.Rank()
+                      << ": EndStep waited " << m_AsyncWriteBlockedSecs
+                      << " seconds in " << m_AsyncWriteBlockedSteps << " of "
+                      << m_WriterStep + 1
+                      << " steps for a free AsyncWrite buffer" << std::endl;
+        }
+    }
+
+    if (m_Parameters.AggregationType == (int)AggregationType::TwoLevelShm)
+    {
+        const uint64_t shmBytes = m_Comm.ReduceValues(m_ShmBytes);
+        const uint64_t writtenBytes = m_Comm.ReduceValues(m_AggregatorBytes);
+        if (m_Parameters.verbose > 0 && m_Comm.Rank() == 0)
+        {
+            std::cout << "BP5Writer TwoLevelShm aggregation: " << shmBytes
+                      << " bytes passed through shared memory, "
+                      << writtenBytes << " bytes written by "
+                      << m_Aggregator->m_SubStreams << " aggregators"
+                      << std::endl;
+        }
+    }
+    m_Aggregator->Close();
+
     m_FileDataManager.CloseFiles(transportIndex);
     // Delete files from temporary storage if draining was on
 
     if (m_Comm.Rank() == 0)
     {
+        // let streaming readers know that no more steps are coming
+        UpdateActiveFlag(false);
+
         // close metadata file
         m_FileMetadataManager.CloseFiles();
 
@@ -673,6 +1158,28 @@ void BP5Writer::DoClose(const int transportIndex)
         // close metadata index file
         m_FileMetadataIndexManager.CloseFiles();
     }
+
+    if (m_Parameters.Trace)
+    {
+        WriteTraceJSONFile();
+    }
+}
+
+void BP5Writer::WriteTraceJSONFile()
+{
+    PERFSTUBS_SCOPED_TIMER("BP5Writer::WriteTraceJSONFile");
+    const std::vector<char> traceJSON(
+        profiling::Tracer::AggregateChromeTraceJSON(m_Comm, m_TraceStart));
+
+    if (m_Comm.Rank() == 0)
+    {
+        transport::FileFStream traceJSONStream(m_Comm);
+        traceJSONStream.Open(helper::RemoveTrailingSlash(m_BBName) +
+                                 "/trace.json",
+                             Mode::Write);
+        traceJSONStream.Write(traceJSON.data(), traceJSON.size());
+        traceJSONStream.Close();
+    }
 }
 
 /*write the content of metadata index file*/
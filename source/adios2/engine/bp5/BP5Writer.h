@@ -14,11 +14,21 @@
 #include "adios2/engine/bp5/BP5Engine.h"
 #include "adios2/helper/adiosComm.h"
 #include "adios2/toolkit/aggregator/mpi/MPIChain.h"
+#include "adios2/toolkit/aggregator/mpi/MPIShmChain.h"
 #include "adios2/toolkit/burstbuffer/FileDrainerSingleThread.h"
 #include "adios2/toolkit/format/bp5/BP5Serializer.h"
 #include "adios2/toolkit/format/buffer/BufferV.h"
+#include "adios2/toolkit/format/buffer/chunk/ChunkV.h"
+#include "adios2/toolkit/profiling/tracing/Tracer.h"
 #include "adios2/toolkit/transportman/TransportMan.h"
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <set>
+#include <thread>
+
 namespace adios2
 {
 namespace core
@@ -39,7 +49,7 @@ public:
     BP5Writer(IO &io, const std::string &name, const Mode mode,
               helper::Comm comm);
 
-    ~BP5Writer() = default;
+    ~BP5Writer();
 
     StepStatus BeginStep(StepMode mode,
                          const float timeoutSeconds = -1.0) final;
@@ -48,6 +58,10 @@ public:
     void EndStep() final;
 
 private:
+    /** Chunks recycled across steps when BufferVType=chunk, declared before
+     * m_BP5Serializer that may still hold chunks of an unfinished step */
+    std::unique_ptr<format::ChunkPool> m_ChunkPool;
+
     /** Single object controlling BP buffering */
     format::BP5Serializer m_BP5Serializer;
 
@@ -63,6 +77,40 @@ private:
     transportman::TransportMan m_FileMetaMetadataManager;
 
     int64_t m_WriterStep = -1;
+    /** true between BeginStep and EndStep */
+    bool m_BetweenStepPairs = false;
+
+    /** Threads=0 operates blocks on up to this many threads, fewer on
+     * smaller hosts, several writers usually share a node */
+    static constexpr unsigned int DefaultOperatorThreads = 4;
+
+    /*
+     *  Write-behind (AsyncWrite) variables
+     */
+    /** Data of one step waiting to be written by the write thread */
+    struct AsyncWriteTask
+    {
+        format::BufferV *Data;
+        uint64_t StartPos;
+        size_t Step;
+    };
+    /** Writes m_AsyncWriteQueue in order, owns m_FileDataManager while
+     * running */
+    std::thread m_AsyncWriteThread;
+    std::mutex m_AsyncWriteMutex;
+    /** signaled when a task is queued or the thread must finish */
+    std::condition_variable m_AsyncWriteQueued;
+    /** signaled when a task is written */
+    std::condition_variable m_AsyncWriteDone;
+    std::deque<AsyncWriteTask> m_AsyncWriteQueue;
+    /** number of tasks queued or being written */
+    size_t m_AsyncWritePending = 0;
+    bool m_AsyncWriteFinish = false;
+    /** first exception thrown in the write thread, rethrown by EndStep */
+    std::exception_ptr m_AsyncWriteError;
+    /** time EndStep spent waiting for a free buffered step */
+    double m_AsyncWriteBlockedSecs = 0.0;
+    size_t m_AsyncWriteBlockedSteps = 0;
     /*
      *  Burst buffer variables
      */
@@ -98,6 +146,15 @@ private:
     void InitTransports() final;
     /** Allocates memory and starts a PG group */
     void InitBPBuffer();
+    /** Creates the BufferV receiving the data of a new step */
+    format::BufferV *NewDataBuffer();
+
+#define declare_type(T)                                                        \
+    void DoPut(Variable<T> &variable, typename Variable<T>::Span &span,        \
+               const size_t bufferID, const T &value) final;
+
+    ADIOS2_FOREACH_PRIMITIVE_STDTYPE_1ARG(declare_type)
+#undef declare_type
 
 #define declare_type(T)                                                        \
     void DoPutSync(Variable<T> &, const T *) final;                            \
@@ -106,8 +163,17 @@ private:
     ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
 #undef declare_type
 
+    /** @param span if not NULL, data is ignored and the block's space in the
+     * step's data buffer is returned for a Span Put */
     template <class T>
-    void PutCommon(Variable<T> &variable, const T *data, bool sync);
+    void PutCommon(Variable<T> &variable, const T *data, bool sync,
+                   format::BufferV::BufferPos *span = NULL);
+
+    /** the span points into the step's data buffer, filled with value if
+     * not T{}, the application produces the block in place until EndStep */
+    template <class T>
+    void PutCommon(Variable<T> &variable, typename Variable<T>::Span &span,
+                   const size_t bufferID, const T &value);
 
     void DoFlush(const bool isFinal = false, const int transportIndex = -1);
 
@@ -117,6 +183,12 @@ private:
      * profilers*/
     void WriteProfilingJSONFile();
 
+    /** profiling::Tracer time at Open, events before it are not exported */
+    uint64_t m_TraceStart = 0;
+
+    /** Write the Tracer events of all ranks as trace.json */
+    void WriteTraceJSONFile();
+
     void WriteMetaMetadata(
         const std::vector<format::BP5Base::MetaMetaInfoBlock> MetaMetaBlocks);
 
@@ -126,8 +198,29 @@ private:
     WriteMetadata(const std::vector<format::BufferV::iovec> MetaDataBlocks,
                   const std::vector<format::BufferV::iovec> AttributeBlocks);
 
-    /** Write Data to disk, in an aggregator chain */
+    /** Write Data to disk, in an aggregator chain. With AsyncWrite only the
+     * file position is determined here, the write thread writes Data later
+     * and takes ownership of it */
     void WriteData(format::BufferV *Data);
+    void WriteData_EveryoneWrites(format::BufferV *Data);
+    /** Non-aggregators copy Data into their shared memory segment in rounds
+     * of up to MaxShmSize bytes, the aggregator writes its own data and the
+     * segments of its group with one vectored write per round */
+    void WriteData_TwoLevelShm(format::BufferV *Data);
+
+    /** Writes all blocks of Data at StartPos in the data file */
+    void WriteDataVec(format::BufferV *Data, const uint64_t StartPos);
+
+    /** Queues a step for the write thread, blocks while
+     * AsyncWriteBufferedSteps steps are already pending */
+    void AsyncWriteEnqueue(format::BufferV *Data, const uint64_t StartPos);
+    /** Blocks until all queued steps are written */
+    void AsyncWriteDrain();
+    /** Drains the queue and joins the write thread */
+    void AsyncWriteStop();
+    void AsyncWriteThread();
+    /** Rethrows an exception caught in the write thread */
+    void AsyncWriteCheckError();
 
     void PopulateMetadataIndexFileContent(
         format::BufferSTL &buffer, const uint64_t currentStep,
@@ -153,15 +246,36 @@ private:
      */
     void AggregateWriteData(const bool isFinal, const int transportIndex = -1);
 
+#define declare_type(T, L)                                                     \
+    T *DoBufferData_##L(const size_t payloadPosition,                          \
+                        const size_t bufferID = 0) noexcept final;
+
+    ADIOS2_FOREACH_PRIMITVE_STDTYPE_2ARGS(declare_type)
+#undef declare_type
+
     template <class T>
     T *BufferDataCommon(const size_t payloadOffset,
                         const size_t bufferID) noexcept;
 
+    /** variables with Span puts in the current step */
+    std::set<std::string> m_SpanVariables;
+
+    /** drops the spans of the step, their data was marshaled at EndStep */
+    void ReleaseSpans();
+
     template <class T>
     void PerformPutCommon(Variable<T> &variable);
 
-    /** manages all communication tasks in aggregation */
-    aggregator::MPIChain m_Aggregator;
+    /** manages all communication tasks in aggregation, points to one of
+     * the aggregators below depending on AggregationType */
+    aggregator::MPIAggregator *m_Aggregator = nullptr;
+    aggregator::MPIChain m_AggregatorEveryoneWrites;
+    aggregator::MPIShmChain m_AggregatorTwoLevelShm;
+
+    /** TwoLevelShm: bytes this process passed through shared memory */
+    uint64_t m_ShmBytes = 0;
+    /** TwoLevelShm: bytes this aggregator wrote for its group */
+    uint64_t m_AggregatorBytes = 0;
 
 private:
     // updated during WriteMetaData
@@ -12,6 +12,8 @@
 
 #include "BP5Writer.h"
 
+#include <algorithm>
+
 namespace adios2
 {
 namespace core
@@ -20,10 +22,18 @@ namespace engine
 {
 
 template <class T>
-void BP5Writer::PutCommon(Variable<T> &variable, const T *values, bool sync)
+void BP5Writer::PutCommon(Variable<T> &variable, const T *values, bool sync,
+                          format::BufferV::BufferPos *span)
 {
+    if (!m_BetweenStepPairs)
+    {
+        BeginStep(StepMode::Update);
+    }
     variable.SetData(values);
 
+    // with AsyncWrite, data is written after EndStep returned and the
+    // application may have reused its arrays, so deferred puts are copied
+
     size_t *Shape = NULL;
     size_t *Start = NULL;
     size_t *Count = NULL;
@@ -43,7 +53,51 @@ void BP5Writer::PutCommon(Variable<T> &variable, const T *values, bool sync)
     }
     m_BP5Serializer.Marshal((void *)&variable, variable.m_Name.c_str(),
                             variable.m_Type, variable.m_ElementSize, DimCount,
-                            Shape, Count, Start, values, sync);
+                            Shape, Count, Start, values,
+                            sync || m_Parameters.AsyncWrite, span);
+}
+
+template <class T>
+void BP5Writer::PutCommon(Variable<T> &variable,
+                          typename Variable<T>::Span &span,
+                          const size_t /*bufferID*/, const T &value)
+{
+    if (variable.m_ShapeID != ShapeID::GlobalArray &&
+        variable.m_ShapeID != ShapeID::LocalArray)
+    {
+        throw std::invalid_argument(
+            "ERROR: returning a Span is only supported for arrays in BP5, "
+            "variable " +
+            variable.m_Name + ", in call to Put\n");
+    }
+
+    format::BufferV::BufferPos pos;
+    PutCommon(variable, static_cast<const T *>(nullptr), false, &pos);
+    // the next span of the step is keyed by m_BlocksInfo.size()
+    variable.SetBlockInfo(nullptr, CurrentStep());
+    m_SpanVariables.insert(variable.m_Name);
+    span.m_BufferIdx = pos.bufferIdx;
+    span.m_PayloadPosition = pos.posInBuffer;
+    span.m_Value = value;
+    if (value != T{})
+    {
+        std::fill_n(span.Data(), span.Size(), value);
+    }
+}
+
+template <class T>
+T *BP5Writer::BufferDataCommon(const size_t payloadPosition,
+                               const size_t bufferID) noexcept
+{
+    return reinterpret_cast<T *>(
+        m_BP5Serializer.GetPtr(bufferID, payloadPosition));
+}
+
+template <class T>
+void BP5Writer::PerformPutCommon(Variable<T> &variable)
+{
+    variable.m_BlocksInfo.clear();
+    variable.m_BlocksSpan.clear();
 }
 
 } // end namespace engine
@@ -69,6 +69,12 @@ DataManReader::DataManReader(IO &io, const std::string &name,
     nlohmann::json message = nlohmann::json::parse(reply->data());
     m_TransportMode = message["Transport"];
 
+    auto methodIt = message.find("SerializationMethod");
+    if (methodIt != message.end())
+    {
+        m_Serializer.SetSerializationMethod(methodIt->get<std::string>());
+    }
+
     if (m_MonitorActive)
     {
         m_Monitor.SetClockError(roundLatency, message["TimeStamp"]);
@@ -44,10 +44,18 @@ DataManWriter::DataManWriter(IO &io, const std::string &name,
     helper::GetParameter(m_IO.m_Parameters, "Monitor", m_MonitorActive);
     helper::GetParameter(m_IO.m_Parameters, "CombiningSteps", m_CombiningSteps);
     helper::GetParameter(m_IO.m_Parameters, "FloatAccuracy", m_FloatAccuracy);
+    helper::GetParameter(m_IO.m_Parameters, "SerializationMethod",
+                         m_SerializationMethod);
+    helper::GetParameter(m_IO.m_Parameters, "FullMetadataInterval",
+                         m_FullMetadataInterval);
+
+    m_Serializer.SetSerializationMethod(m_SerializationMethod);
+    m_Serializer.SetFullMetadataInterval(m_FullMetadataInterval);
 
     m_HandshakeJson["Threading"] = m_Threading;
     m_HandshakeJson["Transport"] = m_TransportMode;
     m_HandshakeJson["FloatAccuracy"] = m_FloatAccuracy;
+    m_HandshakeJson["SerializationMethod"] = m_SerializationMethod;
 
     if (m_IPAddress.empty())
     {
@@ -52,6 +52,8 @@ private:
     int m_CombiningSteps = 1;
     int m_CombinedSteps = 0;
     std::string m_FloatAccuracy;
+    std::string m_SerializationMethod = "string";
+    size_t m_FullMetadataInterval = 0;
 
     int m_MpiRank;
     int m_MpiSize;
@@ -12,7 +12,9 @@
 #include "adios2/common/ADIOSMacros.h"
 #include "adios2/helper/adiosFunctions.h"
 #include "adios2/helper/adiosType.h"
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <numeric>
 
 namespace adios2
@@ -68,6 +70,19 @@ size_t TotalDataSize(const BlockVec &bv)
     return s;
 }
 
+bool HasOverlap(const BlockInfo &a, const BlockInfo &b)
+{
+    for (size_t i = 0; i < a.start.size(); ++i)
+    {
+        if (a.start[i] + a.count[i] <= b.start[i] ||
+            b.start[i] + b.count[i] <= a.start[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 RankPosMap CalculateOverlap(BlockVecVec &globalVecVec, const BlockVec &localVec)
 {
     RankPosMap ret;
@@ -86,19 +101,7 @@ RankPosMap CalculateOverlap(BlockVecVec &globalVecVec, const BlockVec &localVec)
                     }
                     else if (gBlock.shapeId == ShapeID::GlobalArray)
                     {
-                        bool hasOverlap = true;
-                        for (size_t i = 0; i < gBlock.start.size(); ++i)
-                        {
-                            if (gBlock.start[i] + gBlock.count[i] <=
-                                    lBlock.start[i] ||
-                                lBlock.start[i] + lBlock.count[i] <=
-                                    gBlock.start[i])
-                            {
-                                hasOverlap = false;
-                                break;
-                            }
-                        }
-                        if (hasOverlap)
+                        if (HasOverlap(gBlock, lBlock))
                         {
                             ret[rank].first = 0;
                         }
@@ -117,6 +120,125 @@ RankPosMap CalculateOverlap(BlockVecVec &globalVecVec, const BlockVec &localVec)
     return ret;
 }
 
+RangeVec CalculateOverlapRanges(const BlockVec &writerPattern,
+                                const BlockVec &readerPattern,
+                                const size_t bufferOffset)
+{
+    // the first byte of every writer buffer carries the end of stream flag
+    RangeVec ranges = {{0, 1}};
+    for (const auto &wBlock : writerPattern)
+    {
+        bool needed = false;
+        if (wBlock.shapeId == ShapeID::GlobalValue ||
+            wBlock.shapeId == ShapeID::LocalValue)
+        {
+            // the reader updates all values in BeginStep whether it gets them
+            // or not
+            needed = true;
+        }
+        else
+        {
+            for (const auto &rBlock : readerPattern)
+            {
+                if (rBlock.name == wBlock.name &&
+                    (wBlock.shapeId == ShapeID::LocalArray ||
+                     HasOverlap(wBlock, rBlock)))
+                {
+                    needed = true;
+                    break;
+                }
+            }
+        }
+        if (needed && wBlock.bufferCount > 0)
+        {
+            ranges.emplace_back(wBlock.bufferStart - bufferOffset,
+                                wBlock.bufferCount);
+        }
+    }
+
+    std::sort(ranges.begin(), ranges.end());
+    RangeVec merged;
+    for (const auto &r : ranges)
+    {
+        if (!merged.empty() &&
+            merged.back().first + merged.back().second >= r.first)
+        {
+            merged.back().second =
+                std::max(merged.back().first + merged.back().second,
+                         r.first + r.second) -
+                merged.back().first;
+        }
+        else
+        {
+            merged.push_back(r);
+        }
+    }
+    return merged;
+}
+
+size_t TotalDataSize(const RangeVec &ranges)
+{
+    size_t s = 0;
+    for (const auto &r : ranges)
+    {
+        s += r.second;
+    }
+    return s;
+}
+
+MPI_Datatype CreateRangeDatatype(const RangeVec &ranges)
+{
+    const size_t maxBlock = std::numeric_limits<int>::max();
+    std::vector<int> blockLengths;
+    std::vector<MPI_Aint> displacements;
+    for (const auto &r : ranges)
+    {
+        for (size_t done = 0; done < r.second; done += maxBlock)
+        {
+            blockLengths.push_back(
+                static_cast<int>(std::min(maxBlock, r.second - done)));
+            displacements.push_back(static_cast<MPI_Aint>(r.first + done));
+        }
+    }
+    MPI_Datatype datatype;
+    MPI_Type_create_hindexed(static_cast<int>(blockLengths.size()),
+                             blockLengths.data(), displacements.data(),
+                             MPI_CHAR, &datatype);
+    MPI_Type_commit(&datatype);
+    return datatype;
+}
+
+void FreeDatatypes(RankDatatypeMap &datatypes)
+{
+    for (auto &d : datatypes)
+    {
+        MPI_Type_free(&d.second);
+    }
+    datatypes.clear();
+}
+
+bool GrowWindowSizes(const BlockVecVec &globalPattern,
+                     std::vector<size_t> &windowSizes)
+{
+    bool grown = false;
+    windowSizes.resize(globalPattern.size(), 0);
+    for (size_t rank = 0; rank < globalPattern.size(); ++rank)
+    {
+        if (globalPattern[rank].empty())
+        {
+            continue;
+        }
+        // one extra byte for the end of stream flag
+        const size_t required = TotalDataSize(globalPattern[rank]) + 1;
+        if (required > windowSizes[rank])
+        {
+            windowSizes[rank] = required * 2;
+            grown = true;
+        }
+    }
+    return grown;
+}
+
 void SerializeVariables(const BlockVec &input, Buffer &output, const int rank)
 {
     for (const auto &b : input)
@@ -48,6 +48,19 @@ public:
         m_Capacity = 1;
         m_Size = 0;
     }
+    void reserve(const size_t capacity)
+    {
+        if (capacity > m_Capacity)
+        {
+            m_Capacity = capacity;
+            m_Buffer =
+                reinterpret_cast<uint8_t *>(realloc(m_Buffer, m_Capacity));
+        }
+        if (m_Buffer == nullptr)
+        {
+            throw("ssc buffer realloc failed");
+        }
+    }
     void resize(const size_t size)
     {
         m_Size = size;
@@ -128,6 +141,8 @@ struct BlockInfo
 using BlockVec = std::vector<BlockInfo>;
 using BlockVecVec = std::vector<BlockVec>;
 using RankPosMap = std::unordered_map<int, std::pair<size_t, size_t>>;
+using RankDatatypeMap = std::unordered_map<int, MPI_Datatype>;
+using RangeVec = std::vector<std::pair<size_t, size_t>>;
 using MpiInfo = std::vector<std::vector<int>>;
 
 void PrintDims(const Dims &dims, const std::string &label = std::string());
@@ -148,6 +163,23 @@ size_t TotalDataSize(const BlockVec &bv);
 RankPosMap CalculateOverlap(BlockVecVec &globalPattern,
                             const BlockVec &localPattern);
 
+// {start, count} byte ranges of one writer rank's buffer that one reader rank
+// needs, merged and sorted. bufferOffset is subtracted from the bufferStart of
+// the writer blocks, which the reader shifts by its receive position.
+RangeVec CalculateOverlapRanges(const BlockVec &writerPattern,
+                                const BlockVec &readerPattern,
+                                const size_t bufferOffset = 0);
+size_t TotalDataSize(const RangeVec &ranges);
+MPI_Datatype CreateRangeDatatype(const RangeVec &ranges);
+void FreeDatatypes(RankDatatypeMap &datatypes);
+
+// Bytes each stream rank exposes through the flexible mode RMA window. Every
+// rank derives them from the same global write pattern, so all of them agree
+// on when the window has to be recreated without any extra communication.
+// Returns true and grows windowSizes if some writer buffer no longer fits.
+bool GrowWindowSizes(const BlockVecVec &globalPattern,
+                     std::vector<size_t> &windowSizes);
+
 void SerializeVariables(const BlockVec &input, Buffer &output, const int rank);
 void SerializeAttributes(IO &input, Buffer &output);
 void Deserialize(const Buffer &input, BlockVecVec &output, IO &io,
@@ -173,6 +205,7 @@ void MPI_Gatherv64(const void *sendbuf, uint64_t sendcount,
                    const int chunksize = std::numeric_limits<int>::max());
 
 bool AreSameDims(const Dims &a, const Dims &b);
+bool HasOverlap(const BlockInfo &a, const BlockInfo &b);
 
 } // end namespace ssc
 } // end namespace engine
@@ -13,6 +13,7 @@
 #include "adios2/helper/adiosCommMPI.h"
 #include "adios2/helper/adiosFunctions.h"
 #include "adios2/helper/adiosMpiHandshake.h"
+#include <chrono>
 
 namespace adios2
 {
@@ -59,7 +60,36 @@ void SscReader::BeginStepFlexible(StepStatus &status)
         status = StepStatus::EndOfStream;
         return;
     }
-    MPI_Win_create(NULL, 0, 1, MPI_INFO_NULL, m_StreamComm, &m_MpiWin);
+    SetupWindow();
+}
+
+void SscReader::SetupWindow()
+{
+    PERFSTUBS_SCOPED_TIMER_FUNC();
+    auto start = std::chrono::steady_clock::now();
+
+    const bool grown =
+        ssc::GrowWindowSizes(m_GlobalWritePattern, m_WindowSizes);
+    if (grown)
+    {
+        if (m_MpiWin != MPI_WIN_NULL)
+        {
+            MPI_Win_free(&m_MpiWin);
+        }
+        MPI_Win_create(NULL, 0, 1, MPI_INFO_NULL, m_StreamComm, &m_MpiWin);
+    }
+
+    if (m_Verbosity >= 5)
+    {
+        std::cout << "SscReader::SetupWindow, World Rank " << m_StreamRank
+                  << ", Reader Rank " << m_ReaderRank << ", Step "
+                  << m_CurrentStep << ", "
+                  << (grown ? "created window in " : "reused window in ")
+                  << std::chrono::duration_cast<std::chrono::microseconds>(
+                         std::chrono::steady_clock::now() - start)
+                         .count()
+                  << " us" << std::endl;
+    }
 }
 
 StepStatus SscReader::BeginStep(const StepMode stepMode,
@@ -168,12 +198,20 @@ void SscReader::PerformGets()
     {
         ssc::Deserialize(m_GlobalWritePatternBuffer, m_GlobalWritePattern, m_IO,
                          false, false);
-        size_t oldSize = m_AllReceivingWriterRanks.size();
         m_AllReceivingWriterRanks =
             ssc::CalculateOverlap(m_GlobalWritePattern, m_LocalReadPattern);
         CalculatePosition(m_GlobalWritePattern, m_AllReceivingWriterRanks);
-        size_t newSize = m_AllReceivingWriterRanks.size();
-        if (oldSize != newSize)
+
+        ssc::BlockVec pendingReadPattern;
+        for (const auto &br : m_LocalReadPattern)
+        {
+            if (!br.performed)
+            {
+                pendingReadPattern.push_back(br);
+            }
+        }
+
+        if (!pendingReadPattern.empty() && !m_AllReceivingWriterRanks.empty())
         {
             size_t totalDataSize = 0;
             for (auto i : m_AllReceivingWriterRanks)
@@ -181,14 +219,22 @@ void SscReader::PerformGets()
                 totalDataSize += i.second.second;
             }
             m_Buffer.resize(totalDataSize);
+
+            // fetch only the parts of each writer buffer that the pending
+            // selections touch, at the offsets they have in the whole buffer
+            ssc::RankDatatypeMap getTypes;
+            MPI_Win_lock_all(0, m_MpiWin);
             for (const auto &i : m_AllReceivingWriterRanks)
             {
-                MPI_Win_lock(MPI_LOCK_SHARED, i.first, 0, m_MpiWin);
-                MPI_Get(m_Buffer.data() + i.second.first,
-                        static_cast<int>(i.second.second), MPI_CHAR, i.first, 0,
-                        static_cast<int>(i.second.second), MPI_CHAR, m_MpiWin);
-                MPI_Win_unlock(i.first, m_MpiWin);
+                MPI_Datatype &type = getTypes[i.first];
+                type = ssc::CreateRangeDatatype(ssc::CalculateOverlapRanges(
+                    m_GlobalWritePattern[i.first], pendingReadPattern,
+                    i.second.first));
+                MPI_Get(m_Buffer.data() + i.second.first, 1, type, i.first, 0,
+                        1, type, m_MpiWin);
             }
+            MPI_Win_unlock_all(m_MpiWin);
+            ssc::FreeDatatypes(getTypes);
         }
 
         for (auto &br : m_LocalReadPattern)
@@ -256,28 +302,41 @@ void SscReader::EndStepFixed()
 {
     if (m_CurrentStep == 0)
     {
-        MPI_Win_free(&m_MpiWin);
+        MPI_Barrier(m_StreamComm);
         SyncReadPattern();
+        if (m_MpiWin != MPI_WIN_NULL)
+        {
+            MPI_Win_free(&m_MpiWin);
+        }
+        // writers only send the parts of their buffers this rank reads, at
+        // the offsets they would have had in the whole buffer
+        for (const auto &i : m_AllReceivingWriterRanks)
+        {
+            m_MpiRecvTypes[i.first] = ssc::CreateRangeDatatype(
+                ssc::CalculateOverlapRanges(m_GlobalWritePattern[i.first],
+                                            m_LocalReadPattern,
+                                            i.second.first));
+        }
     }
     for (const auto &i : m_AllReceivingWriterRanks)
     {
         m_MpiRequests.emplace_back();
-        MPI_Irecv(m_Buffer.data() + i.second.first,
-                  static_cast<int>(i.second.second), MPI_CHAR, i.first, 0,
-                  m_StreamComm, &m_MpiRequests.back());
+        MPI_Irecv(m_Buffer.data() + i.second.first, 1,
+                  m_MpiRecvTypes[i.first], i.first, 0, m_StreamComm,
+                  &m_MpiRequests.back());
     }
 }
 
 void SscReader::EndStepFirstFlexible()
 {
-    MPI_Win_free(&m_MpiWin);
+    MPI_Barrier(m_StreamComm);
     SyncReadPattern();
     BeginStepFlexible(m_StepStatus);
 }
 
 void SscReader::EndStepConsequentFlexible()
 {
-    MPI_Win_free(&m_MpiWin);
+    MPI_Barrier(m_StreamComm);
     BeginStepFlexible(m_StepStatus);
 }
 
@@ -309,7 +368,7 @@ void SscReader::EndStep()
             }
             else
             {
-                MPI_Win_free(&m_MpiWin);
+                MPI_Barrier(m_StreamComm);
                 SyncReadPattern();
             }
         }
@@ -322,7 +381,7 @@ void SscReader::EndStep()
             }
             else
             {
-                MPI_Win_free(&m_MpiWin);
+                MPI_Barrier(m_StreamComm);
             }
         }
     }
@@ -508,6 +567,13 @@ void SscReader::DoClose(const int transportIndex)
     {
         BeginStep();
     }
+
+    ssc::FreeDatatypes(m_MpiRecvTypes);
+
+    if (m_MpiWin != MPI_WIN_NULL)
+    {
+        MPI_Win_free(&m_MpiWin);
+    }
 }
 
 } // end namespace engine
@@ -47,8 +47,10 @@ private:
     ssc::Buffer m_GlobalWritePatternBuffer;
 
     ssc::RankPosMap m_AllReceivingWriterRanks;
+    ssc::RankDatatypeMap m_MpiRecvTypes;
     ssc::Buffer m_Buffer;
-    MPI_Win m_MpiWin;
+    MPI_Win m_MpiWin = MPI_WIN_NULL;
+    std::vector<size_t> m_WindowSizes;
     MPI_Group m_WriterGroup;
     MPI_Comm m_StreamComm;
     MPI_Comm m_ReaderComm;
@@ -66,6 +68,7 @@ private:
     void SyncMpiPattern();
     bool SyncWritePattern();
     void SyncReadPattern();
+    void SetupWindow();
     void BeginStepConsequentFixed();
     void BeginStepFlexible(StepStatus &status);
     void EndStepFixed();
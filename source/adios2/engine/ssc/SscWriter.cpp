@@ -12,6 +12,7 @@
 #include "adios2/helper/adiosComm.h"
 #include "adios2/helper/adiosCommMPI.h"
 #include "adios2/helper/adiosString.h"
+#include <chrono>
 
 namespace adios2
 {
@@ -86,7 +87,8 @@ StepStatus SscWriter::BeginStep(StepMode mode, const float timeoutSeconds)
         }
         else
         {
-            MPI_Win_free(&m_MpiWin);
+            // readers are done with the previous step once they pass this
+            MPI_Barrier(m_StreamComm);
         }
     }
 
@@ -102,10 +104,14 @@ void SscWriter::EndStepFirst()
     PERFSTUBS_SCOPED_TIMER_FUNC();
 
     SyncWritePattern();
-    MPI_Win_create(m_Buffer.data(), m_Buffer.size(), 1, MPI_INFO_NULL,
-                   m_StreamComm, &m_MpiWin);
-    MPI_Win_free(&m_MpiWin);
+    SetupWindow();
+    MPI_Barrier(m_StreamComm);
     SyncReadPattern();
+    if (m_WriterDefinitionsLocked && m_ReaderSelectionsLocked &&
+        m_MpiWin != MPI_WIN_NULL)
+    {
+        MPI_Win_free(&m_MpiWin);
+    }
 }
 
 void SscWriter::EndStepConsequentFixed()
@@ -114,8 +120,8 @@ void SscWriter::EndStepConsequentFixed()
     for (const auto &i : m_AllSendingReaderRanks)
     {
         m_MpiRequests.emplace_back();
-        MPI_Isend(m_Buffer.data(), static_cast<int>(m_Buffer.size()), MPI_CHAR,
-                  i.first, 0, m_StreamComm, &m_MpiRequests.back());
+        MPI_Isend(m_Buffer.data(), 1, m_MpiSendTypes[i.first], i.first, 0,
+                  m_StreamComm, &m_MpiRequests.back());
     }
 }
 
@@ -123,8 +129,42 @@ void SscWriter::EndStepConsequentFlexible()
 {
     PERFSTUBS_SCOPED_TIMER_FUNC();
     SyncWritePattern();
-    MPI_Win_create(m_Buffer.data(), m_Buffer.size(), 1, MPI_INFO_NULL,
-                   m_StreamComm, &m_MpiWin);
+    SetupWindow();
+}
+
+void SscWriter::SetupWindow()
+{
+    PERFSTUBS_SCOPED_TIMER_FUNC();
+    auto start = std::chrono::steady_clock::now();
+
+    // the window stays registered across steps and is only recreated when
+    // some writer buffer outgrows what it exposes, which is also the only
+    // case where m_Buffer may have been reallocated
+    const bool grown =
+        ssc::GrowWindowSizes(m_GlobalWritePattern, m_WindowSizes);
+    if (grown)
+    {
+        if (m_MpiWin != MPI_WIN_NULL)
+        {
+            MPI_Win_free(&m_MpiWin);
+        }
+        m_Buffer.reserve(m_WindowSizes[m_StreamRank]);
+        MPI_Win_create(m_Buffer.data(), m_WindowSizes[m_StreamRank], 1,
+                       MPI_INFO_NULL, m_StreamComm, &m_MpiWin);
+    }
+
+    if (m_Verbosity >= 5)
+    {
+        std::cout << "SscWriter::SetupWindow, World Rank " << m_StreamRank
+                  << ", Writer Rank " << m_WriterRank << ", Step "
+                  << m_CurrentStep << ", "
+                  << (grown ? "created window of " : "reused window of ")
+                  << m_WindowSizes[m_StreamRank] << " bytes in "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(
+                         std::chrono::steady_clock::now() - start)
+                         .count()
+                  << " us" << std::endl;
+    }
 }
 
 void SscWriter::EndStep()
@@ -265,6 +305,26 @@ void SscWriter::SyncReadPattern()
     CalculatePosition(m_GlobalWritePattern, m_GlobalReadPattern, m_WriterRank,
                       m_AllSendingReaderRanks);
 
+    if (m_WriterDefinitionsLocked && m_ReaderSelectionsLocked)
+    {
+        ssc::FreeDatatypes(m_MpiSendTypes);
+        for (const auto &i : m_AllSendingReaderRanks)
+        {
+            auto ranges =
+                ssc::CalculateOverlapRanges(m_GlobalWritePattern[m_StreamRank],
+                                            m_GlobalReadPattern[i.first]);
+            m_MpiSendTypes[i.first] = ssc::CreateRangeDatatype(ranges);
+            if (m_Verbosity >= 10)
+            {
+                std::cout << "SscWriter::SyncReadPattern, Writer Rank "
+                          << m_WriterRank << " sends "
+                          << ssc::TotalDataSize(ranges) << " of "
+                          << m_Buffer.size() << " bytes in " << ranges.size()
+                          << " ranges to Stream Rank " << i.first << std::endl;
+            }
+        }
+    }
+
     if (m_Verbosity >= 10)
     {
         for (int i = 0; i < m_WriterSize; ++i)
@@ -367,12 +427,21 @@ void SscWriter::DoClose(const int transportIndex)
         }
         MPI_Waitall(static_cast<int>(requests.size()), requests.data(),
                     MPI_STATUS_IGNORE);
+        ssc::FreeDatatypes(m_MpiSendTypes);
     }
     else
     {
-        MPI_Win_free(&m_MpiWin);
+        if (m_CurrentStep > 0)
+        {
+            MPI_Barrier(m_StreamComm);
+        }
         SyncWritePattern(true);
     }
+
+    if (m_MpiWin != MPI_WIN_NULL)
+    {
+        MPI_Win_free(&m_MpiWin);
+    }
 }
 
 } // end namespace engine
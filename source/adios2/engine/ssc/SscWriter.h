@@ -47,8 +47,10 @@ private:
     ssc::BlockVecVec m_GlobalReadPattern;
 
     ssc::RankPosMap m_AllSendingReaderRanks;
+    ssc::RankDatatypeMap m_MpiSendTypes;
     ssc::Buffer m_Buffer;
-    MPI_Win m_MpiWin;
+    MPI_Win m_MpiWin = MPI_WIN_NULL;
+    std::vector<size_t> m_WindowSizes;
     MPI_Group m_ReaderGroup;
     MPI_Comm m_StreamComm;
     MPI_Comm m_WriterComm;
@@ -65,6 +67,7 @@ private:
     void SyncMpiPattern();
     void SyncWritePattern(bool finalStep = false);
     void SyncReadPattern();
+    void SetupWindow();
     void EndStepFirst();
     void EndStepConsequentFixed();
     void EndStepConsequentFlexible();
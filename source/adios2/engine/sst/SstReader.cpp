@@ -320,11 +320,16 @@ StepStatus SstReader::BeginStep(StepMode Mode, const float timeout_sec)
         m_IO.RemoveAllVariables();
         m_BP5Deserializer->SetupForTimestep(SstCurrentStep(m_Input));
 
-        for (int i = 0; i < m_CurrentStepMetaData->WriterCohortSize; i++)
+        const size_t WriterCount = m_CurrentStepMetaData->WriterCohortSize;
+        std::vector<void *> MetadataBlocks(WriterCount);
+        std::vector<size_t> MetadataSizes(WriterCount);
+        for (size_t i = 0; i < WriterCount; i++)
         {
             struct _SstData *tmp = m_CurrentStepMetaData->WriterMetadata[i];
-            m_BP5Deserializer->InstallMetaData(tmp->block, tmp->DataSize, i);
+            MetadataBlocks[i] = tmp->block;
+            MetadataSizes[i] = tmp->DataSize;
         }
+        m_BP5Deserializer->InstallMetaData(MetadataBlocks, MetadataSizes);
 
         m_IO.ResetVariablesStepSelection(true,
                                          "in call to SST Reader BeginStep");
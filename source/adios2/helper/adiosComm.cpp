@@ -83,6 +83,28 @@ bool Comm::IsMPI() const { return m_Impl->IsMPI(); }
 
 void Comm::Barrier(const std::string &hint) const { m_Impl->Barrier(hint); }
 
+Comm::Win Comm::Win_allocate_shared(size_t size, int disp_unit, void *baseptr,
+                                     const std::string &hint) const
+{
+    return m_Impl->Win_allocate_shared(size, disp_unit, baseptr, hint);
+}
+
+void Comm::Win_shared_query(Win &win, int rank, size_t *size, int *disp_unit,
+                            void *baseptr, const std::string &hint) const
+{
+    m_Impl->Win_shared_query(win, rank, size, disp_unit, baseptr, hint);
+}
+
+void Comm::Win_free(Win &win, const std::string &hint) const
+{
+    m_Impl->Win_free(win, hint);
+}
+
+void Comm::Win_fence(int assert, Win &win, const std::string &hint) const
+{
+    m_Impl->Win_fence(assert, win, hint);
+}
+
 std::string Comm::BroadcastFile(const std::string &fileName,
                                 const std::string hint,
                                 const int rankSource) const
@@ -135,6 +157,18 @@ Comm::Status Comm::Req::Wait(const std::string &hint)
     return status;
 }
 
+Comm::Win::Win() = default;
+
+Comm::Win::Win(std::unique_ptr<CommWinImpl> impl) : m_Impl(std::move(impl)) {}
+
+Comm::Win::~Win() = default;
+
+Comm::Win::Win(Win &&win) = default;
+
+Comm::Win &Comm::Win::operator=(Win &&win) = default;
+
+bool Comm::Win::IsEmpty() const noexcept { return !m_Impl; }
+
 CommImpl::~CommImpl() = default;
 
 size_t CommImpl::SizeOf(Datatype datatype) { return ToSize(datatype); }
@@ -149,9 +183,23 @@ Comm::Req CommImpl::MakeReq(std::unique_ptr<CommReqImpl> impl)
     return Comm::Req(std::move(impl));
 }
 
+Comm::Win CommImpl::MakeWin(std::unique_ptr<CommWinImpl> impl)
+{
+    return Comm::Win(std::move(impl));
+}
+
 CommImpl *CommImpl::Get(Comm const &comm) { return comm.m_Impl.get(); }
 
+CommWinImpl *CommImpl::Get(Comm::Win &win) { return win.m_Impl.get(); }
+
+std::unique_ptr<CommWinImpl> CommImpl::Release(Comm::Win &win)
+{
+    return std::move(win.m_Impl);
+}
+
 CommReqImpl::~CommReqImpl() = default;
 
+CommWinImpl::~CommWinImpl() = default;
+
 } // end namespace helper
 } // end namespace adios2
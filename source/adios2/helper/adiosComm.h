@@ -19,6 +19,7 @@ namespace helper
 
 class CommImpl;
 class CommReqImpl;
+class CommWinImpl;
 
 /** @brief Encapsulation for communication in a multi-process environment.  */
 class Comm
@@ -26,6 +27,7 @@ class Comm
 public:
     class Req;
     class Status;
+    class Win;
 
     /**
      * @brief Enumeration of element-wise accumulation operations.
@@ -254,6 +256,40 @@ public:
     Req Irecv(T *buffer, const size_t count, int source, int tag,
               const std::string &hint = std::string()) const;
 
+    /**
+     * @brief Allocate memory that all processes of the communicator can
+     * access with loads and stores.  The communicator must only cover
+     * processes that can share memory, see GroupByShm.
+     * @param size bytes of the segment contributed by this process
+     * @param disp_unit displacement unit of this process' segment
+     * @param baseptr address of a pointer receiving this process' segment
+     * @param hint Description of std::runtime_error exception on error.
+     */
+    Win Win_allocate_shared(size_t size, int disp_unit, void *baseptr,
+                            const std::string &hint = std::string()) const;
+
+    /**
+     * @brief Query the segment of a process in a window from
+     * Win_allocate_shared.
+     * @param baseptr address of a pointer receiving the segment of rank
+     */
+    void Win_shared_query(Win &win, int rank, size_t *size, int *disp_unit,
+                          void *baseptr,
+                          const std::string &hint = std::string()) const;
+
+    /**
+     * @brief Free a window, collective over the communicator.
+     */
+    void Win_free(Win &win, const std::string &hint = std::string()) const;
+
+    /**
+     * @brief Synchronize all accesses to a window, collective over the
+     * communicator.  Stores before the fence are visible to the loads of
+     * every process after it.
+     */
+    void Win_fence(int assert, Win &win,
+                   const std::string &hint = std::string()) const;
+
 private:
     friend class CommImpl;
 
@@ -316,6 +352,55 @@ private:
     std::unique_ptr<CommReqImpl> m_Impl;
 };
 
+class Comm::Win
+{
+public:
+    /**
+     * @brief Default constructor.  Produces an empty window.
+     *
+     * An empty window may not be used.
+     */
+    Win();
+
+    /**
+     * @brief Move constructor.  Moves window state from that given.
+     *
+     * The moved-from window is left empty and may not be used.
+     */
+    Win(Win &&);
+
+    /**
+     * @brief Deleted copy constructor.  A window may not be copied.
+     */
+    Win(Win const &) = delete;
+
+    ~Win();
+
+    /**
+     * @brief Move assignment.  Moves window state from that given.
+     *
+     * The moved-from window is left empty and may not be used.
+     */
+    Win &operator=(Win &&);
+
+    /**
+     * @brief Deleted copy assignment.  A window may not be copied.
+     */
+    Win &operator=(Win const &) = delete;
+
+    /**
+     * @brief True if the window has not been allocated or was freed.
+     */
+    bool IsEmpty() const noexcept;
+
+private:
+    friend class CommImpl;
+
+    explicit Win(std::unique_ptr<CommWinImpl> impl);
+
+    std::unique_ptr<CommWinImpl> m_Impl;
+};
+
 class Comm::Status
 {
 public:
@@ -437,11 +522,28 @@ public:
                             int source, int tag,
                             const std::string &hint) const = 0;
 
+    virtual Comm::Win Win_allocate_shared(size_t size, int disp_unit,
+                                          void *baseptr,
+                                          const std::string &hint) const = 0;
+
+    virtual void Win_shared_query(Comm::Win &win, int rank, size_t *size,
+                                  int *disp_unit, void *baseptr,
+                                  const std::string &hint) const = 0;
+
+    virtual void Win_free(Comm::Win &win, const std::string &hint) const = 0;
+
+    virtual void Win_fence(int assert, Comm::Win &win,
+                           const std::string &hint) const = 0;
+
     static size_t SizeOf(Datatype datatype);
 
     static Comm MakeComm(std::unique_ptr<CommImpl> impl);
     static Comm::Req MakeReq(std::unique_ptr<CommReqImpl> impl);
+    static Comm::Win MakeWin(std::unique_ptr<CommWinImpl> impl);
     static CommImpl *Get(Comm const &comm);
+    static CommWinImpl *Get(Comm::Win &win);
+    /** Releases the window implementation, leaving win empty */
+    static std::unique_ptr<CommWinImpl> Release(Comm::Win &win);
 };
 
 class CommReqImpl
@@ -451,6 +553,12 @@ public:
     virtual Comm::Status Wait(const std::string &hint) = 0;
 };
 
+class CommWinImpl
+{
+public:
+    virtual ~CommWinImpl() = 0;
+};
+
 } // end namespace helper
 } // end namespace adios2
 
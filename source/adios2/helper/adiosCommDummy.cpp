@@ -9,6 +9,7 @@
 
 #include <cstring>
 #include <iostream>
+#include <vector>
 
 #include "adiosComm.h"
 
@@ -38,6 +39,21 @@ public:
 
 CommReqImplDummy::~CommReqImplDummy() = default;
 
+class CommWinImplDummy : public CommWinImpl
+{
+public:
+    CommWinImplDummy(size_t size, int disp_unit)
+    : m_Segment(size), m_DispUnit(disp_unit)
+    {
+    }
+    ~CommWinImplDummy() override;
+
+    std::vector<char> m_Segment;
+    int m_DispUnit;
+};
+
+CommWinImplDummy::~CommWinImplDummy() = default;
+
 class CommImplDummy : public CommImpl
 {
 public:
@@ -104,6 +120,15 @@ public:
 
     Comm::Req Irecv(void *buffer, size_t count, Datatype datatype, int source,
                     int tag, const std::string &hint) const override;
+
+    Comm::Win Win_allocate_shared(size_t size, int disp_unit, void *baseptr,
+                                  const std::string &hint) const override;
+    void Win_shared_query(Comm::Win &win, int rank, size_t *size,
+                          int *disp_unit, void *baseptr,
+                          const std::string &hint) const override;
+    void Win_free(Comm::Win &win, const std::string &hint) const override;
+    void Win_fence(int assert, Comm::Win &win,
+                   const std::string &hint) const override;
 };
 
 CommImplDummy::~CommImplDummy() = default;
@@ -285,6 +310,34 @@ Comm::Req CommImplDummy::Irecv(void *, size_t, Datatype, int, int,
     return MakeReq(std::move(req));
 }
 
+Comm::Win CommImplDummy::Win_allocate_shared(size_t size, int disp_unit,
+                                              void *baseptr,
+                                              const std::string &) const
+{
+    std::unique_ptr<CommWinImplDummy> win(
+        new CommWinImplDummy(size, disp_unit));
+    *reinterpret_cast<char **>(baseptr) = win->m_Segment.data();
+    return MakeWin(std::move(win));
+}
+
+void CommImplDummy::Win_shared_query(Comm::Win &win, int, size_t *size,
+                                     int *disp_unit, void *baseptr,
+                                     const std::string &) const
+{
+    CommWinImplDummy *w =
+        dynamic_cast<CommWinImplDummy *>(CommImpl::Get(win));
+    *size = w->m_Segment.size();
+    *disp_unit = w->m_DispUnit;
+    *reinterpret_cast<char **>(baseptr) = w->m_Segment.data();
+}
+
+void CommImplDummy::Win_free(Comm::Win &win, const std::string &) const
+{
+    CommImpl::Release(win);
+}
+
+void CommImplDummy::Win_fence(int, Comm::Win &, const std::string &) const {}
+
 Comm::Status CommReqImplDummy::Wait(const std::string &hint)
 {
     Comm::Status status;
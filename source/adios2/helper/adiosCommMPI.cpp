@@ -108,6 +108,17 @@ public:
 
 CommReqImplMPI::~CommReqImplMPI() = default;
 
+class CommWinImplMPI : public CommWinImpl
+{
+public:
+    CommWinImplMPI() = default;
+    ~CommWinImplMPI() override;
+
+    MPI_Win m_Win = MPI_WIN_NULL;
+};
+
+CommWinImplMPI::~CommWinImplMPI() = default;
+
 class CommImplMPI : public CommImpl
 {
 public:
@@ -177,6 +188,15 @@ public:
 
     Comm::Req Irecv(void *buffer, size_t count, Datatype datatype, int source,
                     int tag, const std::string &hint) const override;
+
+    Comm::Win Win_allocate_shared(size_t size, int disp_unit, void *baseptr,
+                                  const std::string &hint) const override;
+    void Win_shared_query(Comm::Win &win, int rank, size_t *size,
+                          int *disp_unit, void *baseptr,
+                          const std::string &hint) const override;
+    void Win_free(Comm::Win &win, const std::string &hint) const override;
+    void Win_fence(int assert, Comm::Win &win,
+                   const std::string &hint) const override;
 };
 
 CommImplMPI::~CommImplMPI()
@@ -519,6 +539,46 @@ Comm::Req CommImplMPI::Irecv(void *buffer, size_t count, Datatype datatype,
     return MakeReq(std::move(req));
 }
 
+Comm::Win CommImplMPI::Win_allocate_shared(size_t size, int disp_unit,
+                                            void *baseptr,
+                                            const std::string &hint) const
+{
+    auto win = std::unique_ptr<CommWinImplMPI>(new CommWinImplMPI());
+    CheckMPIReturn(MPI_Win_allocate_shared(static_cast<MPI_Aint>(size),
+                                           disp_unit, MPI_INFO_NULL, m_MPIComm,
+                                           baseptr, &win->m_Win),
+                   "in call to Win_allocate_shared " + hint + "\n");
+    return MakeWin(std::move(win));
+}
+
+void CommImplMPI::Win_shared_query(Comm::Win &win, int rank, size_t *size,
+                                   int *disp_unit, void *baseptr,
+                                   const std::string &hint) const
+{
+    CommWinImplMPI *w = dynamic_cast<CommWinImplMPI *>(CommImpl::Get(win));
+    MPI_Aint asize;
+    CheckMPIReturn(
+        MPI_Win_shared_query(w->m_Win, rank, &asize, disp_unit, baseptr),
+        "in call to Win_shared_query " + hint + "\n");
+    *size = static_cast<size_t>(asize);
+}
+
+void CommImplMPI::Win_free(Comm::Win &win, const std::string &hint) const
+{
+    std::unique_ptr<CommWinImpl> impl = CommImpl::Release(win);
+    CommWinImplMPI *w = dynamic_cast<CommWinImplMPI *>(impl.get());
+    CheckMPIReturn(MPI_Win_free(&w->m_Win),
+                   "in call to Win_free " + hint + "\n");
+}
+
+void CommImplMPI::Win_fence(int assert, Comm::Win &win,
+                            const std::string &hint) const
+{
+    CommWinImplMPI *w = dynamic_cast<CommWinImplMPI *>(CommImpl::Get(win));
+    CheckMPIReturn(MPI_Win_fence(assert, w->m_Win),
+                   "in call to Win_fence " + hint + "\n");
+}
+
 Comm::Status CommReqImplMPI::Wait(const std::string &hint)
 {
     Comm::Status status;
@@ -16,6 +16,7 @@
 /// \endcond
 
 #include "adios2/common/ADIOSTypes.h"
+#include "adios2/helper/adiosThreadPool.h"
 
 #include <iostream>
 
@@ -56,6 +57,67 @@ void GetMinMaxSelection(const T *values, const Dims &shape, const Dims &start,
 template <class T>
 void GetMinMax(const T *values, const size_t size, T &min, T &max) noexcept;
 
+/** Fixed-width types with vectorized GetMinMax kernels */
+#define ADIOS2_FOREACH_MINMAX_SIMD_TYPE_1ARG(MACRO)                            \
+    MACRO(int8_t)                                                              \
+    MACRO(int16_t)                                                             \
+    MACRO(int32_t)                                                             \
+    MACRO(int64_t)                                                             \
+    MACRO(uint8_t)                                                             \
+    MACRO(uint16_t)                                                            \
+    MACRO(uint32_t)                                                            \
+    MACRO(uint64_t)                                                            \
+    MACRO(float)                                                               \
+    MACRO(double)
+
+/**
+ * Single pass min and max using SSE4.2, AVX2 or AVX-512 kernels picked at
+ * runtime from the CPU features, implemented in adiosMathSIMD.cpp. NaN values
+ * are skipped unless values[0] is NaN. Does nothing if size is zero.
+ */
+#define declare_type(T)                                                        \
+    template <>                                                                \
+    void GetMinMax(const T *values, const size_t size, T &min,                 \
+                   T &max) noexcept;
+ADIOS2_FOREACH_MINMAX_SIMD_TYPE_1ARG(declare_type)
+#undef declare_type
+
+/**
+ * GetMinMax fused with copying values into dest, so that values are read
+ * from memory only once
+ * @param dest output array of size elements, must not overlap values
+ * @param values input array
+ * @param size of values array
+ * @param min of values
+ * @param max of values
+ */
+template <class T>
+void CopyGetMinMax(T *dest, const T *values, const size_t size, T &min,
+                   T &max) noexcept;
+
+#define declare_type(T)                                                        \
+    template <>                                                                \
+    void CopyGetMinMax(T *dest, const T *values, const size_t size, T &min,    \
+                       T &max) noexcept;
+ADIOS2_FOREACH_MINMAX_SIMD_TYPE_1ARG(declare_type)
+#undef declare_type
+
+/**
+ * Threaded version of CopyGetMinMax, each thread copies and reduces a
+ * contiguous piece of values
+ * @param dest output array of size elements, must not overlap values
+ * @param values input array
+ * @param size of values array
+ * @param min of values
+ * @param max of values
+ * @param threads used for parallel computation
+ * @param pool runs the threads, computed serially if nullptr
+ */
+template <class T>
+void CopyGetMinMaxThreads(T *dest, const T *values, const size_t size, T &min,
+                          T &max, const unsigned int threads = 1,
+                          ThreadPool *pool = nullptr) noexcept;
+
 /**
  * Version for complex types of GetMinMax, gets the "doughnut" range between min
  * and max modulus. Needed a different function as thread can't resolve the
@@ -78,10 +140,12 @@ void GetMinMaxComplex(const std::complex<T> *values, const size_t size,
  * @param min of values
  * @param max of values
  * @param threads used for parallel computation
+ * @param pool runs the threads, computed serially if nullptr
  */
 template <class T>
 void GetMinMaxThreads(const T *values, const size_t size, T &min, T &max,
-                      const unsigned int threads = 1) noexcept;
+                      const unsigned int threads = 1,
+                      ThreadPool *pool = nullptr) noexcept;
 
 /**
  * Overloaded version of GetMinMaxThreads for complex types
@@ -90,10 +154,12 @@ void GetMinMaxThreads(const T *values, const size_t size, T &min, T &max,
  * @param min of values
  * @param max of values
  * @param threads used for parallel computation
+ * @param pool runs the threads, computed serially if nullptr
  */
 template <class T>
 void GetMinMaxThreads(const std::complex<T> *values, const size_t size, T &min,
-                      T &max, const unsigned int threads = 1) noexcept;
+                      T &max, const unsigned int threads = 1,
+                      ThreadPool *pool = nullptr) noexcept;
 
 /**
  * Check if index is within (inclusive) limits
@@ -307,11 +373,33 @@ Box<Dims> GetSubBlock(const Dims &count, const BlockDivisionInfo &info,
  * @param info The result of DivideBlock() to help enumerate the sub-blocks
  * @param MinMaxs empty vector which will be allocated and filled out (min-max
  * pairs)
+ * @param threads used for parallel computation of an undivided block
+ * @param pool runs the threads, computed serially if nullptr
  */
 template <class T>
 void GetMinMaxSubblocks(const T *values, const Dims &count,
                         const BlockDivisionInfo &info, std::vector<T> &MinMaxs,
-                        T &bmin, T &bmax, const unsigned int threads) noexcept;
+                        T &bmin, T &bmax, const unsigned int threads,
+                        ThreadPool *pool = nullptr) noexcept;
+
+/**
+ * GetMinMaxSubblocks fused with copying the block into dest, the sub-blocks
+ * are contiguous pieces of the block so each is copied as it is reduced
+ * @param dest output array with the size of the block, must not overlap values
+ * @param values input array
+ * @param count N-dims of array
+ * @param info The result of DivideBlock() to help enumerate the sub-blocks
+ * @param MinMaxs empty vector which will be allocated and filled out (min-max
+ * pairs)
+ * @param threads used for parallel computation of an undivided block
+ * @param pool runs the threads, computed serially if nullptr
+ */
+template <class T>
+void CopyGetMinMaxSubblocks(T *dest, const T *values, const Dims &count,
+                            const BlockDivisionInfo &info,
+                            std::vector<T> &MinMaxs, T &bmin, T &bmax,
+                            const unsigned int threads,
+                            ThreadPool *pool = nullptr) noexcept;
 
 } // end namespace helper
 } // end namespace adios2
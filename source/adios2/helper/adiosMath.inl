@@ -17,7 +17,6 @@
 #include <algorithm> // std::minmax_element, std::min_element, std::max_element
                      // std::transform
 #include <limits>    //std::numeri_limits
-#include <thread>
 
 #include "adios2/common/ADIOSMacros.h"
 
@@ -207,6 +206,18 @@ inline void GetMinMax(const std::complex<double> *values, const size_t size,
     GetMinMaxComplex(values, size, min, max);
 }
 
+template <class T>
+inline void CopyGetMinMax(T *dest, const T *values, const size_t size, T &min,
+                          T &max) noexcept
+{
+    if (size == 0)
+    {
+        return;
+    }
+    std::copy(values, values + size, dest);
+    GetMinMax(dest, size, min, max);
+}
+
 template <class T>
 void GetMinMaxComplex(const std::complex<T> *values, const size_t size,
                       std::complex<T> &min, std::complex<T> &max) noexcept
@@ -238,14 +249,14 @@ void GetMinMaxComplex(const std::complex<T> *values, const size_t size,
 
 template <class T>
 void GetMinMaxThreads(const T *values, const size_t size, T &min, T &max,
-                      const unsigned int threads) noexcept
+                      const unsigned int threads, ThreadPool *pool) noexcept
 {
     if (size == 0)
     {
         return;
     }
 
-    if (threads == 1 || size < 1000000)
+    if (threads <= 1 || pool == nullptr || size < 1000000)
     {
         GetMinMax(values, size, min, max);
         return;
@@ -258,31 +269,11 @@ void GetMinMaxThreads(const T *values, const size_t size, T &min, T &max,
     std::vector<T> mins(threads); // zero init
     std::vector<T> maxs(threads); // zero init
 
-    std::vector<std::thread> getMinMaxThreads;
-    getMinMaxThreads.reserve(threads);
-
-    for (unsigned int t = 0; t < threads; ++t)
-    {
+    pool->ParallelFor(threads, threads, [&](const size_t t) {
         const size_t position = stride * t;
-
-        if (t == threads - 1)
-        {
-            getMinMaxThreads.push_back(
-                std::thread(GetMinMax<T>, &values[position], last,
-                            std::ref(mins[t]), std::ref(maxs[t])));
-        }
-        else
-        {
-            getMinMaxThreads.push_back(
-                std::thread(GetMinMax<T>, &values[position], stride,
-                            std::ref(mins[t]), std::ref(maxs[t])));
-        }
-    }
-
-    for (auto &getMinMaxThread : getMinMaxThreads)
-    {
-        getMinMaxThread.join();
-    }
+        GetMinMax(&values[position], (t == threads - 1) ? last : stride,
+                  mins[t], maxs[t]);
+    });
 
     auto itMin = std::min_element(mins.begin(), mins.end());
     min = *itMin;
@@ -294,14 +285,14 @@ void GetMinMaxThreads(const T *values, const size_t size, T &min, T &max,
 template <class T>
 void GetMinMaxThreads(const std::complex<T> *values, const size_t size,
                       std::complex<T> &min, std::complex<T> &max,
-                      const unsigned int threads) noexcept
+                      const unsigned int threads, ThreadPool *pool) noexcept
 {
     if (size == 0)
     {
         return;
     }
 
-    if (threads == 1 || size < 1000000)
+    if (threads <= 1 || pool == nullptr || size < 1000000)
     {
         GetMinMaxComplex(values, size, min, max);
         return;
@@ -314,43 +305,69 @@ void GetMinMaxThreads(const std::complex<T> *values, const size_t size,
     std::vector<std::complex<T>> mins(threads); // zero init
     std::vector<std::complex<T>> maxs(threads); // zero init
 
-    std::vector<std::thread> getMinMaxThreads;
-    getMinMaxThreads.reserve(threads);
-
-    for (unsigned int t = 0; t < threads; ++t)
-    {
+    pool->ParallelFor(threads, threads, [&](const size_t t) {
         const size_t position = stride * t;
+        GetMinMaxComplex(&values[position],
+                         (t == threads - 1) ? last : stride, mins[t], maxs[t]);
+    });
 
-        if (t == threads - 1)
-        {
-            getMinMaxThreads.push_back(
-                std::thread(GetMinMaxComplex<T>, &values[position], last,
-                            std::ref(mins[t]), std::ref(maxs[t])));
-        }
-        else
-        {
-            getMinMaxThreads.push_back(
-                std::thread(GetMinMaxComplex<T>, &values[position], stride,
-                            std::ref(mins[t]), std::ref(maxs[t])));
-        }
+    std::complex<T> minTemp;
+    std::complex<T> maxTemp;
+
+    GetMinMaxComplex(mins.data(), mins.size(), min, maxTemp);
+    GetMinMaxComplex(maxs.data(), maxs.size(), minTemp, max);
+}
+
+template <class T>
+void CopyGetMinMaxThreads(T *dest, const T *values, const size_t size, T &min,
+                          T &max, const unsigned int threads,
+                          ThreadPool *pool) noexcept
+{
+    if (size == 0)
+    {
+        return;
     }
 
-    for (auto &getMinMaxThread : getMinMaxThreads)
+    if (threads <= 1 || pool == nullptr || size < 1000000)
     {
-        getMinMaxThread.join();
+        CopyGetMinMax(dest, values, size, min, max);
+        return;
     }
 
-    std::complex<T> minTemp;
-    std::complex<T> maxTemp;
+    const size_t stride = size / threads;    // elements per thread
+    const size_t remainder = size % threads; // remainder if not aligned
+    const size_t last = stride + remainder;
 
-    GetMinMaxComplex(mins.data(), mins.size(), min, maxTemp);
-    GetMinMaxComplex(maxs.data(), maxs.size(), minTemp, max);
+    std::vector<T> mins(threads);
+    std::vector<T> maxs(threads);
+
+    pool->ParallelFor(threads, threads, [&](const size_t t) {
+        const size_t position = stride * t;
+        const size_t elements = (t == threads - 1) ? last : stride;
+        CopyGetMinMax(&dest[position], &values[position], elements, mins[t],
+                      maxs[t]);
+    });
+
+    min = mins[0];
+    max = maxs[0];
+    for (unsigned int t = 1; t < threads; ++t)
+    {
+        if (LessThan(mins[t], min))
+        {
+            min = mins[t];
+        }
+        if (GreaterThan(maxs[t], max))
+        {
+            max = maxs[t];
+        }
+    }
 }
 
 template <class T>
 void GetMinMaxSubblocks(const T *values, const Dims &count,
                         const BlockDivisionInfo &info, std::vector<T> &MinMaxs,
-                        T &bmin, T &bmax, const unsigned int threads) noexcept
+                        T &bmin, T &bmax, const unsigned int threads,
+                        ThreadPool *pool) noexcept
 {
     const int ndim = static_cast<int>(count.size());
     const size_t nElems = helper::GetTotalSize(count);
@@ -362,7 +379,7 @@ void GetMinMaxSubblocks(const T *values, const Dims &count,
         {
             return;
         }
-        GetMinMaxThreads(values, nElems, bmin, bmax, threads);
+        GetMinMaxThreads(values, nElems, bmin, bmax, threads, pool);
         MinMaxs[0] = bmin;
         MinMaxs[1] = bmax;
     }
@@ -412,6 +429,60 @@ void GetMinMaxSubblocks(const T *values, const Dims &count,
     }
 }
 
+template <class T>
+void CopyGetMinMaxSubblocks(T *dest, const T *values, const Dims &count,
+                            const BlockDivisionInfo &info,
+                            std::vector<T> &MinMaxs, T &bmin, T &bmax,
+                            const unsigned int threads,
+                            ThreadPool *pool) noexcept
+{
+    const int ndim = static_cast<int>(count.size());
+    const size_t nElems = helper::GetTotalSize(count);
+    if (info.NBlocks <= 1)
+    {
+        MinMaxs.resize(2);
+        CopyGetMinMaxThreads(dest, values, nElems, bmin, bmax, threads,
+                             pool);
+        MinMaxs[0] = bmin;
+        MinMaxs[1] = bmax;
+        return;
+    }
+
+    MinMaxs.resize(2 * info.NBlocks);
+    for (int b = 0; b < info.NBlocks; ++b)
+    {
+        const Box<Dims> box = GetSubBlock(count, info, b);
+        size_t pos = 0;
+        size_t prod = 1;
+        for (int d = ndim - 1; d >= 0; --d)
+        {
+            pos += box.first[d] * prod;
+            prod *= count[d];
+        }
+        T vmin, vmax;
+        const size_t nElemsSub = helper::GetTotalSize(box.second);
+        CopyGetMinMax(dest + pos, values + pos, nElemsSub, vmin, vmax);
+        MinMaxs[2 * b] = vmin;
+        MinMaxs[2 * b + 1] = vmax;
+        if (b == 0)
+        {
+            bmin = vmin;
+            bmax = vmax;
+        }
+        else
+        {
+            if (LessThan(vmin, bmin))
+            {
+                bmin = vmin;
+            }
+            if (GreaterThan(vmax, bmax))
+            {
+                bmax = vmax;
+            }
+        }
+    }
+}
+
 #if 0
 template <class T>
 void GetMinMaxSubblocks(const T *values, const Dims &count,
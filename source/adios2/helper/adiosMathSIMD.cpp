@@ -0,0 +1,563 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * adiosMathSIMD.cpp vectorized GetMinMax kernels, the widest instruction set
+ * supported by the CPU is selected at runtime
+ */
+
+#include "adiosMath.h"
+
+#include <cstdint> // INT64_MIN
+
+#if defined(__x86_64__) &&                                                     \
+    ((defined(__GNUC__) && __GNUC__ >= 5) || defined(__clang__))
+#define ADIOS2_MINMAX_X86
+#include <immintrin.h>
+#endif
+
+namespace adios2
+{
+namespace helper
+{
+
+namespace
+{
+
+/**
+ * Scalar min/max folded into min and max, comparisons match the vector
+ * kernels: min = v < min ? v : min, so NaN values never replace min or max.
+ * With Copy values are also stored to dest.
+ */
+template <bool Copy, class T>
+inline void MinMaxScalar(const T *values, const size_t size, T &min, T &max,
+                         T *dest) noexcept
+{
+    T vmin = min;
+    T vmax = max;
+    for (size_t i = 0; i < size; ++i)
+    {
+        const T v = values[i];
+        if (Copy)
+        {
+            dest[i] = v;
+        }
+        vmin = v < vmin ? v : vmin;
+        vmax = v > vmax ? v : vmax;
+    }
+    min = vmin;
+    max = vmax;
+}
+
+#ifdef ADIOS2_MINMAX_X86
+
+#define ADIOS2_TARGET_SSE42 __attribute__((target("sse4.2")))
+#define ADIOS2_TARGET_AVX2 __attribute__((target("avx2")))
+#define ADIOS2_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+
+/*
+ * Each instruction set provides Ops<T> with a register type Reg and
+ * Load, Store, Set1, Min(a, b) = a < b ? a : b and Max(a, b) = a > b ? a : b,
+ * the argument order of the min/max instructions for floating point types
+ */
+
+namespace sse42
+{
+
+template <class T>
+struct Ops;
+
+#define ADIOS2_MINMAX_OPS(T, SETT, SET1, MIN, MAX)                             \
+    template <>                                                                \
+    struct Ops<T>                                                              \
+    {                                                                          \
+        typedef __m128i Reg;                                                   \
+        ADIOS2_TARGET_SSE42 static inline Reg Load(const T *p)                 \
+        {                                                                      \
+            return _mm_loadu_si128(reinterpret_cast<const Reg *>(p));          \
+        }                                                                      \
+        ADIOS2_TARGET_SSE42 static inline void Store(T *p, const Reg r)        \
+        {                                                                      \
+            _mm_storeu_si128(reinterpret_cast<Reg *>(p), r);                   \
+        }                                                                      \
+        ADIOS2_TARGET_SSE42 static inline Reg Set1(const T v)                  \
+        {                                                                      \
+            return SET1(static_cast<SETT>(v));                                 \
+        }                                                                      \
+        ADIOS2_TARGET_SSE42 static inline Reg Min(const Reg a, const Reg b)    \
+        {                                                                      \
+            return MIN(a, b);                                                  \
+        }                                                                      \
+        ADIOS2_TARGET_SSE42 static inline Reg Max(const Reg a, const Reg b)    \
+        {                                                                      \
+            return MAX(a, b);                                                  \
+        }                                                                      \
+    };
+
+/** SSE has no 64-bit integer min/max, compare and blend instead */
+ADIOS2_TARGET_SSE42 inline __m128i MinI64(const __m128i a, const __m128i b)
+{
+    return _mm_blendv_epi8(b, a, _mm_cmpgt_epi64(b, a));
+}
+
+ADIOS2_TARGET_SSE42 inline __m128i MaxI64(const __m128i a, const __m128i b)
+{
+    return _mm_blendv_epi8(b, a, _mm_cmpgt_epi64(a, b));
+}
+
+/** unsigned 64-bit comparisons through the sign flipped values */
+ADIOS2_TARGET_SSE42 inline __m128i MinU64(const __m128i a, const __m128i b)
+{
+    const __m128i sign = _mm_set1_epi64x(INT64_MIN);
+    const __m128i mask = _mm_cmpgt_epi64(_mm_xor_si128(b, sign),
+                                         _mm_xor_si128(a, sign));
+    return _mm_blendv_epi8(b, a, mask);
+}
+
+ADIOS2_TARGET_SSE42 inline __m128i MaxU64(const __m128i a, const __m128i b)
+{
+    const __m128i sign = _mm_set1_epi64x(INT64_MIN);
+    const __m128i mask = _mm_cmpgt_epi64(_mm_xor_si128(a, sign),
+                                         _mm_xor_si128(b, sign));
+    return _mm_blendv_epi8(b, a, mask);
+}
+
+ADIOS2_MINMAX_OPS(int8_t, char, _mm_set1_epi8, _mm_min_epi8, _mm_max_epi8)
+ADIOS2_MINMAX_OPS(uint8_t, char, _mm_set1_epi8, _mm_min_epu8, _mm_max_epu8)
+ADIOS2_MINMAX_OPS(int16_t, short, _mm_set1_epi16, _mm_min_epi16,
+                  _mm_max_epi16)
+ADIOS2_MINMAX_OPS(uint16_t, short, _mm_set1_epi16, _mm_min_epu16,
+                  _mm_max_epu16)
+ADIOS2_MINMAX_OPS(int32_t, int, _mm_set1_epi32, _mm_min_epi32, _mm_max_epi32)
+ADIOS2_MINMAX_OPS(uint32_t, int, _mm_set1_epi32, _mm_min_epu32,
+                  _mm_max_epu32)
+ADIOS2_MINMAX_OPS(int64_t, long long, _mm_set1_epi64x, MinI64, MaxI64)
+ADIOS2_MINMAX_OPS(uint64_t, long long, _mm_set1_epi64x, MinU64, MaxU64)
+#undef ADIOS2_MINMAX_OPS
+
+template <>
+struct Ops<float>
+{
+    typedef __m128 Reg;
+    ADIOS2_TARGET_SSE42 static inline Reg Load(const float *p)
+    {
+        return _mm_loadu_ps(p);
+    }
+    ADIOS2_TARGET_SSE42 static inline void Store(float *p, const Reg r)
+    {
+        _mm_storeu_ps(p, r);
+    }
+    ADIOS2_TARGET_SSE42 static inline Reg Set1(const float v)
+    {
+        return _mm_set1_ps(v);
+    }
+    ADIOS2_TARGET_SSE42 static inline Reg Min(const Reg a, const Reg b)
+    {
+        return _mm_min_ps(a, b);
+    }
+    ADIOS2_TARGET_SSE42 static inline Reg Max(const Reg a, const Reg b)
+    {
+        return _mm_max_ps(a, b);
+    }
+};
+
+template <>
+struct Ops<double>
+{
+    typedef __m128d Reg;
+    ADIOS2_TARGET_SSE42 static inline Reg Load(const double *p)
+    {
+        return _mm_loadu_pd(p);
+    }
+    ADIOS2_TARGET_SSE42 static inline void Store(double *p, const Reg r)
+    {
+        _mm_storeu_pd(p, r);
+    }
+    ADIOS2_TARGET_SSE42 static inline Reg Set1(const double v)
+    {
+        return _mm_set1_pd(v);
+    }
+    ADIOS2_TARGET_SSE42 static inline Reg Min(const Reg a, const Reg b)
+    {
+        return _mm_min_pd(a, b);
+    }
+    ADIOS2_TARGET_SSE42 static inline Reg Max(const Reg a, const Reg b)
+    {
+        return _mm_max_pd(a, b);
+    }
+};
+
+} // end namespace sse42
+
+namespace avx2
+{
+
+template <class T>
+struct Ops;
+
+#define ADIOS2_MINMAX_OPS(T, SETT, SET1, MIN, MAX)                             \
+    template <>                                                                \
+    struct Ops<T>                                                              \
+    {                                                                          \
+        typedef __m256i Reg;                                                   \
+        ADIOS2_TARGET_AVX2 static inline Reg Load(const T *p)                  \
+        {                                                                      \
+            return _mm256_loadu_si256(reinterpret_cast<const Reg *>(p));       \
+        }                                                                      \
+        ADIOS2_TARGET_AVX2 static inline void Store(T *p, const Reg r)         \
+        {                                                                      \
+            _mm256_storeu_si256(reinterpret_cast<Reg *>(p), r);                \
+        }                                                                      \
+        ADIOS2_TARGET_AVX2 static inline Reg Set1(const T v)                   \
+        {                                                                      \
+            return SET1(static_cast<SETT>(v));                                 \
+        }                                                                      \
+        ADIOS2_TARGET_AVX2 static inline Reg Min(const Reg a, const Reg b)     \
+        {                                                                      \
+            return MIN(a, b);                                                  \
+        }                                                                      \
+        ADIOS2_TARGET_AVX2 static inline Reg Max(const Reg a, const Reg b)     \
+        {                                                                      \
+            return MAX(a, b);                                                  \
+        }                                                                      \
+    };
+
+ADIOS2_TARGET_AVX2 inline __m256i MinI64(const __m256i a, const __m256i b)
+{
+    return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(b, a));
+}
+
+ADIOS2_TARGET_AVX2 inline __m256i MaxI64(const __m256i a, const __m256i b)
+{
+    return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b));
+}
+
+ADIOS2_TARGET_AVX2 inline __m256i MinU64(const __m256i a, const __m256i b)
+{
+    const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i mask = _mm256_cmpgt_epi64(_mm256_xor_si256(b, sign),
+                                            _mm256_xor_si256(a, sign));
+    return _mm256_blendv_epi8(b, a, mask);
+}
+
+ADIOS2_TARGET_AVX2 inline __m256i MaxU64(const __m256i a, const __m256i b)
+{
+    const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i mask = _mm256_cmpgt_epi64(_mm256_xor_si256(a, sign),
+                                            _mm256_xor_si256(b, sign));
+    return _mm256_blendv_epi8(b, a, mask);
+}
+
+ADIOS2_MINMAX_OPS(int8_t, char, _mm256_set1_epi8, _mm256_min_epi8,
+                  _mm256_max_epi8)
+ADIOS2_MINMAX_OPS(uint8_t, char, _mm256_set1_epi8, _mm256_min_epu8,
+                  _mm256_max_epu8)
+ADIOS2_MINMAX_OPS(int16_t, short, _mm256_set1_epi16, _mm256_min_epi16,
+                  _mm256_max_epi16)
+ADIOS2_MINMAX_OPS(uint16_t, short, _mm256_set1_epi16, _mm256_min_epu16,
+                  _mm256_max_epu16)
+ADIOS2_MINMAX_OPS(int32_t, int, _mm256_set1_epi32, _mm256_min_epi32,
+                  _mm256_max_epi32)
+ADIOS2_MINMAX_OPS(uint32_t, int, _mm256_set1_epi32, _mm256_min_epu32,
+                  _mm256_max_epu32)
+ADIOS2_MINMAX_OPS(int64_t, long long, _mm256_set1_epi64x, MinI64, MaxI64)
+ADIOS2_MINMAX_OPS(uint64_t, long long, _mm256_set1_epi64x, MinU64, MaxU64)
+#undef ADIOS2_MINMAX_OPS
+
+template <>
+struct Ops<float>
+{
+    typedef __m256 Reg;
+    ADIOS2_TARGET_AVX2 static inline Reg Load(const float *p)
+    {
+        return _mm256_loadu_ps(p);
+    }
+    ADIOS2_TARGET_AVX2 static inline void Store(float *p, const Reg r)
+    {
+        _mm256_storeu_ps(p, r);
+    }
+    ADIOS2_TARGET_AVX2 static inline Reg Set1(const float v)
+    {
+        return _mm256_set1_ps(v);
+    }
+    ADIOS2_TARGET_AVX2 static inline Reg Min(const Reg a, const Reg b)
+    {
+        return _mm256_min_ps(a, b);
+    }
+    ADIOS2_TARGET_AVX2 static inline Reg Max(const Reg a, const Reg b)
+    {
+        return _mm256_max_ps(a, b);
+    }
+};
+
+template <>
+struct Ops<double>
+{
+    typedef __m256d Reg;
+    ADIOS2_TARGET_AVX2 static inline Reg Load(const double *p)
+    {
+        return _mm256_loadu_pd(p);
+    }
+    ADIOS2_TARGET_AVX2 static inline void Store(double *p, const Reg r)
+    {
+        _mm256_storeu_pd(p, r);
+    }
+    ADIOS2_TARGET_AVX2 static inline Reg Set1(const double v)
+    {
+        return _mm256_set1_pd(v);
+    }
+    ADIOS2_TARGET_AVX2 static inline Reg Min(const Reg a, const Reg b)
+    {
+        return _mm256_min_pd(a, b);
+    }
+    ADIOS2_TARGET_AVX2 static inline Reg Max(const Reg a, const Reg b)
+    {
+        return _mm256_max_pd(a, b);
+    }
+};
+
+} // end namespace avx2
+
+namespace avx512
+{
+
+template <class T>
+struct Ops;
+
+#define ADIOS2_MINMAX_OPS(T, SETT, SET1, MIN, MAX)                             \
+    template <>                                                                \
+    struct Ops<T>                                                              \
+    {                                                                          \
+        typedef __m512i Reg;                                                   \
+        ADIOS2_TARGET_AVX512 static inline Reg Load(const T *p)                \
+        {                                                                      \
+            return _mm512_loadu_si512(p);                                      \
+        }                                                                      \
+        ADIOS2_TARGET_AVX512 static inline void Store(T *p, const Reg r)       \
+        {                                                                      \
+            _mm512_storeu_si512(p, r);                                         \
+        }                                                                      \
+        ADIOS2_TARGET_AVX512 static inline Reg Set1(const T v)                 \
+        {                                                                      \
+            return SET1(static_cast<SETT>(v));                                 \
+        }                                                                      \
+        ADIOS2_TARGET_AVX512 static inline Reg Min(const Reg a, const Reg b)   \
+        {                                                                      \
+            return MIN(a, b);                                                  \
+        }                                                                      \
+        ADIOS2_TARGET_AVX512 static inline Reg Max(const Reg a, const Reg b)   \
+        {                                                                      \
+            return MAX(a, b);                                                  \
+        }                                                                      \
+    };
+
+ADIOS2_MINMAX_OPS(int8_t, char, _mm512_set1_epi8, _mm512_min_epi8,
+                  _mm512_max_epi8)
+ADIOS2_MINMAX_OPS(uint8_t, char, _mm512_set1_epi8, _mm512_min_epu8,
+                  _mm512_max_epu8)
+ADIOS2_MINMAX_OPS(int16_t, short, _mm512_set1_epi16, _mm512_min_epi16,
+                  _mm512_max_epi16)
+ADIOS2_MINMAX_OPS(uint16_t, short, _mm512_set1_epi16, _mm512_min_epu16,
+                  _mm512_max_epu16)
+ADIOS2_MINMAX_OPS(int32_t, int, _mm512_set1_epi32, _mm512_min_epi32,
+                  _mm512_max_epi32)
+ADIOS2_MINMAX_OPS(uint32_t, int, _mm512_set1_epi32, _mm512_min_epu32,
+                  _mm512_max_epu32)
+ADIOS2_MINMAX_OPS(int64_t, long long, _mm512_set1_epi64, _mm512_min_epi64,
+                  _mm512_max_epi64)
+ADIOS2_MINMAX_OPS(uint64_t, long long, _mm512_set1_epi64, _mm512_min_epu64,
+                  _mm512_max_epu64)
+#undef ADIOS2_MINMAX_OPS
+
+template <>
+struct Ops<float>
+{
+    typedef __m512 Reg;
+    ADIOS2_TARGET_AVX512 static inline Reg Load(const float *p)
+    {
+        return _mm512_loadu_ps(p);
+    }
+    ADIOS2_TARGET_AVX512 static inline void Store(float *p, const Reg r)
+    {
+        _mm512_storeu_ps(p, r);
+    }
+    ADIOS2_TARGET_AVX512 static inline Reg Set1(const float v)
+    {
+        return _mm512_set1_ps(v);
+    }
+    ADIOS2_TARGET_AVX512 static inline Reg Min(const Reg a, const Reg b)
+    {
+        return _mm512_min_ps(a, b);
+    }
+    ADIOS2_TARGET_AVX512 static inline Reg Max(const Reg a, const Reg b)
+    {
+        return _mm512_max_ps(a, b);
+    }
+};
+
+template <>
+struct Ops<double>
+{
+    typedef __m512d Reg;
+    ADIOS2_TARGET_AVX512 static inline Reg Load(const double *p)
+    {
+        return _mm512_loadu_pd(p);
+    }
+    ADIOS2_TARGET_AVX512 static inline void Store(double *p, const Reg r)
+    {
+        _mm512_storeu_pd(p, r);
+    }
+    ADIOS2_TARGET_AVX512 static inline Reg Set1(const double v)
+    {
+        return _mm512_set1_pd(v);
+    }
+    ADIOS2_TARGET_AVX512 static inline Reg Min(const Reg a, const Reg b)
+    {
+        return _mm512_min_pd(a, b);
+    }
+    ADIOS2_TARGET_AVX512 static inline Reg Max(const Reg a, const Reg b)
+    {
+        return _mm512_max_pd(a, b);
+    }
+};
+
+} // end namespace avx512
+
+/*
+ * The same kernel compiled for each instruction set, two independent
+ * accumulator pairs hide the min/max latency. The target attribute can't be a
+ * template argument, hence the macro. With Copy the loaded registers are also
+ * stored to dest, fusing the copy of values with the reduction.
+ */
+#define ADIOS2_MINMAX_KERNEL(ISA, TARGET)                                      \
+    template <bool Copy, class T>                                              \
+    TARGET void MinMax_##ISA(const T *values, const size_t size, T &min,       \
+                             T &max, T *dest) noexcept                         \
+    {                                                                          \
+        typedef ISA::Ops<T> Ops;                                               \
+        typedef typename Ops::Reg Reg;                                         \
+        const size_t lanes = sizeof(Reg) / sizeof(T);                          \
+        min = values[0];                                                       \
+        max = values[0];                                                       \
+        size_t i = 0;                                                          \
+        if (size >= 2 * lanes)                                                 \
+        {                                                                      \
+            Reg min0 = Ops::Set1(values[0]);                                   \
+            Reg max0 = min0;                                                   \
+            Reg min1 = min0;                                                   \
+            Reg max1 = min0;                                                   \
+            for (; i + 2 * lanes <= size; i += 2 * lanes)                      \
+            {                                                                  \
+                const Reg a = Ops::Load(values + i);                           \
+                const Reg b = Ops::Load(values + i + lanes);                   \
+                if (Copy)                                                      \
+                {                                                              \
+                    Ops::Store(dest + i, a);                                   \
+                    Ops::Store(dest + i + lanes, b);                           \
+                }                                                              \
+                min0 = Ops::Min(a, min0);                                      \
+                max0 = Ops::Max(a, max0);                                      \
+                min1 = Ops::Min(b, min1);                                      \
+                max1 = Ops::Max(b, max1);                                      \
+            }                                                                  \
+            T mins[sizeof(Reg) / sizeof(T)];                                   \
+            T maxs[sizeof(Reg) / sizeof(T)];                                   \
+            Ops::Store(mins, Ops::Min(min1, min0));                            \
+            Ops::Store(maxs, Ops::Max(max1, max0));                            \
+            for (size_t l = 0; l < lanes; ++l)                                 \
+            {                                                                  \
+                min = mins[l] < min ? mins[l] : min;                           \
+                max = maxs[l] > max ? maxs[l] : max;                           \
+            }                                                                  \
+        }                                                                      \
+        MinMaxScalar<Copy>(values + i, size - i, min, max,                     \
+                           Copy ? dest + i : dest);                            \
+    }
+
+ADIOS2_MINMAX_KERNEL(sse42, ADIOS2_TARGET_SSE42)
+ADIOS2_MINMAX_KERNEL(avx2, ADIOS2_TARGET_AVX2)
+ADIOS2_MINMAX_KERNEL(avx512, ADIOS2_TARGET_AVX512)
+#undef ADIOS2_MINMAX_KERNEL
+
+#endif // ADIOS2_MINMAX_X86
+
+enum class MinMaxISA
+{
+    Scalar,
+    SSE42,
+    AVX2,
+    AVX512
+};
+
+MinMaxISA DetectMinMaxISA() noexcept
+{
+#ifdef ADIOS2_MINMAX_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    {
+        return MinMaxISA::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return MinMaxISA::AVX2;
+    }
+    if (__builtin_cpu_supports("sse4.2"))
+    {
+        return MinMaxISA::SSE42;
+    }
+#endif
+    return MinMaxISA::Scalar;
+}
+
+template <bool Copy, class T>
+void GetMinMaxSIMD(const T *values, const size_t size, T &min, T &max,
+                   T *dest) noexcept
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    static const MinMaxISA isa = DetectMinMaxISA();
+    switch (isa)
+    {
+#ifdef ADIOS2_MINMAX_X86
+    case MinMaxISA::AVX512:
+        MinMax_avx512<Copy>(values, size, min, max, dest);
+        return;
+    case MinMaxISA::AVX2:
+        MinMax_avx2<Copy>(values, size, min, max, dest);
+        return;
+    case MinMaxISA::SSE42:
+        MinMax_sse42<Copy>(values, size, min, max, dest);
+        return;
+#endif
+    default:
+        min = values[0];
+        max = values[0];
+        MinMaxScalar<Copy>(values, size, min, max, dest);
+    }
+}
+
+} // end anonymous namespace
+
+#define define_type(T)                                                         \
+    template <>                                                                \
+    void GetMinMax(const T *values, const size_t size, T &min,                 \
+                   T &max) noexcept                                            \
+    {                                                                          \
+        GetMinMaxSIMD<false>(values, size, min, max,                           \
+                             static_cast<T *>(nullptr));                       \
+    }                                                                          \
+                                                                               \
+    template <>                                                                \
+    void CopyGetMinMax(T *dest, const T *values, const size_t size, T &min,    \
+                       T &max) noexcept                                        \
+    {                                                                          \
+        GetMinMaxSIMD<true>(values, size, min, max, dest);                     \
+    }
+ADIOS2_FOREACH_MINMAX_SIMD_TYPE_1ARG(define_type)
+#undef define_type
+
+} // end namespace helper
+} // end namespace adios2
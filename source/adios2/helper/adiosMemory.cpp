@@ -11,7 +11,14 @@
 #include "adiosMemory.h"
 
 #include <algorithm>
-#include <stddef.h> // max_align_t
+#include <cstring>    // std::memcpy
+#include <functional> // std::function
+#include <stddef.h>   // max_align_t
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define ADIOS2_STREAMING_X86
+#include <emmintrin.h>
+#endif
 
 #include "adios2/helper/adiosType.h"
 
@@ -50,6 +57,28 @@ void CopyPayloadStride(const char *src, const size_t payloadStride, char *dest,
 #endif
 }
 
+/**
+ * Runs clip(begin, end) over the range [start, start + count) of the
+ * outermost dimension, split in ranges for threads if the copy is large
+ */
+void ClipOuterRange(const size_t start, const size_t count, const size_t bytes,
+                    const unsigned int threads, ThreadPool *pool,
+                    const std::function<void(size_t, size_t)> &clip)
+{
+    if (pool == nullptr || threads <= 1 || count <= 1 ||
+        bytes < NdCopyThreadsBytes)
+    {
+        clip(start, start + count);
+        return;
+    }
+
+    // a few ranges per thread, threads finishing early take the next one
+    const size_t ranges = std::min(count, static_cast<size_t>(threads) * 4);
+    pool->ParallelFor(ranges, threads, [&](const size_t r) {
+        clip(start + count * r / ranges, start + count * (r + 1) / ranges);
+    });
+}
+
 Dims DestDimsFinal(const Dims &destDims, const bool destRowMajor,
                    const bool srcRowMajor)
 {
@@ -66,7 +95,8 @@ void ClipRowMajor(char *dest, const Dims &destStart, const Dims &destCount,
                   const Dims &srcStart, const Dims &srcCount,
                   const Dims & /*destMemStart*/, const Dims & /*destMemCount*/,
                   const Dims &srcMemStart, const Dims &srcMemCount,
-                  const bool endianReverse, const DataType destType)
+                  const bool endianReverse, const DataType destType,
+                  const unsigned int threads, ThreadPool *pool)
 {
     const Dims destStartFinal = DestDimsFinal(destStart, destRowMajor, true);
     const Dims destCountFinal = DestDimsFinal(destCount, destRowMajor, true);
@@ -104,57 +134,67 @@ void ClipRowMajor(char *dest, const Dims &destStart, const Dims &destCount,
     //        }
     //    }
 
-    /// start iteration
-    Dims currentPoint(interStart); // current point for memory copy
     const size_t interOffset =
         LinearIndex(srcStart, srcCount, interStart, true);
 
-    bool run = true;
-
-    while (run)
-    {
-
-        // here copy current linear memory between currentPoint and end
-        const size_t srcBeginOffset =
-            srcMemStart.empty()
-                ? LinearIndex(srcStart, srcCount, currentPoint, true) -
-                      interOffset
-                : LinearIndex(Dims(srcMemCount.size(), 0), srcMemCount,
-                              VectorsOp(std::plus<size_t>(),
-                                        VectorsOp(std::minus<size_t>(),
-                                                  currentPoint, interStart),
-                                        srcMemStart),
-                              true);
-
-        const size_t destBeginOffset = helper::LinearIndex(
-            destStartFinal, destCountFinal, currentPoint, true);
-
-        CopyPayloadStride(src + srcBeginOffset, stride, dest + destBeginOffset,
-                          endianReverse, destType);
+    // copies the part of the intersection with outerBegin <= outermost
+    // coordinate < outerEnd
+    auto lf_Clip = [&](const size_t outerBegin, const size_t outerEnd) {
+        /// start iteration
+        Dims currentPoint(interStart); // current point for memory copy
+        currentPoint[0] = outerBegin;
+        bool run = true;
 
-        size_t p = startCoord;
-        while (true)
+        while (run)
         {
-            ++currentPoint[p];
-            if (currentPoint[p] > interStart[p] + interCount[p] - 1)
+
+            // here copy current linear memory between currentPoint and end
+            const size_t srcBeginOffset =
+                srcMemStart.empty()
+                    ? LinearIndex(srcStart, srcCount, currentPoint, true) -
+                          interOffset
+                    : LinearIndex(Dims(srcMemCount.size(), 0), srcMemCount,
+                                  VectorsOp(std::plus<size_t>(),
+                                            VectorsOp(std::minus<size_t>(),
+                                                      currentPoint, interStart),
+                                            srcMemStart),
+                                  true);
+
+            const size_t destBeginOffset = helper::LinearIndex(
+                destStartFinal, destCountFinal, currentPoint, true);
+
+            CopyPayloadStride(src + srcBeginOffset, stride,
+                              dest + destBeginOffset, endianReverse, destType);
+
+            size_t p = startCoord;
+            while (true)
             {
-                if (p == 0)
+                ++currentPoint[p];
+                const size_t end =
+                    (p == 0) ? outerEnd : interStart[p] + interCount[p];
+                if (currentPoint[p] >= end)
                 {
-                    run = false; // we are done
-                    break;
+                    if (p == 0)
+                    {
+                        run = false; // we are done
+                        break;
+                    }
+                    else
+                    {
+                        currentPoint[p] = interStart[p];
+                        --p;
+                    }
                 }
                 else
                 {
-                    currentPoint[p] = interStart[p];
-                    --p;
+                    break; // break inner p loop
                 }
-            }
-            else
-            {
-                break; // break inner p loop
-            }
-        } // dimension index update
-    }
+            } // dimension index update
+        }
+    };
+
+    ClipOuterRange(interStart[0], interCount[0], GetTotalSize(interCount),
+                   threads, pool, lf_Clip);
 }
 
 void ClipColumnMajor(char *dest, const Dims &destStart, const Dims &destCount,
@@ -163,7 +203,8 @@ void ClipColumnMajor(char *dest, const Dims &destStart, const Dims &destCount,
                      const Dims & /*destMemStart*/,
                      const Dims & /*destMemCount*/, const Dims &srcMemStart,
                      const Dims &srcMemCount, const bool endianReverse,
-                     const DataType destType)
+                     const DataType destType, const unsigned int threads,
+                     ThreadPool *pool)
 {
     const Dims destStartFinal = DestDimsFinal(destStart, destRowMajor, false);
     const Dims destCountFinal = DestDimsFinal(destCount, destRowMajor, false);
@@ -191,56 +232,67 @@ void ClipColumnMajor(char *dest, const Dims &destStart, const Dims &destCount,
     //        }
     //    }
 
-    /// start iteration
-    Dims currentPoint(interStart); // current point for memory copy
     const size_t interOffset =
         LinearIndex(srcStart, srcCount, interStart, false);
 
-    bool run = true;
+    // copies the part of the intersection with outerBegin <= outermost
+    // coordinate < outerEnd
+    auto lf_Clip = [&](const size_t outerBegin, const size_t outerEnd) {
+        /// start iteration
+        Dims currentPoint(interStart); // current point for memory copy
+        currentPoint[dimensions - 1] = outerBegin;
+        bool run = true;
 
-    while (run)
-    {
-        // here copy current linear memory between currentPoint and end
-        const size_t srcBeginOffset =
-            srcMemStart.empty()
-                ? LinearIndex(srcStart, srcCount, currentPoint, false) -
-                      interOffset
-                : LinearIndex(Dims(srcMemCount.size(), 0), srcMemCount,
-                              VectorsOp(std::plus<size_t>(),
-                                        VectorsOp(std::minus<size_t>(),
-                                                  currentPoint, interStart),
-                                        srcMemStart),
-                              false);
-
-        const size_t destBeginOffset = helper::LinearIndex(
-            destStartFinal, destCountFinal, currentPoint, false);
-
-        CopyPayloadStride(src + srcBeginOffset, stride, dest + destBeginOffset,
-                          endianReverse, destType);
-        size_t p = startCoord;
-
-        while (true)
+        while (run)
         {
-            ++currentPoint[p];
-            if (currentPoint[p] > interStart[p] + interCount[p] - 1)
+            // here copy current linear memory between currentPoint and end
+            const size_t srcBeginOffset =
+                srcMemStart.empty()
+                    ? LinearIndex(srcStart, srcCount, currentPoint, false) -
+                          interOffset
+                    : LinearIndex(Dims(srcMemCount.size(), 0), srcMemCount,
+                                  VectorsOp(std::plus<size_t>(),
+                                            VectorsOp(std::minus<size_t>(),
+                                                      currentPoint, interStart),
+                                            srcMemStart),
+                                  false);
+
+            const size_t destBeginOffset = helper::LinearIndex(
+                destStartFinal, destCountFinal, currentPoint, false);
+
+            CopyPayloadStride(src + srcBeginOffset, stride,
+                              dest + destBeginOffset, endianReverse, destType);
+            size_t p = startCoord;
+
+            while (true)
             {
-                if (p == dimensions - 1)
+                ++currentPoint[p];
+                const size_t end = (p == dimensions - 1)
+                                       ? outerEnd
+                                       : interStart[p] + interCount[p];
+                if (currentPoint[p] >= end)
                 {
-                    run = false; // we are done
-                    break;
+                    if (p == dimensions - 1)
+                    {
+                        run = false; // we are done
+                        break;
+                    }
+                    else
+                    {
+                        currentPoint[p] = interStart[p];
+                        ++p;
+                    }
                 }
                 else
                 {
-                    currentPoint[p] = interStart[p];
-                    ++p;
+                    break; // break inner p loop
                 }
-            }
-            else
-            {
-                break; // break inner p loop
-            }
-        } // dimension index update
-    }
+            } // dimension index update
+        }
+    };
+
+    ClipOuterRange(interStart[dimensions - 1], interCount[dimensions - 1],
+                   GetTotalSize(interCount), threads, pool, lf_Clip);
 }
 
 } // end empty namespace
@@ -250,7 +302,8 @@ void CopyPayload(char *dest, const Dims &destStart, const Dims &destCount,
                  const Dims &srcCount, const bool srcRowMajor,
                  const Dims &destMemStart, const Dims &destMemCount,
                  const Dims &srcMemStart, const Dims &srcMemCount,
-                 const bool endianReverse, const DataType destType) noexcept
+                 const bool endianReverse, const DataType destType,
+                 const unsigned int threads, ThreadPool *pool) noexcept
 {
     if (srcStart.size() == 1) // 1D copy memory
     {
@@ -276,16 +329,58 @@ void CopyPayload(char *dest, const Dims &destStart, const Dims &destCount,
     {
         ClipRowMajor(dest, destStart, destCount, destRowMajor, src, srcStart,
                      srcCount, destMemStart, destMemCount, srcMemStart,
-                     srcMemCount, endianReverse, destType);
+                     srcMemCount, endianReverse, destType, threads, pool);
     }
     else // stored with Fortran, R
     {
         ClipColumnMajor(dest, destStart, destCount, destRowMajor, src, srcStart,
                         srcCount, destMemStart, destMemCount, srcMemStart,
-                        srcMemCount, endianReverse, destType);
+                        srcMemCount, endianReverse, destType, threads,
+                        pool);
     }
 }
 
+void CopyStreaming(char *dest, const char *src, const size_t bytes) noexcept
+{
+#ifdef ADIOS2_STREAMING_X86
+    // streaming stores need 16 byte aligned destinations
+    const size_t misalign = reinterpret_cast<std::uintptr_t>(dest) % 16;
+    size_t i = std::min(bytes, misalign == 0 ? size_t(0) : 16 - misalign);
+    std::memcpy(dest, src, i);
+    for (; i + 64 <= bytes; i += 64)
+    {
+        const __m128i a =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        const __m128i b =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 16));
+        const __m128i c =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 32));
+        const __m128i d =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dest + i), a);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dest + i + 16), b);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dest + i + 32), c);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dest + i + 48), d);
+    }
+    for (; i + 16 <= bytes; i += 16)
+    {
+        _mm_stream_si128(
+            reinterpret_cast<__m128i *>(dest + i),
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i)));
+    }
+    std::memcpy(dest + i, src + i, bytes - i);
+#else
+    std::memcpy(dest, src, bytes);
+#endif
+}
+
+void StreamingFence() noexcept
+{
+#ifdef ADIOS2_STREAMING_X86
+    _mm_sfence();
+#endif
+}
+
 size_t PaddingToAlignPointer(const void *ptr)
 {
     auto memLocation = reinterpret_cast<std::uintptr_t>(ptr);
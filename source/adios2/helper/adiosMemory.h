@@ -18,6 +18,7 @@
 /// \endcond
 
 #include "adios2/common/ADIOSTypes.h"
+#include "adios2/helper/adiosThreadPool.h"
 
 namespace adios2
 {
@@ -60,11 +61,13 @@ void CopyToBuffer(std::vector<char> &buffer, size_t &position, const T *source,
  * @param source pointer to source data
  * @param elements number of elements of source type
  * @param threads number of threads sharing the copy load
+ * @param pool runs the threads, copied serially if nullptr
  */
 template <class T>
 void CopyToBufferThreads(std::vector<char> &buffer, size_t &position,
                          const T *source, const size_t elements = 1,
-                         const unsigned int threads = 1) noexcept;
+                         const unsigned int threads = 1,
+                         ThreadPool *pool = nullptr) noexcept;
 
 template <class T>
 void ReverseCopyFromBuffer(const std::vector<char> &buffer, size_t &position,
@@ -116,6 +119,8 @@ void ReadArray(const std::vector<char> &buffer, size_t &position, T *output,
  * @param destMemCount
  * @param srcMemStart
  * @param srcMemCount
+ * @param threads sharing the outermost dimension of the copy
+ * @param pool runs the threads, copied serially if nullptr
  */
 template <class T, class U>
 void CopyMemoryBlock(T *dest, const Dims &destStart, const Dims &destCount,
@@ -125,7 +130,9 @@ void CopyMemoryBlock(T *dest, const Dims &destStart, const Dims &destCount,
                      const Dims &destMemStart = Dims(),
                      const Dims &destMemCount = Dims(),
                      const Dims &srcMemStart = Dims(),
-                     const Dims &srcMemCount = Dims()) noexcept;
+                     const Dims &srcMemCount = Dims(),
+                     const unsigned int threads = 1,
+                     ThreadPool *pool = nullptr) noexcept;
 
 void CopyPayload(char *dest, const Dims &destStart, const Dims &destCount,
                  const bool destRowMajor, const char *src, const Dims &srcStart,
@@ -135,7 +142,38 @@ void CopyPayload(char *dest, const Dims &destStart, const Dims &destCount,
                  const Dims &srcMemStart = Dims(),
                  const Dims &srcMemCount = Dims(),
                  const bool endianReverse = false,
-                 const DataType destType = DataType::None) noexcept;
+                 const DataType destType = DataType::None,
+                 const unsigned int threads = 1,
+                 ThreadPool *pool = nullptr) noexcept;
+
+/**
+ * std::memcpy with non-temporal (streaming) stores where the CPU has them,
+ * so a large destination that is not read soon does not evict the cache.
+ * Stores may become visible to other threads only after StreamingFence.
+ * @param dest destination, may be unaligned
+ * @param src source, may be unaligned
+ * @param bytes to copy
+ */
+void CopyStreaming(char *dest, const char *src, const size_t bytes) noexcept;
+
+/** orders the CopyStreaming stores of this thread before its later stores */
+void StreamingFence() noexcept;
+
+/** NdCopy uses CopyStreaming when copying at least this many bytes in runs
+ * of at least NdCopyStreamingRun bytes */
+constexpr size_t NdCopyStreamingBytes = 32 * 1024 * 1024;
+constexpr size_t NdCopyStreamingRun = 256;
+
+/** NdCopy and CopyPayload copy smaller selections in the calling thread */
+constexpr size_t NdCopyThreadsBytes = 1024 * 1024;
+
+/**
+ * Reverses the bytes of each of elements elements of size ElementSize, with
+ * byte swap instructions for sizes 2, 4, 8 and 16
+ */
+template <size_t ElementSize>
+void ReverseElementBytes(char *dest, const char *src,
+                         const size_t elements) noexcept;
 
 /**
  * Clips the contiguous memory corresponding to an intersection and puts it in
@@ -223,6 +261,9 @@ void Resize(std::vector<T> &vec, const size_t dataSize, const std::string hint,
  *                 used by recursive algm is equal to the number of dimensions.
  *                 true: runs a bit slower, same algorithm using the explicit
  *                 stack/simulated stack which has more overhead for the algm.
+ * @param threads sharing the outer dimensions of overlaps of at least
+ *                NdCopyThreadsBytes
+ * @param pool runs the threads, copied serially if nullptr
  */
 
 template <class T>
@@ -231,7 +272,8 @@ int NdCopy(const char *in, const Dims &inStart, const Dims &inCount,
            const Dims &outStart, const Dims &outCount, const bool outIsRowMajor,
            const bool outIsLittleEndian, const Dims &inMemStart = Dims(),
            const Dims &inMemCount = Dims(), const Dims &outMemStart = Dims(),
-           const Dims &outMemCount = Dims(), const bool safeMode = false);
+           const Dims &outMemCount = Dims(), const bool safeMode = false,
+           const unsigned int threads = 1, ThreadPool *pool = nullptr);
 
 template <class T>
 size_t PayloadSize(const T *data, const Dims &count) noexcept;
@@ -16,9 +16,10 @@
 
 /// \cond EXCLUDE_FROM_DOXYGEN
 #include <algorithm> //std::copy, std::reverse_copy
-#include <cstring>   //std::memcpy
+#include <cstdint>
+#include <cstring> //std::memcpy
+#include <functional>
 #include <iostream>
-#include <thread>
 /// \endcond
 
 #include "adios2/helper/adiosMath.h"
@@ -86,14 +87,14 @@ void CopyToBuffer(std::vector<char> &buffer, size_t &position, const T *source,
 template <class T>
 void CopyToBufferThreads(std::vector<char> &buffer, size_t &position,
                          const T *source, const size_t elements,
-                         const unsigned int threads) noexcept
+                         const unsigned int threads, ThreadPool *pool) noexcept
 {
     if (elements == 0)
     {
         return;
     }
 
-    if (threads == 1 || threads > elements)
+    if (threads <= 1 || threads > elements || pool == nullptr)
     {
         CopyToBuffer(buffer, position, source, elements);
         return;
@@ -103,45 +104,15 @@ void CopyToBufferThreads(std::vector<char> &buffer, size_t &position,
     const size_t remainder = elements % threads; // remainder if not aligned
     const size_t last = stride + remainder;
 
-    std::vector<std::thread> copyThreads;
-    copyThreads.reserve(threads);
-
     const char *src = reinterpret_cast<const char *>(source);
 
-    for (unsigned int t = 0; t < threads; ++t)
-    {
+    pool->ParallelFor(threads, threads, [&](const size_t t) {
         const size_t bufferStart = position + stride * t * sizeof(T);
         const size_t srcStart = stride * t * sizeof(T);
-        if (t == threads - 1) // last thread takes stride + remainder
-        {
-            copyThreads.push_back(std::thread(std::memcpy, &buffer[bufferStart],
-                                              &src[srcStart],
-                                              last * sizeof(T)));
-            // std::copy not working properly with std::thread...why?
-            //            copyThreads.push_back(std::thread(std::copy,
-            //            &src[srcStart],
-            //                                              &src[srcStart] +
-            //                                              last * sizeof(T),
-            //                                              buffer.begin() +
-            //                                              bufferStart));
-        }
-        else
-        {
-            copyThreads.push_back(std::thread(std::memcpy, &buffer[bufferStart],
-                                              &src[srcStart],
-                                              stride * sizeof(T)));
-            // std::copy not working properly with std::thread...why?
-            //            copyThreads.push_back(std::thread(
-            //                std::copy, &src[srcStart], &src[srcStart] + stride
-            //                * sizeof(T),
-            //                buffer.begin() + bufferStart));
-        }
-    }
-
-    for (auto &copyThread : copyThreads)
-    {
-        copyThread.join();
-    }
+        // last thread takes stride + remainder
+        const size_t bytes = ((t == threads - 1) ? last : stride) * sizeof(T);
+        std::memcpy(&buffer[bufferStart], &src[srcStart], bytes);
+    });
 
     position += elements * sizeof(T);
 }
@@ -318,7 +289,8 @@ void CopyMemoryBlock(T *dest, const Dims &destStart, const Dims &destCount,
                      const Dims &srcStart, const Dims &srcCount,
                      const bool srcRowMajor, const bool endianReverse,
                      const Dims &destMemStart, const Dims &destMemCount,
-                     const Dims &srcMemStart, const Dims &srcMemCount) noexcept
+                     const Dims &srcMemStart, const Dims &srcMemCount,
+                     const unsigned int threads, ThreadPool *pool) noexcept
 {
     // transform everything to payload dims
     const Dims destStartPayload = PayloadDims<T>(destStart, destRowMajor);
@@ -336,7 +308,7 @@ void CopyMemoryBlock(T *dest, const Dims &destStart, const Dims &destCount,
                 reinterpret_cast<const char *>(src), srcStartPayload,
                 srcCountPayload, srcRowMajor, destMemStartPayload,
                 destMemCountPayload, srcMemStartPayload, srcMemCountPayload,
-                endianReverse, GetDataType<T>());
+                endianReverse, GetDataType<T>(), threads, pool);
 }
 
 template <class T>
@@ -612,6 +584,111 @@ void Resize(std::vector<T> &vec, const size_t dataSize, const std::string hint,
     }
 }
 
+template <size_t ElementSize>
+inline void ReverseElementBytes(char *dest, const char *src,
+                                const size_t elements) noexcept
+{
+    for (size_t e = 0; e < elements; ++e)
+    {
+        for (size_t j = 0; j < ElementSize; ++j)
+        {
+            dest[j] = src[ElementSize - 1 - j];
+        }
+        dest += ElementSize;
+        src += ElementSize;
+    }
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+inline uint16_t ByteSwap(const uint16_t v) noexcept
+{
+    return __builtin_bswap16(v);
+}
+inline uint32_t ByteSwap(const uint32_t v) noexcept
+{
+    return __builtin_bswap32(v);
+}
+inline uint64_t ByteSwap(const uint64_t v) noexcept
+{
+    return __builtin_bswap64(v);
+}
+#else
+inline uint16_t ByteSwap(const uint16_t v) noexcept
+{
+    return static_cast<uint16_t>((v << 8) | (v >> 8));
+}
+inline uint32_t ByteSwap(const uint32_t v) noexcept
+{
+    return ((v & 0x000000FFu) << 24) | ((v & 0x0000FF00u) << 8) |
+           ((v & 0x00FF0000u) >> 8) | ((v & 0xFF000000u) >> 24);
+}
+inline uint64_t ByteSwap(const uint64_t v) noexcept
+{
+    return (static_cast<uint64_t>(ByteSwap(static_cast<uint32_t>(v))) << 32) |
+           ByteSwap(static_cast<uint32_t>(v >> 32));
+}
+#endif
+
+/** elements of the size of U, swapped as U values, std::memcpy leaves the
+ * alignment of src and dest unconstrained */
+template <class U>
+inline void ReverseElementBytesAs(char *dest, const char *src,
+                                  const size_t elements) noexcept
+{
+    for (size_t e = 0; e < elements; ++e)
+    {
+        U v;
+        std::memcpy(&v, src + e * sizeof(U), sizeof(U));
+        v = ByteSwap(v);
+        std::memcpy(dest + e * sizeof(U), &v, sizeof(U));
+    }
+}
+
+template <>
+inline void ReverseElementBytes<1>(char *dest, const char *src,
+                                   const size_t elements) noexcept
+{
+    std::memcpy(dest, src, elements);
+}
+
+template <>
+inline void ReverseElementBytes<2>(char *dest, const char *src,
+                                   const size_t elements) noexcept
+{
+    ReverseElementBytesAs<uint16_t>(dest, src, elements);
+}
+
+template <>
+inline void ReverseElementBytes<4>(char *dest, const char *src,
+                                   const size_t elements) noexcept
+{
+    ReverseElementBytesAs<uint32_t>(dest, src, elements);
+}
+
+template <>
+inline void ReverseElementBytes<8>(char *dest, const char *src,
+                                   const size_t elements) noexcept
+{
+    ReverseElementBytesAs<uint64_t>(dest, src, elements);
+}
+
+template <>
+inline void ReverseElementBytes<16>(char *dest, const char *src,
+                                    const size_t elements) noexcept
+{
+    // the swapped upper half becomes the lower half
+    for (size_t e = 0; e < elements; ++e)
+    {
+        uint64_t low, high;
+        std::memcpy(&low, src + 16 * e, 8);
+        std::memcpy(&high, src + 16 * e + 8, 8);
+        low = ByteSwap(low);
+        high = ByteSwap(high);
+        std::memcpy(dest + 16 * e, &high, 8);
+        std::memcpy(dest + 16 * e + 8, &low, 8);
+    }
+}
+
 //***************Start of NdCopy() and its 8 helpers ***************
 // Author:Shawn Yang, shawnyang610@gmail.com
 //
@@ -666,35 +743,30 @@ static void NdCopyRecurDFSeqPadding(size_t curDim, const char *&inOvlpBase,
 // each element is minimized to average O(1), which is independent of
 // the number of dimensions.
 
+template <size_t ElmSize>
 static void
 NdCopyRecurDFSeqPaddingRevEndian(size_t curDim, const char *&inOvlpBase,
                                  char *&outOvlpBase, Dims &inOvlpGapSize,
                                  Dims &outOvlpGapSize, Dims &ovlpCount,
                                  size_t minCountDim, size_t blockSize,
-                                 size_t elmSize, size_t numElmsPerBlock)
+                                 size_t numElmsPerBlock)
 {
     if (curDim == minCountDim)
     {
         // each byte of each element in the continuous block needs
         // to be copied in reverse order
-        for (size_t i = 0; i < numElmsPerBlock; i++)
-        {
-            for (size_t j = 0; j < elmSize; j++)
-            {
-                outOvlpBase[j] = inOvlpBase[elmSize - 1 - j];
-            }
-            inOvlpBase += elmSize;
-            outOvlpBase += elmSize;
-        }
+        ReverseElementBytes<ElmSize>(outOvlpBase, inOvlpBase, numElmsPerBlock);
+        inOvlpBase += blockSize;
+        outOvlpBase += blockSize;
     }
     // case: curDim<minCountDim
     else
     {
         for (size_t i = 0; i < ovlpCount[curDim]; i++)
         {
-            NdCopyRecurDFSeqPaddingRevEndian(
+            NdCopyRecurDFSeqPaddingRevEndian<ElmSize>(
                 curDim + 1, inOvlpBase, outOvlpBase, inOvlpGapSize,
-                outOvlpGapSize, ovlpCount, minCountDim, blockSize, elmSize,
+                outOvlpGapSize, ovlpCount, minCountDim, blockSize,
                 numElmsPerBlock);
         }
     }
@@ -737,28 +809,25 @@ static void NdCopyRecurDFNonSeqDynamic(size_t curDim, const char *inBase,
 // The memory address calculation complexity for copying each element is
 // minimized to average O(1), which is independent of the number of dimensions.
 
+template <size_t ElmSize>
 static void NdCopyRecurDFNonSeqDynamicRevEndian(
     size_t curDim, const char *inBase, char *outBase, Dims &inRltvOvlpSPos,
-    Dims &outRltvOvlpSPos, Dims &inStride, Dims &outStride, Dims &ovlpCount,
-    size_t elmSize)
+    Dims &outRltvOvlpSPos, Dims &inStride, Dims &outStride, Dims &ovlpCount)
 {
     if (curDim == inStride.size())
     {
-        for (size_t i = 0; i < elmSize; i++)
-        {
-            outBase[i] = inBase[elmSize - 1 - i];
-        }
+        ReverseElementBytes<ElmSize>(outBase, inBase, 1);
     }
     else
     {
         for (size_t i = 0; i < ovlpCount[curDim]; i++)
         {
-            NdCopyRecurDFNonSeqDynamicRevEndian(
+            NdCopyRecurDFNonSeqDynamicRevEndian<ElmSize>(
                 curDim + 1,
                 inBase + (inRltvOvlpSPos[curDim] + i) * inStride[curDim],
                 outBase + (outRltvOvlpSPos[curDim] + i) * outStride[curDim],
-                inRltvOvlpSPos, outRltvOvlpSPos, inStride, outStride, ovlpCount,
-                elmSize);
+                inRltvOvlpSPos, outRltvOvlpSPos, inStride, outStride,
+                ovlpCount);
         }
     }
 }
@@ -794,10 +863,11 @@ static void NdCopyIterDFSeqPadding(const char *&inOvlpBase, char *&outOvlpBase,
     }
 }
 
+template <size_t ElmSize>
 static void NdCopyIterDFSeqPaddingRevEndian(
     const char *&inOvlpBase, char *&outOvlpBase, Dims &inOvlpGapSize,
     Dims &outOvlpGapSize, Dims &ovlpCount, size_t minContDim, size_t blockSize,
-    size_t elmSize, size_t numElmsPerBlock)
+    size_t numElmsPerBlock)
 {
     Dims pos(ovlpCount.size(), 0);
     size_t curDim = 0;
@@ -808,15 +878,9 @@ static void NdCopyIterDFSeqPaddingRevEndian(
             pos[curDim]++;
             curDim++;
         }
-        for (size_t i = 0; i < numElmsPerBlock; i++)
-        {
-            for (size_t j = 0; j < elmSize; j++)
-            {
-                outOvlpBase[j] = inOvlpBase[elmSize - 1 - j];
-            }
-            inOvlpBase += elmSize;
-            outOvlpBase += elmSize;
-        }
+        ReverseElementBytes<ElmSize>(outOvlpBase, inOvlpBase, numElmsPerBlock);
+        inOvlpBase += blockSize;
+        outOvlpBase += blockSize;
         do
         {
             if (curDim == 0)
@@ -867,11 +931,11 @@ static void NdCopyIterDFDynamic(const char *inBase, char *outBase,
     }
 }
 
+template <size_t ElmSize>
 static void NdCopyIterDFDynamicRevEndian(const char *inBase, char *outBase,
                                          Dims &inRltvOvlpSPos,
                                          Dims &outRltvOvlpSPos, Dims &inStride,
-                                         Dims &outStride, Dims &ovlpCount,
-                                         size_t elmSize)
+                                         Dims &outStride, Dims &ovlpCount)
 {
     size_t curDim = 0;
     Dims pos(ovlpCount.size() + 1, 0);
@@ -892,10 +956,7 @@ static void NdCopyIterDFDynamicRevEndian(const char *inBase, char *outBase,
             pos[curDim]++;
             curDim++;
         }
-        for (size_t i = 0; i < elmSize; i++)
-        {
-            outAddr[curDim][i] = inAddr[curDim][elmSize - 1 - i];
-        }
+        ReverseElementBytes<ElmSize>(outAddr[curDim], inAddr[curDim], 1);
         do
         {
             if (curDim == 0)
@@ -908,13 +969,54 @@ static void NdCopyIterDFDynamicRevEndian(const char *inBase, char *outBase,
     }
 }
 
+// NdCopyRunsSeqPadding(): helper function
+// Copies the runs [firstRun, endRun) of a row major overlap, a run being the
+// contiguous block below minContDim. Runs are numbered in the order of
+// dimensions 0 to minContDim - 1, so threads can copy ranges of them. The
+// start of a run is computed once per range, then advanced like an odometer.
+template <class CopyRun>
+static void NdCopyRunsSeqPadding(const char *inOvlpBase, char *outOvlpBase,
+                                 const Dims &inStride, const Dims &outStride,
+                                 const Dims &ovlpCount, size_t minContDim,
+                                 size_t blockSize, size_t firstRun,
+                                 size_t endRun, const CopyRun &copyRun)
+{
+    Dims pos(minContDim);
+    size_t rest = firstRun;
+    for (size_t d = minContDim; d-- > 0;)
+    {
+        pos[d] = rest % ovlpCount[d];
+        rest /= ovlpCount[d];
+        inOvlpBase += pos[d] * inStride[d];
+        outOvlpBase += pos[d] * outStride[d];
+    }
+
+    for (size_t run = firstRun; run < endRun; ++run)
+    {
+        copyRun(outOvlpBase, inOvlpBase, blockSize);
+        for (size_t d = minContDim; d-- > 0;)
+        {
+            inOvlpBase += inStride[d];
+            outOvlpBase += outStride[d];
+            if (++pos[d] < ovlpCount[d])
+            {
+                break;
+            }
+            inOvlpBase -= ovlpCount[d] * inStride[d];
+            outOvlpBase -= ovlpCount[d] * outStride[d];
+            pos[d] = 0;
+        }
+    }
+}
+
 template <class T>
 int NdCopy(const char *in, const Dims &inStart, const Dims &inCount,
            const bool inIsRowMajor, const bool inIsLittleEndian, char *out,
            const Dims &outStart, const Dims &outCount, const bool outIsRowMajor,
            const bool outIsLittleEndian, const Dims &inMemStart,
            const Dims &inMemCount, const Dims &outMemStart,
-           const Dims &outMemCount, const bool safeMode)
+           const Dims &outMemCount, const bool safeMode,
+           const unsigned int threads, ThreadPool *pool)
 
 {
 
@@ -1101,9 +1203,90 @@ int NdCopy(const char *in, const Dims &inStart, const Dims &inCount,
         GetOutOvlpBase(outOvlpBase, out, outMemStartNC, outStride, ovlpStart);
         minContDim = GetMinContDim(inMemCountNC, outMemCountNC, ovlpCount);
         blockSize = GetBlockSize(ovlpCount, minContDim, sizeof(T));
+
+        size_t runs = 1;
+        for (size_t i = 0; i < minContDim; i++)
+        {
+            runs *= ovlpCount[i];
+        }
+        const size_t ovlpBytes = runs * blockSize;
+        const bool revEndian = inIsLittleEndian != outIsLittleEndian;
+        // large copies bypass the cache, the selection is not read soon
+        const bool streaming = !revEndian &&
+                               ovlpBytes >= NdCopyStreamingBytes &&
+                               blockSize >= NdCopyStreamingRun;
+        const bool parallel = pool != nullptr && threads > 1 &&
+                              ovlpBytes >= NdCopyThreadsBytes;
+        if (streaming || parallel)
+        {
+            auto lf_CopyRun = [&](char *outRun, const char *inRun,
+                                  const size_t bytes) {
+                if (revEndian)
+                {
+                    ReverseElementBytes<sizeof(T)>(outRun, inRun,
+                                                   bytes / sizeof(T));
+                }
+                else if (streaming)
+                {
+                    CopyStreaming(outRun, inRun, bytes);
+                }
+                else
+                {
+                    std::memcpy(outRun, inRun, bytes);
+                }
+            };
+
+            // a few pieces per thread, threads finishing early take the next
+            const size_t pieces =
+                parallel ? static_cast<size_t>(threads) * 4 : 1;
+            std::function<void(size_t)> lf_CopyPiece;
+            size_t nPieces;
+            if (runs == 1)
+            {
+                // a single contiguous block, split at element boundaries
+                const size_t elements = blockSize / sizeof(T);
+                nPieces = std::max(std::min(pieces, elements), size_t(1));
+                lf_CopyPiece = [&](const size_t p) {
+                    const size_t first = elements * p / nPieces * sizeof(T);
+                    const size_t end =
+                        elements * (p + 1) / nPieces * sizeof(T);
+                    lf_CopyRun(outOvlpBase + first, inOvlpBase + first,
+                               end - first);
+                };
+            }
+            else
+            {
+                nPieces = std::min(pieces, runs);
+                lf_CopyPiece = [&](const size_t p) {
+                    NdCopyRunsSeqPadding(inOvlpBase, outOvlpBase, inStride,
+                                         outStride, ovlpCount, minContDim,
+                                         blockSize, runs * p / nPieces,
+                                         runs * (p + 1) / nPieces, lf_CopyRun);
+                };
+            }
+
+            auto lf_CopyPieceFenced = [&](const size_t p) {
+                lf_CopyPiece(p);
+                if (streaming)
+                {
+                    StreamingFence();
+                }
+            };
+            if (parallel)
+            {
+                pool->ParallelFor(nPieces, threads, lf_CopyPieceFenced);
+            }
+            else
+            {
+                for (size_t p = 0; p < nPieces; ++p)
+                {
+                    lf_CopyPieceFenced(p);
+                }
+            }
+        }
         // same endianess mode: most optimized, contiguous data copying
         // algorithm used.
-        if (inIsLittleEndian == outIsLittleEndian)
+        else if (!revEndian)
         {
             // most efficient algm
             // warning: number of function stacks used is number of dimensions
@@ -1129,17 +1312,15 @@ int NdCopy(const char *in, const Dims &inStart, const Dims &inCount,
         {
             if (!safeMode)
             {
-                NdCopyRecurDFSeqPaddingRevEndian(
+                NdCopyRecurDFSeqPaddingRevEndian<sizeof(T)>(
                     0, inOvlpBase, outOvlpBase, inOvlpGapSize, outOvlpGapSize,
-                    ovlpCount, minContDim, blockSize, sizeof(T),
-                    blockSize / sizeof(T));
+                    ovlpCount, minContDim, blockSize, blockSize / sizeof(T));
             }
             else
             {
-                NdCopyIterDFSeqPaddingRevEndian(
+                NdCopyIterDFSeqPaddingRevEndian<sizeof(T)>(
                     inOvlpBase, outOvlpBase, inOvlpGapSize, outOvlpGapSize,
-                    ovlpCount, minContDim, blockSize, sizeof(T),
-                    blockSize / sizeof(T));
+                    ovlpCount, minContDim, blockSize, blockSize / sizeof(T));
             }
         }
     }
@@ -1245,8 +1426,35 @@ int NdCopy(const char *in, const Dims &inStart, const Dims &inCount,
 
         inOvlpBase = in;
         outOvlpBase = out;
+
+        const size_t ovlpBytes = GetTotalSize(ovlpCount) * sizeof(T);
+        if (!safeMode && pool != nullptr && threads > 1 &&
+            ovlpCount[0] > 1 && ovlpBytes >= NdCopyThreadsBytes)
+        {
+            // threads take the elements of dimension 0, the depth-first
+            // copy continues from dimension 1 below each
+            pool->ParallelFor(ovlpCount[0], threads, [&](const size_t i) {
+                const char *inBase =
+                    inOvlpBase + (inRltvOvlpStartPos[0] + i) * inStride[0];
+                char *outBase =
+                    outOvlpBase + (outRltvOvlpStartPos[0] + i) * outStride[0];
+                if (inIsLittleEndian == outIsLittleEndian)
+                {
+                    NdCopyRecurDFNonSeqDynamic(
+                        1, inBase, outBase, inRltvOvlpStartPos,
+                        outRltvOvlpStartPos, inStride, outStride, ovlpCount,
+                        sizeof(T));
+                }
+                else
+                {
+                    NdCopyRecurDFNonSeqDynamicRevEndian<sizeof(T)>(
+                        1, inBase, outBase, inRltvOvlpStartPos,
+                        outRltvOvlpStartPos, inStride, outStride, ovlpCount);
+                }
+            });
+        }
         // Same Endian"
-        if (inIsLittleEndian == outIsLittleEndian)
+        else if (inIsLittleEndian == outIsLittleEndian)
         {
             if (!safeMode)
             {
@@ -1267,17 +1475,15 @@ int NdCopy(const char *in, const Dims &inStart, const Dims &inCount,
         {
             if (!safeMode)
             {
-                NdCopyRecurDFNonSeqDynamicRevEndian(
+                NdCopyRecurDFNonSeqDynamicRevEndian<sizeof(T)>(
                     0, inOvlpBase, outOvlpBase, inRltvOvlpStartPos,
-                    outRltvOvlpStartPos, inStride, outStride, ovlpCount,
-                    sizeof(T));
+                    outRltvOvlpStartPos, inStride, outStride, ovlpCount);
             }
             else
             {
-                NdCopyIterDFDynamicRevEndian(inOvlpBase, outOvlpBase,
-                                             inRltvOvlpStartPos,
-                                             outRltvOvlpStartPos, inStride,
-                                             outStride, ovlpCount, sizeof(T));
+                NdCopyIterDFDynamicRevEndian<sizeof(T)>(
+                    inOvlpBase, outOvlpBase, inRltvOvlpStartPos,
+                    outRltvOvlpStartPos, inStride, outStride, ovlpCount);
             }
         }
     }
@@ -0,0 +1,199 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * adiosThreadPool.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "adiosThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace adios2
+{
+namespace helper
+{
+
+struct ThreadPool::Loop
+{
+    const std::function<void(size_t)> &Task;
+    const size_t Count;
+    std::atomic<size_t> Next;
+    /** workers that may still join, guarded by the pool mutex */
+    size_t FreeSlots;
+    /** workers running iterations, guarded by the pool mutex */
+    size_t Active = 0;
+    std::condition_variable Finished;
+
+    std::mutex ErrorMutex;
+    std::exception_ptr Error;
+
+    Loop(const std::function<void(size_t)> &task, const size_t count,
+         const size_t freeSlots)
+    : Task(task), Count(count), Next(0), FreeSlots(freeSlots)
+    {
+    }
+
+    /** runs iterations until none is left */
+    void Run() noexcept
+    {
+        size_t i;
+        while ((i = Next++) < Count)
+        {
+            try
+            {
+                Task(i);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(ErrorMutex);
+                if (!Error)
+                {
+                    Error = std::current_exception();
+                }
+                Next = Count;
+            }
+        }
+    }
+};
+
+ThreadPool::ThreadPool(const size_t maxWorkers, const bool pin)
+: m_MaxWorkers(maxWorkers > 0
+                   ? maxWorkers
+                   : std::max(std::thread::hardware_concurrency(), 1u) - 1),
+  m_Pin(pin)
+{
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stop = true;
+    }
+    m_WorkAvailable.notify_all();
+    for (auto &worker : m_Workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::ParallelFor(const size_t count, const unsigned int threads,
+                             const std::function<void(size_t)> &task)
+{
+    const size_t helpers =
+        std::min({static_cast<size_t>(threads > 0 ? threads - 1 : 0),
+                  count > 0 ? count - 1 : 0, m_MaxWorkers});
+    if (helpers == 0)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    auto loop = std::make_shared<Loop>(task, count, helpers);
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        StartWorkers(helpers);
+        m_Loops.push_back(loop);
+    }
+    for (size_t h = 0; h < helpers; ++h)
+    {
+        m_WorkAvailable.notify_one();
+    }
+
+    loop->Run();
+
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        // workers still queued for it have nothing left to do
+        auto it = std::find(m_Loops.begin(), m_Loops.end(), loop);
+        if (it != m_Loops.end())
+        {
+            m_Loops.erase(it);
+        }
+        loop->Finished.wait(lock, [&]() { return loop->Active == 0; });
+    }
+
+    if (loop->Error)
+    {
+        std::rethrow_exception(loop->Error);
+    }
+}
+
+size_t ThreadPool::MaxWorkers() const noexcept { return m_MaxWorkers; }
+
+size_t ThreadPool::Workers() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Workers.size();
+}
+
+void ThreadPool::StartWorkers(const size_t workers)
+{
+    // called with m_Mutex held
+    while (m_Workers.size() < std::min(workers, m_MaxWorkers))
+    {
+        m_Workers.emplace_back(&ThreadPool::WorkerMain, this,
+                               m_Workers.size());
+    }
+}
+
+void ThreadPool::WorkerMain(const size_t id)
+{
+#ifdef __linux__
+    if (m_Pin)
+    {
+        const unsigned int hwThreads =
+            std::max(std::thread::hardware_concurrency(), 1u);
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET((id + 1) % hwThreads, &cpuSet);
+        // best effort, running unpinned is not an error
+        pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+    }
+#else
+    (void)id;
+#endif
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true)
+    {
+        m_WorkAvailable.wait(lock,
+                             [&]() { return m_Stop || !m_Loops.empty(); });
+        if (m_Stop)
+        {
+            return;
+        }
+
+        std::shared_ptr<Loop> loop = m_Loops.front();
+        if (--loop->FreeSlots == 0)
+        {
+            m_Loops.pop_front();
+        }
+        ++loop->Active;
+
+        lock.unlock();
+        loop->Run();
+        lock.lock();
+
+        if (--loop->Active == 0)
+        {
+            loop->Finished.notify_all();
+        }
+    }
+}
+
+} // end namespace helper
+} // end namespace adios2
@@ -0,0 +1,89 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * adiosThreadPool.h : persistent worker threads running parallel loops, shared
+ * by all engines of an ADIOS object instead of starting threads per call
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef ADIOS2_HELPER_ADIOSTHREADPOOL_H_
+#define ADIOS2_HELPER_ADIOSTHREADPOOL_H_
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+/// \endcond
+
+#include "adios2/common/ADIOSConfig.h"
+
+namespace adios2
+{
+namespace helper
+{
+
+/**
+ * Workers are started on demand by the first loops needing them and kept
+ * until destruction. Loops are fork-join: the calling thread runs iterations
+ * too, and idle workers join any running loop to take its next iterations, so
+ * uneven iterations balance out and loops may be nested inside iterations.
+ */
+class ThreadPool
+{
+public:
+    /**
+     * @param maxWorkers upper bound of worker threads, 0: one less than the
+     * hardware threads, the caller of a loop being the last one
+     * @param pin bind worker i to processor i + 1, Linux only
+     */
+    ThreadPool(const size_t maxWorkers = 0, const bool pin = false);
+
+    /** joins the workers, loops must have returned */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * Calls task(i) for every i in [0, count), returns once all calls
+     * returned. The first exception thrown by a task is rethrown, iterations
+     * not started by then are skipped.
+     * @param threads upper bound of threads running the loop, the caller
+     * included, 0 or 1 runs it in the caller
+     */
+    void ParallelFor(const size_t count, const unsigned int threads,
+                     const std::function<void(size_t)> &task);
+
+    /** upper bound of worker threads */
+    size_t MaxWorkers() const noexcept;
+
+    /** worker threads started so far */
+    size_t Workers() const;
+
+private:
+    struct Loop;
+
+    const size_t m_MaxWorkers;
+    const bool m_Pin;
+
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_WorkAvailable;
+    /** loops still accepting workers, oldest first */
+    std::deque<std::shared_ptr<Loop>> m_Loops;
+    std::vector<std::thread> m_Workers;
+    bool m_Stop = false;
+
+    void StartWorkers(const size_t workers);
+    void WorkerMain(const size_t id);
+};
+
+} // end namespace helper
+} // end namespace adios2
+
+#endif /* ADIOS2_HELPER_ADIOSTHREADPOOL_H_ */
@@ -33,6 +33,25 @@ void MPIAggregator::Init(const size_t subStreams,
 {
 }
 
+MPIAggregator::ExchangeRequests MPIAggregator::IExchange(format::Buffer &,
+                                                         const int)
+{
+    return {};
+}
+
+MPIAggregator::ExchangeAbsolutePositionRequests
+MPIAggregator::IExchangeAbsolutePosition(format::Buffer &, const int)
+{
+    return {};
+}
+
+void MPIAggregator::WaitAbsolutePosition(ExchangeAbsolutePositionRequests &,
+                                         const int)
+{
+}
+
+void MPIAggregator::Wait(ExchangeRequests &, const int) {}
+
 void MPIAggregator::SwapBuffers(const int step) noexcept {}
 
 void MPIAggregator::ResetBuffers() noexcept {}
@@ -66,8 +66,9 @@ public:
         helper::Comm::Req m_RecvData;
     };
 
-    virtual ExchangeRequests IExchange(format::Buffer &buffer,
-                                       const int step) = 0;
+    /** Buffer exchange of the BP3/BP4 chain protocol, the defaults do not
+     * exchange anything */
+    virtual ExchangeRequests IExchange(format::Buffer &buffer, const int step);
 
     struct ExchangeAbsolutePositionRequests
     {
@@ -76,13 +77,13 @@ public:
     };
 
     virtual ExchangeAbsolutePositionRequests
-    IExchangeAbsolutePosition(format::Buffer &buffer, const int step) = 0;
+    IExchangeAbsolutePosition(format::Buffer &buffer, const int step);
 
     virtual void
     WaitAbsolutePosition(ExchangeAbsolutePositionRequests &requests,
-                         const int step) = 0;
+                         const int step);
 
-    virtual void Wait(ExchangeRequests &requests, const int step) = 0;
+    virtual void Wait(ExchangeRequests &requests, const int step);
 
     virtual void SwapBuffers(const int step) noexcept;
 
@@ -91,7 +92,7 @@ public:
     virtual format::Buffer &GetConsumerBuffer(format::Buffer &buffer);
 
     /** closes current aggregator, frees m_Comm */
-    void Close();
+    virtual void Close();
 
 protected:
     /** Init m_Comm splitting assigning ranks to subStreams (balanced except for
@@ -0,0 +1,128 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * MPIShmChain.cpp
+ *
+ */
+#include "MPIShmChain.h"
+
+#include <algorithm> // std::min, std::max
+
+namespace adios2
+{
+namespace aggregator
+{
+
+MPIShmChain::MPIShmChain() : MPIAggregator() {}
+
+void MPIShmChain::Init(const size_t subStreams, helper::Comm const &parentComm)
+{
+    const std::string hint("creating TwoLevelShm aggregator setup at Open");
+
+    helper::Comm nodeComm = parentComm.GroupByShm(hint);
+    const size_t nodeRank = static_cast<size_t>(nodeComm.Rank());
+    const size_t nodeSize = static_cast<size_t>(nodeComm.Size());
+
+    /* Number of nodes and index of this node, from the chain of rank 0s */
+    const int color = (nodeRank ? 1 : 0);
+    helper::Comm onePerNodeComm =
+        parentComm.Split(color, parentComm.Rank(), hint);
+    size_t nodeIndex = 0;
+    size_t nodes = 0;
+    if (!nodeRank)
+    {
+        nodeIndex = static_cast<size_t>(onePerNodeComm.Rank());
+        nodes = static_cast<size_t>(onePerNodeComm.Size());
+    }
+    nodeIndex = nodeComm.BroadcastValue<size_t>(nodeIndex, 0);
+    nodes = nodeComm.BroadcastValue<size_t>(nodes, 0);
+
+    /* Aggregators per node, subfile indices stay unique if a node has fewer
+     * processes than that */
+    const size_t perNode =
+        (subStreams > 0) ? std::max<size_t>(1, (subStreams + nodes - 1) / nodes)
+                         : 1;
+    const size_t groups = std::min(perNode, nodeSize);
+
+    /* Divide the node's processes into balanced groups, the first process of
+     * each group is its aggregator */
+    const size_t q = nodeSize / groups;
+    const size_t r = nodeSize % groups;
+    const size_t firstInSmallGroups = r * (q + 1);
+    const size_t group = (nodeRank >= firstInSmallGroups)
+                             ? r + (nodeRank - firstInSmallGroups) / q
+                             : nodeRank / (q + 1);
+
+    m_Comm = nodeComm.Split(static_cast<int>(group),
+                            static_cast<int>(nodeRank), hint);
+    m_Rank = m_Comm.Rank();
+    m_Size = m_Comm.Size();
+    m_IsAggregator = (m_Rank == 0);
+    m_IsActive = true;
+
+    m_SubStreams = nodes * perNode;
+    m_SubStreamIndex = nodeIndex * perNode + group;
+    m_AggregatorRank = m_Comm.BroadcastValue<int>(parentComm.Rank(), 0);
+    HandshakeRank(0);
+}
+
+void MPIShmChain::Close()
+{
+    if (m_IsActive)
+    {
+        FreeSegments();
+    }
+    MPIAggregator::Close();
+}
+
+void MPIShmChain::AllocateSegments(const size_t segmentSize)
+{
+    if (!m_Win.IsEmpty() && segmentSize <= m_SegmentSize)
+    {
+        return;
+    }
+    FreeSegments();
+
+    // the aggregator only reads the other segments, it needs none
+    char *base = nullptr;
+    m_Win = m_Comm.Win_allocate_shared(m_IsAggregator ? 0 : segmentSize, 1,
+                                       &base,
+                                       "in MPIShmChain::AllocateSegments");
+    m_SegmentSize = segmentSize;
+
+    m_Segments.assign(static_cast<size_t>(m_Size), nullptr);
+    for (int i = 1; i < m_Size; ++i)
+    {
+        size_t size;
+        int dispUnit;
+        m_Comm.Win_shared_query(m_Win, i, &size, &dispUnit, &m_Segments[i],
+                                "in MPIShmChain::AllocateSegments");
+    }
+}
+
+size_t MPIShmChain::SegmentSize() const noexcept { return m_SegmentSize; }
+
+char *MPIShmChain::Segment(const int rank) noexcept
+{
+    return m_Segments.empty() ? nullptr : m_Segments[rank];
+}
+
+void MPIShmChain::Fence(const std::string &hint)
+{
+    m_Comm.Win_fence(0, m_Win, hint);
+}
+
+// PRIVATE
+void MPIShmChain::FreeSegments()
+{
+    if (!m_Win.IsEmpty())
+    {
+        m_Comm.Win_free(m_Win, "in MPIShmChain::FreeSegments");
+    }
+    m_Segments.clear();
+    m_SegmentSize = 0;
+}
+
+} // end namespace aggregator
+} // end namespace adios2
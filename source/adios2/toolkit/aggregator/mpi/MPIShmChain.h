@@ -0,0 +1,76 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * MPIShmChain.h
+ *
+ */
+
+#ifndef ADIOS2_TOOLKIT_AGGREGATOR_MPI_MPISHMCHAIN_H_
+#define ADIOS2_TOOLKIT_AGGREGATOR_MPI_MPISHMCHAIN_H_
+
+#include "adios2/toolkit/aggregator/mpi/MPIAggregator.h"
+
+namespace adios2
+{
+namespace aggregator
+{
+
+/**
+ * Two-level aggregation: processes are first grouped by compute node, and
+ * each node is split into one or a few groups whose first process is the
+ * aggregator writing the group's subfile. The other processes of a group
+ * hand their data to the aggregator through an MPI-3 shared memory window
+ * instead of point-to-point messages.
+ */
+class MPIShmChain : public MPIAggregator
+{
+
+public:
+    MPIShmChain();
+
+    ~MPIShmChain() = default;
+
+    /**
+     * Groups processes per node, then splits every node into
+     * ceil(subStreams / nodes) groups (at most one per process).
+     * @param subStreams total number of aggregators requested, 0: one per node
+     * @param parentComm all writers
+     */
+    void Init(const size_t subStreams, helper::Comm const &parentComm) final;
+
+    /** frees the shared memory window, then the aggregator comm */
+    void Close() final;
+
+    /**
+     * Makes the segment of every non-aggregator process at least
+     * segmentSize bytes, reallocating the window if it is smaller.
+     * Collective over m_Comm, all processes must pass the same value.
+     */
+    void AllocateSegments(const size_t segmentSize);
+
+    /** @return size of the segment of each non-aggregator process */
+    size_t SegmentSize() const noexcept;
+
+    /** @return segment of process rank of m_Comm, NULL for the aggregator */
+    char *Segment(const int rank) noexcept;
+
+    /**
+     * Separates the stores of the processes into the window from the loads
+     * of the aggregator, collective over m_Comm
+     */
+    void Fence(const std::string &hint);
+
+private:
+    helper::Comm::Win m_Win;
+    size_t m_SegmentSize = 0;
+    /** segment base address of every process of m_Comm */
+    std::vector<char *> m_Segments;
+
+    void FreeSegments();
+};
+
+} // end namespace aggregator
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_AGGREGATOR_MPI_MPISHMCHAIN_H_ */
@@ -222,6 +222,16 @@ void BPBase::Init(const Params &parameters, const std::string hint,
             parsedParameters.StreamReader = helper::StringTo<bool>(
                 value, " in Parameter key=StreamReader " + hint);
         }
+        else if (key == "lazymetadata")
+        {
+            parsedParameters.LazyMetadata = helper::StringTo<bool>(
+                value, " in Parameter key=LazyMetadata " + hint);
+        }
+        else if (key == "trace")
+        {
+            parsedParameters.Trace = helper::StringTo<bool>(
+                value, " in Parameter key=Trace " + hint);
+        }
     }
     if (!engineType.empty())
     {
@@ -20,6 +20,7 @@
 #include "adios2/common/ADIOSMacros.h"
 #include "adios2/common/ADIOSTypes.h"
 #include "adios2/helper/adiosComm.h"
+#include "adios2/helper/adiosThreadPool.h"
 #include "adios2/toolkit/aggregator/mpi/MPIChain.h"
 #include "adios2/toolkit/format/bp/bpOperation/BPOperation.h"
 #include "adios2/toolkit/format/buffer/Buffer.h"
@@ -216,6 +217,14 @@ public:
          */
         bool StreamReader = false;
 
+        /** BP4 reader: at Open only define variables and locate their blocks,
+         * block statistics are parsed on the first MinMax request */
+        bool LazyMetadata = false;
+
+        /** true: record engine phases with profiling::Tracer and write them
+         * as Chrome trace JSON at Close */
+        bool Trace = false;
+
         /** Number of aggregators.
          * Must be a value between 1 and number of MPI ranks
          * 0 as default means that the engine must define the number of
@@ -255,6 +264,10 @@ public:
     /** contains user level parameters */
     Parameters m_Parameters;
 
+    /** runs the m_Parameters.Threads, set by the engine from its ADIOS
+     * object, nullptr computes serially */
+    helper::ThreadPool *m_ThreadPool = nullptr;
+
     /** true: Close was called, Engine will call this many times for different
      * transports */
     bool m_IsClosed = false;
@@ -662,22 +662,8 @@ void BPSerializer::MergeSerializeIndices(
         }
     };
 
-    auto lf_MergeRankRange =
-        [&](const std::unordered_map<
-                std::string, std::vector<SerialElementIndex>> &nameRankIndices,
-            const std::vector<std::string> &names, const size_t start,
-            const size_t end, BufferSTL &bufferSTL)
-
-    {
-        for (auto i = start; i < end; ++i)
-        {
-            auto itIndex = nameRankIndices.find(names[i]);
-            lf_MergeRank(itIndex->second, bufferSTL);
-        }
-    };
-
     // BODY OF FUNCTION STARTS HERE
-    if (m_Parameters.Threads == 1) // enforcing serial version for now
+    if (m_Parameters.Threads == 1 || m_ThreadPool == nullptr)
     {
         for (const auto &rankIndices : nameRankIndices)
         {
@@ -686,15 +672,6 @@ void BPSerializer::MergeSerializeIndices(
         return;
     }
 
-    const size_t elements = nameRankIndices.size();
-    const size_t stride =
-        elements / m_Parameters.Threads; // elements per thread
-    const size_t last =
-        stride + elements % m_Parameters.Threads; // remainder to last
-
-    std::vector<std::thread> threads;
-    threads.reserve(m_Parameters.Threads);
-
     // copy names in order to use threads
     std::vector<std::string> names;
     names.reserve(nameRankIndices.size());
@@ -704,25 +681,12 @@ void BPSerializer::MergeSerializeIndices(
         names.push_back(nameRankIndexPair.first);
     }
 
-    for (unsigned int t = 0; t < m_Parameters.Threads; ++t)
-    {
-        const size_t start = stride * t;
-        size_t end = start + stride;
-
-        if (t == m_Parameters.Threads - 1)
-        {
-            end = start + last;
-        }
-
-        threads.push_back(
-            std::thread(lf_MergeRankRange, std::ref(nameRankIndices),
-                        std::ref(names), start, end, std::ref(bufferSTL)));
-    }
-
-    for (auto &thread : threads)
-    {
-        thread.join();
-    }
+    // one variable per iteration, threads take the next one when done
+    m_ThreadPool->ParallelFor(
+        names.size(), m_Parameters.Threads, [&](const size_t i) {
+            auto itIndex = nameRankIndices.find(names[i]);
+            lf_MergeRank(itIndex->second, bufferSTL);
+        });
 }
 
 uint32_t BPSerializer::GetFileIndex() const noexcept
@@ -78,14 +78,15 @@ inline void BPSerializer::PutPayloadInBuffer(
             reinterpret_cast<T *>(m_Data.m_Buffer.data() + m_Data.m_Position),
             blockInfo.Start, blockInfo.Count, sourceRowMajor, blockInfo.Data,
             blockInfo.Start, blockInfo.Count, sourceRowMajor, false, Dims(),
-            Dims(), blockInfo.MemoryStart, blockInfo.MemoryCount);
+            Dims(), blockInfo.MemoryStart, blockInfo.MemoryCount,
+            m_Parameters.Threads, m_ThreadPool);
         m_Data.m_Position += blockSize * sizeof(T);
     }
     else
     {
         helper::CopyToBufferThreads(m_Data.m_Buffer, m_Data.m_Position,
                                     blockInfo.Data, blockSize,
-                                    m_Parameters.Threads);
+                                    m_Parameters.Threads, m_ThreadPool);
     }
     m_Profiler.Stop("memcpy");
     m_Data.m_AbsolutePosition += blockSize * sizeof(T); // payload size
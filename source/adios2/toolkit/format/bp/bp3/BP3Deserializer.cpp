@@ -11,7 +11,6 @@
 #include "BP3Deserializer.h"
 #include "BP3Deserializer.tcc"
 
-#include <future>
 #include <unordered_set>
 #include <vector>
 
@@ -226,7 +225,7 @@ void BP3Deserializer::ParseVariablesIndex(const BufferSTL &bufferSTL,
     const size_t varIndexLength =
         m_Minifooter.AttributesIndexStart - m_Minifooter.VarsIndexStart - 12;
 
-    if (m_Parameters.Threads == 1)
+    if (m_Parameters.Threads == 1 || m_ThreadPool == nullptr)
     {
         while (localPosition < varIndexLength)
         {
@@ -241,46 +240,27 @@ void BP3Deserializer::ParseVariablesIndex(const BufferSTL &bufferSTL,
         return;
     }
 
-    // threads for reading Variables
-    std::vector<std::future<void>> asyncs(m_Parameters.Threads);
-    std::vector<size_t> asyncPositions(m_Parameters.Threads);
-
-    bool launched = false;
-
+    // find the variable index positions, then threads read them
+    std::vector<size_t> elementPositions;
     while (localPosition < varIndexLength)
     {
-        // extract async positions
-        for (unsigned int t = 0; t < m_Parameters.Threads; ++t)
-        {
-            asyncPositions[t] = position;
-            const size_t elementIndexSize =
-                static_cast<size_t>(helper::ReadValue<uint32_t>(
-                    buffer, position, m_Minifooter.IsLittleEndian));
-            position += elementIndexSize;
-            localPosition = position - startPosition;
-
-            if (launched)
-            {
-                asyncs[t].get();
-            }
-
-            if (localPosition <= varIndexLength)
-            {
-                asyncs[t] = std::async(std::launch::async, lf_ReadElementIndex,
-                                       std::ref(engine), std::ref(buffer),
-                                       asyncPositions[t]);
-            }
-        }
-        launched = true;
-    }
+        const size_t elementPosition = position;
+        const size_t elementIndexSize =
+            static_cast<size_t>(helper::ReadValue<uint32_t>(
+                buffer, position, m_Minifooter.IsLittleEndian));
+        position += elementIndexSize;
+        localPosition = position - startPosition;
 
-    for (auto &async : asyncs)
-    {
-        if (async.valid())
+        if (localPosition <= varIndexLength)
         {
-            async.wait();
+            elementPositions.push_back(elementPosition);
         }
     }
+
+    m_ThreadPool->ParallelFor(
+        elementPositions.size(), m_Parameters.Threads, [&](const size_t i) {
+            lf_ReadElementIndex(engine, buffer, elementPositions[i]);
+        });
 }
 
 void BP3Deserializer::ParseAttributesIndex(const BufferSTL &bufferSTL,
@@ -578,7 +578,8 @@ void BP3Deserializer::PostDataRead(
             m_ThreadBuffers[threadID][0].data(), intersectStart, intersectCount,
             true, true, reinterpret_cast<char *>(blockInfo.Data),
             intersectStart, intersectCount, true, true, intersectStart,
-            blockCount, memoryStart, blockInfo.MemoryCount, false);
+            blockCount, memoryStart, blockInfo.MemoryCount, false,
+            m_Parameters.Threads, m_ThreadPool);
     }
     else
     {
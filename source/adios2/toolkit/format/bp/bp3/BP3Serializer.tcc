@@ -124,7 +124,7 @@ void BP3Serializer::PutSpanMetadata(
         m_Profiler.Start("minmax");
         T min, max;
         helper::GetMinMaxThreads(span.Data(), span.Size(), min, max,
-                                 m_Parameters.Threads);
+                                 m_Parameters.Threads, m_ThreadPool);
         m_Profiler.Stop("minmax");
 
         // Put min/max in variable index
@@ -314,7 +314,8 @@ BP3Serializer::GetBPStats(const bool singleValue,
             const std::size_t valuesSize =
                 helper::GetTotalSize(blockInfo.Count);
             helper::GetMinMaxThreads(blockInfo.Data, valuesSize, stats.Min,
-                                     stats.Max, m_Parameters.Threads);
+                                     stats.Max, m_Parameters.Threads,
+                                     m_ThreadPool);
         }
         else // non-contiguous memory min/max
         {
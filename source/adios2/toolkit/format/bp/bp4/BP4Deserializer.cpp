@@ -343,10 +343,7 @@ void BP4Deserializer::ParseVariablesIndexPerStep(const BufferSTL &bufferSTL,
     const size_t startPosition = position;
     size_t localPosition = 0;
 
-    /* FIXME: multi-threaded processing does not work here
-     * because DefineVariable may be called from several threads
-     */
-    /*if (m_Threads == 1)*/
+    if (m_Parameters.Threads == 1 || m_ThreadPool == nullptr)
     {
         while (localPosition < length)
         {
@@ -360,49 +357,27 @@ void BP4Deserializer::ParseVariablesIndexPerStep(const BufferSTL &bufferSTL,
         }
         return;
     }
-    /*
-        // threads for reading Variables
-        std::vector<std::future<void>> asyncs(m_Threads);
-        std::vector<size_t> asyncPositions(m_Threads);
 
-        bool launched = false;
-
-        while (localPosition < length)
-        {
-            // extract async positions
-            for (unsigned int t = 0; t < m_Threads; ++t)
-            {
-                asyncPositions[t] = position;
-                const size_t elementIndexSize =
-                    static_cast<size_t>(helper::ReadValue<uint32_t>(
-                        buffer, position, m_Minifooter.IsLittleEndian));
-                position += elementIndexSize;
-                localPosition = position - startPosition;
-
-                if (launched)
-                {
-                    asyncs[t].get();
-                }
-
-                if (localPosition <= length)
-                {
-                    asyncs[t] =
-                        std::async(std::launch::async,
-       lf_ReadElementIndexPerStep, std::ref(engine), std::ref(buffer),
-                                   asyncPositions[t], step);
-                }
-            }
-            launched = true;
-        }
+    // find the variable index positions, then threads read them. A variable
+    // has one index per step, so threads never share a variable, and
+    // defining or inquiring variables in the IO is guarded by m_Mutex
+    std::vector<size_t> elementPositions;
+    elementPositions.reserve(count);
+    while (localPosition < length)
+    {
+        elementPositions.push_back(position);
+        const size_t elementIndexSize =
+            static_cast<size_t>(helper::ReadValue<uint32_t>(
+                buffer, position, m_Minifooter.IsLittleEndian));
+        position += elementIndexSize;
+        localPosition = position - startPosition;
+    }
 
-        for (auto &async : asyncs)
-        {
-            if (async.valid())
-            {
-                async.wait();
-            }
-        }
-    */
+    m_ThreadPool->ParallelFor(
+        elementPositions.size(), m_Parameters.Threads, [&](const size_t i) {
+            lf_ReadElementIndexPerStep(engine, buffer, elementPositions[i],
+                                       step);
+        });
 }
 
 /* void BP4Deserializer::ParseVariablesIndex(const BufferSTL &bufferSTL,
@@ -709,6 +684,9 @@ ADIOS2_FOREACH_STDTYPE_1ARG(declare_template_instantiation)
     BP4Deserializer::BlocksInfo(const core::Variable<T> &, const size_t)       \
         const;                                                                 \
                                                                                \
+    template void BP4Deserializer::LoadVariableStatistics(                     \
+        core::Variable<T> &) const;                                            \
+                                                                               \
     template void BP4Deserializer::PreDataRead(                                \
         core::Variable<T> &, typename core::Variable<T>::BPInfo &,             \
         const helper::SubStreamBoxInfo &, char *&, size_t &, size_t &,         \
@@ -716,7 +694,8 @@ ADIOS2_FOREACH_STDTYPE_1ARG(declare_template_instantiation)
                                                                                \
     template void BP4Deserializer::PostDataRead(                               \
         core::Variable<T> &, typename core::Variable<T>::BPInfo &,             \
-        const helper::SubStreamBoxInfo &, const bool, const size_t);
+        const helper::SubStreamBoxInfo &, const bool, const size_t,            \
+        const char *);
 
 ADIOS2_FOREACH_STDTYPE_1ARG(declare_template_instantiation)
 #undef declare_template_instantiation
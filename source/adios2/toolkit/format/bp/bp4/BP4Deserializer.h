@@ -112,12 +112,19 @@ public:
                      char *&buffer, size_t &payloadSize, size_t &payloadOffset,
                      const size_t threadID = 0);
 
+    /**
+     * Decompresses if needed and clips the box into blockInfo.Data
+     * @param payload uncompressed box contents available elsewhere, e.g. in a
+     * file mapping, default: the box read into the thread buffer set up by
+     * PreDataRead
+     */
     template <class T>
     void PostDataRead(core::Variable<T> &variable,
                       typename core::Variable<T>::BPInfo &blockInfo,
                       const helper::SubStreamBoxInfo &subStreamBoxInfo,
                       const bool isRowMajorDestination,
-                      const size_t threadID = 0);
+                      const size_t threadID = 0,
+                      const char *payload = nullptr);
 
     /**
      * Clips and assigns memory to blockInfo.Data from a contiguous memory
@@ -153,6 +160,14 @@ public:
     std::vector<typename core::Variable<T>::BPInfo>
     BlocksInfo(const core::Variable<T> &variable, const size_t step) const;
 
+    /**
+     * LazyMetadata: aggregates the min/max of all blocks of a variable
+     * into m_Min, m_Max the first time they are requested
+     * @param variable defined when parsing the metadata
+     */
+    template <class T>
+    void LoadVariableStatistics(core::Variable<T> &variable) const;
+
     // TODO : Will deprecate all function below
     std::map<std::string, helper::SubFileInfoMap>
     PerformGetsVariablesSubFileInfo(core::IO &io);
@@ -187,6 +202,10 @@ private:
 
     static std::mutex m_Mutex;
 
+    /** LazyMetadata: variables with blocks whose statistics were not
+     * parsed yet, guarded by m_Mutex */
+    mutable std::set<std::string> m_LazyStatistics;
+
     void ParseMinifooter(const BufferSTL &bufferSTL);
 
     // void ParsePGIndex(const BufferSTL &bufferSTL, const core::IO &io);
@@ -219,6 +238,17 @@ private:
                                          const std::vector<char> &buffer,
                                          size_t position, size_t step) const;
 
+    /**
+     * LazyMetadata: sets the shape of global arrays from the last block of
+     * each step and defers the statistics of all blocks
+     * @param steps steps of the index just parsed, in order
+     */
+    template <class T>
+    void DeferVariableStatistics(core::Variable<T> &variable,
+                                 const ElementIndexHeader &header,
+                                 const std::vector<char> &buffer,
+                                 const std::vector<size_t> &steps) const;
+
     template <class T>
     void DefineAttributeInEngineIO(const ElementIndexHeader &header,
                                    core::Engine &engine,
@@ -288,7 +318,8 @@ ADIOS2_FOREACH_STDTYPE_1ARG(declare_template_instantiation)
                                                                                \
     extern template void BP4Deserializer::PostDataRead(                        \
         core::Variable<T> &, typename core::Variable<T>::BPInfo &,             \
-        const helper::SubStreamBoxInfo &, const bool, const size_t);
+        const helper::SubStreamBoxInfo &, const bool, const size_t,            \
+        const char *);
 
 ADIOS2_FOREACH_STDTYPE_1ARG(declare_template_instantiation)
 #undef declare_template_instantiation
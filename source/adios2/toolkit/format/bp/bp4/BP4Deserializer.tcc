@@ -508,8 +508,14 @@ template <class T>
 void BP4Deserializer::PostDataRead(
     core::Variable<T> &variable, typename core::Variable<T>::BPInfo &blockInfo,
     const helper::SubStreamBoxInfo &subStreamBoxInfo,
-    const bool isRowMajorDestination, const size_t threadID)
+    const bool isRowMajorDestination, const size_t threadID,
+    const char *payload)
 {
+    if (payload == nullptr)
+    {
+        payload = m_ThreadBuffers[threadID][0].data();
+    }
+
     if (subStreamBoxInfo.OperationsInfo.size() > 0 &&
         !IdentityOperation<T>(blockInfo.Operations))
     {
@@ -534,6 +540,7 @@ void BP4Deserializer::PostDataRead(
         helper::ClipVector(m_ThreadBuffers[threadID][0],
                            subStreamBoxInfo.Seeks.first,
                            subStreamBoxInfo.Seeks.second);
+        payload = m_ThreadBuffers[threadID][0].data();
     }
 
 #ifdef ADIOS2_HAVE_ENDIAN_REVERSE
@@ -550,10 +557,9 @@ void BP4Deserializer::PostDataRead(
             : blockInfo.Start;
 
     helper::ClipContiguousMemory(
-        blockInfo.Data, blockInfoStart, blockInfo.Count,
-        m_ThreadBuffers[threadID][0].data(), subStreamBoxInfo.BlockBox,
-        subStreamBoxInfo.IntersectionBox, m_IsRowMajor, m_ReverseDimensions,
-        endianReverse);
+        blockInfo.Data, blockInfoStart, blockInfo.Count, payload,
+        subStreamBoxInfo.BlockBox, subStreamBoxInfo.IntersectionBox,
+        m_IsRowMajor, m_ReverseDimensions, endianReverse);
 }
 
 template <class T>
@@ -638,7 +644,11 @@ inline void BP4Deserializer::DefineVariableInEngineIOPerStep<std::string>(
                             : header.Path + PathSeparator + header.Name;
 
     core::Variable<std::string> *variable = nullptr;
-    variable = engine.m_IO.InquireVariable<std::string>(variableName);
+    {
+        // to prevent conflict with DefineVariable
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        variable = engine.m_IO.InquireVariable<std::string>(variableName);
+    }
     if (variable)
     {
         size_t endPositionCurrentStep =
@@ -655,13 +665,13 @@ inline void BP4Deserializer::DefineVariableInEngineIOPerStep<std::string>(
         {
             const size_t subsetPosition = position;
 
-            // read until step is found
+            // read until step is found, only the step in lazy mode
             const Characteristics<std::string> subsetCharacteristics =
                 ReadElementIndexCharacteristics<std::string>(
                     buffer, position, static_cast<DataTypes>(header.DataType),
-                    false, m_Minifooter.IsLittleEndian);
+                    m_Parameters.LazyMetadata, m_Minifooter.IsLittleEndian);
 
-            if (subsetCharacteristics.EntryShapeID == ShapeID::LocalValue)
+            if (characteristics.EntryShapeID == ShapeID::LocalValue)
             {
                 if (subsetPosition == initialPosition)
                 {
@@ -722,11 +732,11 @@ inline void BP4Deserializer::DefineVariableInEngineIOPerStep<std::string>(
     {
         const size_t subsetPosition = position;
 
-        // read until step is found
+        // read until step is found, only the step in lazy mode
         const Characteristics<std::string> subsetCharacteristics =
             ReadElementIndexCharacteristics<std::string>(
                 buffer, position, static_cast<DataTypes>(header.DataType),
-                false, m_Minifooter.IsLittleEndian);
+                m_Parameters.LazyMetadata, m_Minifooter.IsLittleEndian);
 
         const bool isNextStep =
             stepsFound.insert(subsetCharacteristics.Statistics.Step).second;
@@ -736,7 +746,7 @@ inline void BP4Deserializer::DefineVariableInEngineIOPerStep<std::string>(
         {
             currentStep = subsetCharacteristics.Statistics.Step;
             ++variable->m_AvailableStepsCount;
-            if (subsetCharacteristics.EntryShapeID == ShapeID::LocalValue)
+            if (characteristics.EntryShapeID == ShapeID::LocalValue)
             {
                 // reset shape and count
                 variable->m_Shape[0] = 1;
@@ -745,7 +755,7 @@ inline void BP4Deserializer::DefineVariableInEngineIOPerStep<std::string>(
         }
         else
         {
-            if (subsetCharacteristics.EntryShapeID == ShapeID::LocalValue)
+            if (characteristics.EntryShapeID == ShapeID::LocalValue)
             {
                 ++variable->m_Shape[0];
                 ++variable->m_Count[0];
@@ -803,15 +813,16 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
         position = initialPosition;
         // variable->m_AvailableStepsCount = step;
         ++variable->m_AvailableStepsCount;
+        const bool lazy = m_Parameters.LazyMetadata;
         while (position < endPositionCurrentStep)
         {
             const size_t subsetPosition = position;
 
-            // read until step is found
+            // read until step is found, only the step in lazy mode
             const Characteristics<T> subsetCharacteristics =
                 ReadElementIndexCharacteristics<T>(
                     buffer, position, static_cast<DataTypes>(header.DataType),
-                    false, m_Minifooter.IsLittleEndian);
+                    lazy, m_Minifooter.IsLittleEndian);
 
             const T blockMin = characteristics.Statistics.IsValue
                                    ? subsetCharacteristics.Statistics.Value
@@ -820,17 +831,17 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
                                    ? subsetCharacteristics.Statistics.Value
                                    : subsetCharacteristics.Statistics.Max;
 
-            if (helper::LessThan(blockMin, variable->m_Min))
+            if (!lazy && helper::LessThan(blockMin, variable->m_Min))
             {
                 variable->m_Min = blockMin;
             }
 
-            if (helper::GreaterThan(blockMax, variable->m_Max))
+            if (!lazy && helper::GreaterThan(blockMax, variable->m_Max))
             {
                 variable->m_Max = blockMax;
             }
 
-            if (subsetCharacteristics.EntryShapeID == ShapeID::LocalValue)
+            if (characteristics.EntryShapeID == ShapeID::LocalValue)
             {
                 if (subsetPosition == initialPosition)
                 {
@@ -861,6 +872,11 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
                 subsetPosition);
             position = subsetPosition + subsetCharacteristics.EntryLength + 5;
         }
+
+        if (lazy)
+        {
+            DeferVariableStatistics(*variable, header, buffer, {step});
+        }
         return;
     }
 
@@ -934,16 +950,18 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
 
     size_t currentStep = 0; // Starts at 1 in bp file
     std::set<uint32_t> stepsFound;
+    std::vector<size_t> steps;
     variable->m_AvailableStepsCount = 0;
+    const bool lazy = m_Parameters.LazyMetadata;
     while (position < endPosition)
     {
         const size_t subsetPosition = position;
 
-        // read until step is found
+        // read until step is found, only the step in lazy mode
         const Characteristics<T> subsetCharacteristics =
             ReadElementIndexCharacteristics<T>(
                 buffer, position, static_cast<DataTypes>(header.DataType),
-                false, m_Minifooter.IsLittleEndian);
+                lazy, m_Minifooter.IsLittleEndian);
 
         const T blockMin = characteristics.Statistics.IsValue
                                ? subsetCharacteristics.Statistics.Value
@@ -958,8 +976,9 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
         if (isNextStep)
         {
             currentStep = subsetCharacteristics.Statistics.Step;
+            steps.push_back(currentStep);
             ++variable->m_AvailableStepsCount;
-            if (subsetCharacteristics.EntryShapeID == ShapeID::LocalValue)
+            if (characteristics.EntryShapeID == ShapeID::LocalValue)
             {
                 // reset shape and count
                 variable->m_Shape[0] = 1;
@@ -968,7 +987,7 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
         }
         else
         {
-            if (subsetCharacteristics.EntryShapeID == ShapeID::LocalValue)
+            if (characteristics.EntryShapeID == ShapeID::LocalValue)
             {
                 ++variable->m_Shape[0];
                 ++variable->m_Count[0];
@@ -976,7 +995,8 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
         }
 
         // Shape definition is by the last block now, not the first block
-        if (subsetCharacteristics.EntryShapeID == ShapeID::GlobalArray)
+        if (!lazy &&
+            subsetCharacteristics.EntryShapeID == ShapeID::GlobalArray)
         {
             const Dims shape = m_ReverseDimensions
                                    ? Dims(subsetCharacteristics.Shape.rbegin(),
@@ -987,9 +1007,10 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
         }
 
         // update min max for global values only if new step is found
-        if ((isNextStep &&
-             subsetCharacteristics.EntryShapeID == ShapeID::GlobalValue) ||
-            (subsetCharacteristics.EntryShapeID != ShapeID::GlobalValue))
+        if (!lazy &&
+            ((isNextStep &&
+              subsetCharacteristics.EntryShapeID == ShapeID::GlobalValue) ||
+             (subsetCharacteristics.EntryShapeID != ShapeID::GlobalValue)))
         {
             if (helper::LessThan(blockMin, variable->m_Min))
             {
@@ -1007,6 +1028,11 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
         position = subsetPosition + subsetCharacteristics.EntryLength + 5;
     }
 
+    if (lazy)
+    {
+        DeferVariableStatistics(*variable, header, buffer, steps);
+    }
+
     if (variable->m_ShapeID == ShapeID::LocalValue)
     {
         variable->m_ShapeID = ShapeID::GlobalArray;
@@ -1021,6 +1047,79 @@ void BP4Deserializer::DefineVariableInEngineIOPerStep(
     variable->m_Engine = &engine;
 }
 
+template <class T>
+void BP4Deserializer::DeferVariableStatistics(
+    core::Variable<T> &variable, const ElementIndexHeader &header,
+    const std::vector<char> &buffer, const std::vector<size_t> &steps) const
+{
+    // local values are presented as global arrays after the first step
+    if (variable.m_ShapeID == ShapeID::GlobalArray && !variable.m_SingleValue)
+    {
+        // Shape definition is by the last block of a step
+        for (const size_t step : steps)
+        {
+            size_t position =
+                variable.m_AvailableStepBlockIndexOffsets[step].back();
+            const Characteristics<T> lastCharacteristics =
+                ReadElementIndexCharacteristics<T>(
+                    buffer, position, static_cast<DataTypes>(header.DataType),
+                    false, m_Minifooter.IsLittleEndian);
+
+            const Dims shape =
+                m_ReverseDimensions ? Dims(lastCharacteristics.Shape.rbegin(),
+                                           lastCharacteristics.Shape.rend())
+                                    : lastCharacteristics.Shape;
+            variable.m_Shape = shape;
+            variable.m_AvailableShapes[step] = shape;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_LazyStatistics.insert(variable.m_Name);
+}
+
+template <class T>
+void BP4Deserializer::LoadVariableStatistics(core::Variable<T> &variable) const
+{
+    // held while parsing, concurrent callers wait for complete statistics
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_LazyStatistics.erase(variable.m_Name) == 0)
+    {
+        return;
+    }
+
+    for (const auto &pair : variable.m_AvailableStepBlockIndexOffsets)
+    {
+        for (const size_t blockIndexOffset : pair.second)
+        {
+            size_t position = blockIndexOffset;
+            const Characteristics<T> blockCharacteristics =
+                ReadElementIndexCharacteristics<T>(
+                    m_Metadata.m_Buffer, position, TypeTraits<T>::type_enum,
+                    false, m_Minifooter.IsLittleEndian);
+
+            // values hold their Min and Max too
+            if (helper::LessThan(blockCharacteristics.Statistics.Min,
+                                 variable.m_Min))
+            {
+                variable.m_Min = blockCharacteristics.Statistics.Min;
+            }
+
+            if (helper::GreaterThan(blockCharacteristics.Statistics.Max,
+                                    variable.m_Max))
+            {
+                variable.m_Max = blockCharacteristics.Statistics.Max;
+            }
+
+            // global values have one value per step
+            if (blockCharacteristics.EntryShapeID == ShapeID::GlobalValue)
+            {
+                break;
+            }
+        }
+    }
+}
+
 template <class T>
 void BP4Deserializer::DefineAttributeInEngineIO(
     const ElementIndexHeader &header, core::Engine &engine,
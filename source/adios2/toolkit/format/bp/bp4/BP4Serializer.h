@@ -154,6 +154,17 @@ private:
                                    std::vector<std::tuple<size_t, size_t>>>>
         m_AttributesIndicesInfo;
 
+    /**
+     * Set by GetBPStats when the min/max of the block being put is computed
+     * while PutVariablePayload copies it. PutVariableMetadata then writes
+     * placeholder min/max characteristics at these positions of the data
+     * buffer and of the variable index buffer.
+     */
+    bool m_DeferredMinMax = false;
+    helper::BlockDivisionInfo m_DeferredSubBlockInfo;
+    size_t m_DeferredMinMaxDataPosition = 0;
+    size_t m_DeferredMinMaxIndexPosition = 0;
+
     /**
      * Put in BP buffer attribute header, called from PutAttributeInData
      * specialized functions
@@ -200,6 +211,15 @@ private:
                         const typename core::Variable<T>::BPInfo &blockInfo,
                         const bool isRowMajor) noexcept;
 
+    /**
+     * Copies a contiguous payload into the data buffer computing its min/max
+     * on the way, then fills the characteristics deferred by GetBPStats
+     */
+    template <class T>
+    void PutPayloadInBufferMinMax(
+        const core::Variable<T> &variable,
+        const typename core::Variable<T>::BPInfo &blockInfo) noexcept;
+
     /** @return The position that holds the length of the variable entry
      * (metadat+data length). The actual lengths is know after
      * PutVariablePayload()
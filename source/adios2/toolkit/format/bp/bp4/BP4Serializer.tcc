@@ -113,7 +113,14 @@ inline void BP4Serializer::PutVariablePayload(
 
     if (blockInfo.Operations.empty())
     {
-        PutPayloadInBuffer(variable, blockInfo, sourceRowMajor);
+        if (m_DeferredMinMax)
+        {
+            PutPayloadInBufferMinMax(variable, blockInfo);
+        }
+        else
+        {
+            PutPayloadInBuffer(variable, blockInfo, sourceRowMajor);
+        }
     }
     else
     {
@@ -150,7 +157,8 @@ void BP4Serializer::PutSpanMetadata(
         // set stats MinMaxs with the correct size
         helper::GetMinMaxSubblocks(span.Data(), blockInfo.Count,
                                    stats.SubBlockInfo, stats.MinMaxs, stats.Min,
-                                   stats.Max, m_Parameters.Threads);
+                                   stats.Max, m_Parameters.Threads,
+                                   m_ThreadPool);
         m_Profiler.Stop("minmax");
 
         // Put min/max blocks in variable index
@@ -345,7 +353,8 @@ BP4Serializer::GetBPStats(const bool singleValue,
         // set stats MinMaxs with the correct size
         helper::GetMinMaxSubblocks(blockInfo.Data, blockInfo.Count,
                                    stats.SubBlockInfo, stats.MinMaxs, stats.Min,
-                                   stats.Max, m_Parameters.Threads);
+                                   stats.Max, m_Parameters.Threads,
+                                   m_ThreadPool);
         return stats;
     }
 
@@ -360,14 +369,28 @@ BP4Serializer::GetBPStats(const bool singleValue,
     if (m_Parameters.StatsLevel > 0)
     {
         m_Profiler.Start("minmax");
-        if (blockInfo.MemoryStart.empty())
+        if (blockInfo.MemoryStart.empty() && blockInfo.Operations.empty())
+        {
+            // reading the block once: min/max are computed while copying the
+            // payload, see PutPayloadInBufferMinMax
+            stats.Min = {};
+            stats.Max = {};
+            stats.SubBlockInfo = helper::DivideBlock(
+                blockInfo.Count, m_Parameters.StatsBlockSize,
+                helper::BlockDivisionMethod::Contiguous);
+            stats.MinMaxs.resize(2 * stats.SubBlockInfo.NBlocks);
+            m_DeferredSubBlockInfo = stats.SubBlockInfo;
+            m_DeferredMinMax = true;
+        }
+        else if (blockInfo.MemoryStart.empty())
         {
             stats.SubBlockInfo = helper::DivideBlock(
                 blockInfo.Count, m_Parameters.StatsBlockSize,
                 helper::BlockDivisionMethod::Contiguous);
             helper::GetMinMaxSubblocks(
                 blockInfo.Data, blockInfo.Count, stats.SubBlockInfo,
-                stats.MinMaxs, stats.Min, stats.Max, m_Parameters.Threads);
+                stats.MinMaxs, stats.Min, stats.Max, m_Parameters.Threads,
+                m_ThreadPool);
         }
         else
         {
@@ -382,6 +405,35 @@ BP4Serializer::GetBPStats(const bool singleValue,
     return stats;
 }
 
+template <class T>
+void BP4Serializer::PutPayloadInBufferMinMax(
+    const core::Variable<T> &variable,
+    const typename core::Variable<T>::BPInfo &blockInfo) noexcept
+{
+    const size_t blockSize = helper::GetTotalSize(blockInfo.Count);
+    Stats<T> stats;
+    stats.SubBlockInfo = m_DeferredSubBlockInfo;
+
+    m_Profiler.Start("memcpy");
+    helper::CopyGetMinMaxSubblocks(
+        reinterpret_cast<T *>(m_Data.m_Buffer.data() + m_Data.m_Position),
+        blockInfo.Data, blockInfo.Count, stats.SubBlockInfo, stats.MinMaxs,
+        stats.Min, stats.Max, m_Parameters.Threads, m_ThreadPool);
+    m_Profiler.Stop("memcpy");
+    m_Data.m_Position += blockSize * sizeof(T);
+    m_Data.m_AbsolutePosition += blockSize * sizeof(T);
+
+    // overwrite the placeholders, same size since the sub-blocks are the same
+    uint8_t dummyCounter = 0;
+    size_t position = m_DeferredMinMaxDataPosition;
+    PutBoundsRecord(false, stats, dummyCounter, m_Data.m_Buffer, position);
+    position = m_DeferredMinMaxIndexPosition;
+    PutBoundsRecord(false, stats, dummyCounter,
+                    m_MetadataSet.VarsIndices.at(variable.m_Name).Buffer,
+                    position);
+    m_DeferredMinMax = false;
+}
+
 template <class T>
 size_t BP4Serializer::PutVariableMetadataInData(
     const core::Variable<T> &variable,
@@ -791,6 +843,10 @@ void BP4Serializer::PutVariableCharacteristics(
             span->m_MinMaxMetadataPositions.first = buffer.size();
             span->m_MinMaxMetadataPositions.second = buffer.size();
         }
+        if (m_DeferredMinMax)
+        {
+            m_DeferredMinMaxIndexPosition = buffer.size();
+        }
 
         PutBoundsRecord(variable.m_SingleValue, stats, characteristicsCounter,
                         buffer);
@@ -851,6 +907,10 @@ void BP4Serializer::PutVariableCharacteristicsInData(
     // in the data file (only in metadata file in other function)
     if (blockInfo.Data != nullptr && !variable.m_SingleValue)
     {
+        if (m_DeferredMinMax)
+        {
+            m_DeferredMinMaxDataPosition = position;
+        }
         PutBoundsRecord(variable.m_SingleValue, stats, characteristicsCounter,
                         buffer, position);
     }
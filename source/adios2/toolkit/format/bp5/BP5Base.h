@@ -10,6 +10,7 @@
 
 #include "adios2/core/Attribute.h"
 #include "adios2/core/IO.h"
+#include "adios2/helper/adiosThreadPool.h"
 #include "adios2/toolkit/format/buffer/BufferV.h"
 #include "adios2/toolkit/format/buffer/heap/BufferSTL.h"
 #include "atl.h"
@@ -46,6 +47,24 @@ public:
         size_t *DataLocation;
     } MetaArrayRec;
 
+    /** Follows the MetaArrayRec of a variable with an operator */
+    typedef struct _MetaOperatorRec
+    {
+        size_t *DataBlockSize; // Operated bytes of every block  [BlockCount]
+        char *OperatorType;    // Operator::m_Type, e.g. "bzip2"
+    } MetaOperatorRec;
+
+    /** Follows the MetaArrayRec (and MetaOperatorRec) of an array with
+     * min/max statistics of its blocks */
+    typedef struct _MetaMinMaxRec
+    {
+        size_t StatsBlockSize; // sub-block size the blocks were divided by
+        size_t MinMaxCount;    // Number of elements in MinMax
+        // Per-block min, max, followed by the min, max pairs of the
+        // sub-blocks when the block is divided   [MinMaxCount]
+        void *MinMax;
+    } MetaMinMaxRec;
+
     struct FFSMetadataInfoStruct
     {
         size_t BitFieldCount;
@@ -9,10 +9,24 @@
 #include "adios2/core/Attribute.h"
 #include "adios2/core/Engine.h"
 #include "adios2/core/IO.h"
+#include "adios2/helper/adiosFunctions.h"
+#include "adios2/toolkit/format/bp/bpOperation/compress/BPBZIP2.h"
+#include "adios2/toolkit/format/bp/bpOperation/compress/BPBlosc.h"
+#include "adios2/toolkit/format/bp/bpOperation/compress/BPLIBPRESSIO.h"
+#include "adios2/toolkit/format/bp/bpOperation/compress/BPMGARD.h"
+#include "adios2/toolkit/format/bp/bpOperation/compress/BPPNG.h"
+#include "adios2/toolkit/format/bp/bpOperation/compress/BPSZ.h"
+#include "adios2/toolkit/format/bp/bpOperation/compress/BPZFP.h"
 
 #include "BP5Deserializer.h"
 #include "BP5Deserializer.tcc"
 
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <tuple>
+
 #include <string.h>
 
 #ifdef _WIN32
@@ -36,16 +50,12 @@ void BP5Deserializer::InstallMetaMetaData(MetaMetaInfoBlock &MM)
 
 BP5Deserializer::ControlInfo *BP5Deserializer::GetPriorControl(FMFormat Format)
 {
-    struct ControlInfo *tmp = ControlBlocks;
-    while (tmp)
+    auto it = ControlByFormat.find(Format);
+    if (it == ControlByFormat.end())
     {
-        if (tmp->Format == Format)
-        {
-            return tmp;
-        }
-        tmp = tmp->Next;
+        return NULL;
     }
-    return NULL;
+    return it->second;
 }
 
 bool BP5Deserializer::NameIndicatesArray(const char *Name)
@@ -54,6 +64,16 @@ bool BP5Deserializer::NameIndicatesArray(const char *Name)
     return (strcmp("Dims", Name + Len - 4) == 0);
 }
 
+bool BP5Deserializer::NameIndicatesArrayField(const char *Name,
+                                              const char *Suffix)
+{
+    // only array fields are named "SST<size>_<type>_...", scalars are "SST_..."
+    const size_t Len = strlen(Name);
+    const size_t SuffixLen = strlen(Suffix);
+    return (strncmp(Name, "SST_", 4) != 0) && (Len > SuffixLen) &&
+           (strcmp(Suffix, Name + Len - SuffixLen) == 0);
+}
+
 DataType BP5Deserializer::TranslateFFSType2ADIOS(const char *Type, int size)
 {
     if (strcmp(Type, "integer") == 0)
@@ -148,14 +168,22 @@ void BP5Deserializer::BreakdownArrayName(const char *Name, char **base_name_p,
 
 BP5Deserializer::BP5VarRec *BP5Deserializer::LookupVarByKey(void *Key)
 {
-    auto ret = VarByKey[Key];
-    return ret;
+    auto it = VarByKey.find(Key);
+    if (it == VarByKey.end())
+    {
+        return NULL;
+    }
+    return it->second;
 }
 
 BP5Deserializer::BP5VarRec *BP5Deserializer::LookupVarByName(const char *Name)
 {
-    auto ret = VarByName[Name];
-    return ret;
+    auto it = VarByName.find(Name);
+    if (it == VarByName.end())
+    {
+        return NULL;
+    }
+    return it->second;
 }
 
 BP5Deserializer::BP5VarRec *BP5Deserializer::CreateVarRec(const char *ArrayName)
@@ -180,6 +208,7 @@ BP5Deserializer::ControlInfo *BP5Deserializer::BuildControl(FMFormat Format)
     int ControlCount = 0;
     ControlInfo *ret = (BP5Deserializer::ControlInfo *)malloc(sizeof(*ret));
     ret->Format = Format;
+    ret->VarIndex = new std::unordered_map<BP5VarRec *, int>();
     while (FieldList[i].field_name)
     {
         ret = (ControlInfo *)realloc(
@@ -197,6 +226,8 @@ BP5Deserializer::ControlInfo *BP5Deserializer::BuildControl(FMFormat Format)
             BP5VarRec *VarRec = nullptr;
             int ElementSize;
             C->IsArray = 1;
+            C->OperatorOffset = -1;
+            C->MinMaxOffset = -1;
             BreakdownArrayName(FieldList[i].field_name, &ArrayName, &Type,
                                &ElementSize);
             //            if (WriterRank != 0)
@@ -211,8 +242,23 @@ BP5Deserializer::ControlInfo *BP5Deserializer::BuildControl(FMFormat Format)
                 C->ElementSize = ElementSize;
             }
             i += 7; // number of fields in MetaArrayRec
+            if (FieldList[i].field_name &&
+                NameIndicatesArrayField(FieldList[i].field_name,
+                                        "DataBlockSize"))
+            {
+                C->OperatorOffset = FieldList[i].field_offset;
+                i += 2; // number of fields in MetaOperatorRec
+            }
+            if (FieldList[i].field_name &&
+                NameIndicatesArrayField(FieldList[i].field_name,
+                                        "StatsBlockSize"))
+            {
+                C->MinMaxOffset = FieldList[i].field_offset;
+                i += 3; // number of fields in MetaMinMaxRec
+            }
             free(ArrayName);
             C->VarRec = VarRec;
+            (*ret->VarIndex)[VarRec] = ControlCount - 1;
         }
         else
         {
@@ -220,6 +266,8 @@ BP5Deserializer::ControlInfo *BP5Deserializer::BuildControl(FMFormat Format)
             char *FieldName = strdup(FieldList[i].field_name + 4); // skip SST_
             BP5VarRec *VarRec = NULL;
             C->IsArray = 0;
+            C->OperatorOffset = -1;
+            C->MinMaxOffset = -1;
             VarRec = LookupVarByName(FieldName);
             if (!VarRec)
             {
@@ -233,6 +281,7 @@ BP5Deserializer::ControlInfo *BP5Deserializer::BuildControl(FMFormat Format)
             VarRec->ElementSize = FieldList[i].field_size;
             C->ElementSize = FieldList[i].field_size;
             C->VarRec = VarRec;
+            (*ret->VarIndex)[VarRec] = ControlCount - 1;
             free(FieldName);
             i++;
         }
@@ -240,6 +289,7 @@ BP5Deserializer::ControlInfo *BP5Deserializer::BuildControl(FMFormat Format)
     ret->ControlCount = ControlCount;
     ret->Next = ControlBlocks;
     ControlBlocks = ret;
+    ControlByFormat[Format] = ret;
     return ret;
 }
 
@@ -334,131 +384,293 @@ void BP5Deserializer::SetupForTimestep(size_t Timestep)
     {
         RecPair.second->Variable = NULL;
     }
+    for (auto RecPair : VarByName)
+    {
+        RecPair.second->Merged = false;
+    }
 }
 void BP5Deserializer::InstallMetaData(void *MetadataBlock, size_t BlockLen,
                                       size_t WriterRank)
 {
-    FFSTypeHandle FFSformat;
-    void *BaseData;
-    static int DumpMetadata = -1;
-    FFSformat =
-        FFSTypeHandle_from_encode(ReaderFFSContext, (char *)MetadataBlock);
+    InstallMetaData(&MetadataBlock, &BlockLen, WriterRank, 1);
+}
+
+void BP5Deserializer::InstallMetaData(const std::vector<void *> &MetadataBlocks,
+                                      const std::vector<size_t> &BlockLens)
+{
+    InstallMetaData(MetadataBlocks.data(), BlockLens.data(), 0,
+                    MetadataBlocks.size());
+}
+
+FFSTypeHandle BP5Deserializer::PrepareDecode(FFSContext Context,
+                                             char *MetadataBlock)
+{
+    FFSTypeHandle FFSformat = FFSTypeHandle_from_encode(Context, MetadataBlock);
     if (!FFShas_conversion(FFSformat))
     {
-        FMContext FMC = FMContext_from_FFS(ReaderFFSContext);
-        FMFormat Format = FMformat_from_ID(FMC, (char *)MetadataBlock);
+        FMContext FMC = FMContext_from_FFS(Context);
+        FMFormat Format = FMformat_from_ID(FMC, MetadataBlock);
         FMStructDescList List =
             FMcopy_struct_list(format_list_of_FMFormat(Format));
         FMlocalize_structs(List);
-        establish_conversion(ReaderFFSContext, FFSformat, List);
+        establish_conversion(Context, FFSformat, List);
         FMfree_struct_list(List);
     }
-    if (FFSdecode_in_place_possible(FFSformat))
+    return FFSformat;
+}
+
+void BP5Deserializer::InstallMetaData(void *const *MetadataBlocks,
+                                      const size_t *BlockLens,
+                                      size_t FirstWriterRank,
+                                      size_t WriterCount)
+{
+    static int DumpMetadata = -1;
+    // decoding a block takes microseconds, a thread needs a few of them
+    const size_t MinBlocksPerThread = 16;
+    size_t nThreads = 1;
+    if (m_ThreadPool && (m_Threads > 1))
     {
-        FFSdecode_in_place(ReaderFFSContext, (char *)MetadataBlock, &BaseData);
+        nThreads = std::min(static_cast<size_t>(m_Threads),
+                            WriterCount / MinBlocksPerThread);
+        nThreads = std::max(nThreads, static_cast<size_t>(1));
     }
-    else
+    while (m_DecodeContexts.size() < nThreads - 1)
     {
-        int DecodedLength = FFS_est_decode_length(
-            ReaderFFSContext, (char *)MetadataBlock, BlockLen);
-        BaseData = malloc(DecodedLength);
-        FFSdecode_to_buffer(ReaderFFSContext, (char *)MetadataBlock, BaseData);
+        m_DecodeContexts.push_back(
+            create_FFSContext_FM(FMContext_from_FFS(ReaderFFSContext)));
     }
-    if (DumpMetadata == -1)
+
+    // FFS formats, conversions and the control blocks are shared, set them up
+    // before decoding
+    std::vector<char> InPlace(WriterCount);
+    std::vector<FFSTypeHandle> Prepared;
+    for (size_t k = 0; k < WriterCount; k++)
     {
-        DumpMetadata = (getenv("BP5DumpMetadata") != NULL);
+        const size_t WriterRank = FirstWriterRank + k;
+        char *Block = (char *)MetadataBlocks[k];
+        FFSTypeHandle FFSformat = PrepareDecode(ReaderFFSContext, Block);
+        if (std::find(Prepared.begin(), Prepared.end(), FFSformat) ==
+            Prepared.end())
+        {
+            for (size_t t = 0; t < nThreads - 1; t++)
+            {
+                PrepareDecode(m_DecodeContexts[t], Block);
+            }
+            Prepared.push_back(FFSformat);
+        }
+        InPlace[k] = FFSdecode_in_place_possible(FFSformat);
+        if (!InPlace[k])
+        {
+            int DecodedLength =
+                FFS_est_decode_length(ReaderFFSContext, Block, BlockLens[k]);
+            MetadataBaseAddrs[WriterRank] = malloc(DecodedLength);
+        }
+        struct ControlInfo *Control =
+            GetPriorControl(FMFormat_of_original(FFSformat));
+        if (!Control)
+        {
+            Control = BuildControl(FMFormat_of_original(FFSformat));
+        }
+        ActiveControl[WriterRank] = Control;
     }
-    if (DumpMetadata && (WriterRank == 0))
+
+    auto lf_Decode = [&](FFSContext Context, const size_t k) {
+        const size_t WriterRank = FirstWriterRank + k;
+        char *Block = (char *)MetadataBlocks[k];
+        void *BaseData = MetadataBaseAddrs[WriterRank];
+        if (InPlace[k])
+        {
+            FFSdecode_in_place(Context, Block, &BaseData);
+            MetadataBaseAddrs[WriterRank] = BaseData;
+        }
+        else
+        {
+            FFSdecode_to_buffer(Context, Block, BaseData);
+        }
+
+        const struct ControlInfo *Control = ActiveControl[WriterRank];
+        for (int i = 0; i < Control->ControlCount; i++)
+        {
+            const struct ControlStruct &C = Control->Controls[i];
+            if (!FFSBitfieldTest((FFSMetadataInfoStruct *)BaseData, i))
+            {
+                continue;
+            }
+            if (C.IsArray)
+            {
+                MetaArrayRec *meta_base =
+                    (MetaArrayRec *)((char *)BaseData + C.FieldOffset);
+                if ((meta_base->Dims > 1) &&
+                    (m_WriterIsRowMajor != m_ReaderIsRowMajor))
+                {
+                    /* if we're getting data from someone of the other array
+                     * gender, switcheroo */
+                    ReverseDimensions(meta_base->Shape, meta_base->Dims);
+                    ReverseDimensions(meta_base->Count, meta_base->Dims);
+                    ReverseDimensions(meta_base->Offsets, meta_base->Dims);
+                }
+            }
+            if (!m_LazyMetadata)
+            {
+                InstallVarRecWriter(C, BaseData, WriterRank);
+            }
+        }
+    };
+
+    if (nThreads > 1)
     {
-        printf("\nIncomingMetadatablock from WriterRank %d is %p :\n",
-               (int)WriterRank, BaseData);
-        FMdump_data(FMFormat_of_original(FFSformat), BaseData, 1024000);
-        printf("\n\n");
+        // thread t decodes with its own context, taking the next block
+        std::atomic<size_t> Next(0);
+        m_ThreadPool->ParallelFor(
+            nThreads, static_cast<unsigned int>(nThreads),
+            [&](const size_t t) {
+                FFSContext Context =
+                    (t == 0) ? ReaderFFSContext : m_DecodeContexts[t - 1];
+                size_t k;
+                while ((k = Next++) < WriterCount)
+                {
+                    lf_Decode(Context, k);
+                }
+            });
     }
-    struct ControlInfo *Control;
-    struct ControlStruct *ControlArray;
-    Control = GetPriorControl(FMFormat_of_original(FFSformat));
-    if (!Control)
+    else
     {
-        Control = BuildControl(FMFormat_of_original(FFSformat));
+        for (size_t k = 0; k < WriterCount; k++)
+        {
+            lf_Decode(ReaderFFSContext, k);
+        }
     }
-    ControlArray = &Control->Controls[0];
-    ActiveControl[WriterRank] = Control;
 
-    MetadataBaseAddrs[WriterRank] = BaseData;
-    for (int i = 0; i < Control->ControlCount; i++)
+    if (DumpMetadata == -1)
+    {
+        DumpMetadata = (getenv("BP5DumpMetadata") != NULL);
+    }
+    for (size_t k = 0; k < WriterCount; k++)
     {
-        int FieldOffset = ControlArray[i].FieldOffset;
-        BP5VarRec *VarRec = ControlArray[i].VarRec;
-        void *field_data = (char *)BaseData + FieldOffset;
-        if (!FFSBitfieldTest((FFSMetadataInfoStruct *)BaseData, i))
+        const size_t WriterRank = FirstWriterRank + k;
+        void *BaseData = MetadataBaseAddrs[WriterRank];
+        const struct ControlInfo *Control = ActiveControl[WriterRank];
+        if (DumpMetadata && (WriterRank == 0))
         {
-            continue;
+            printf("\nIncomingMetadatablock from WriterRank %d is %p :\n",
+                   (int)WriterRank, BaseData);
+            FMdump_data(Control->Format, BaseData, 1024000);
+            printf("\n\n");
         }
-        if (ControlArray[i].IsArray)
+        for (int i = 0; i < Control->ControlCount; i++)
         {
-            MetaArrayRec *meta_base = (MetaArrayRec *)field_data;
-            if ((meta_base->Dims > 1) &&
-                (m_WriterIsRowMajor != m_ReaderIsRowMajor))
-            {
-                /* if we're getting data from someone of the other array gender,
-                 * switcheroo */
-                ReverseDimensions(meta_base->Shape, meta_base->Dims);
-                ReverseDimensions(meta_base->Count, meta_base->Dims);
-                ReverseDimensions(meta_base->Offsets, meta_base->Dims);
-            }
-            if (WriterRank == 0)
+            const struct ControlStruct &C = Control->Controls[i];
+            BP5VarRec *VarRec = C.VarRec;
+            void *field_data = (char *)BaseData + C.FieldOffset;
+            if (!FFSBitfieldTest((FFSMetadataInfoStruct *)BaseData, i))
             {
-                VarRec->GlobalDims = meta_base->Shape;
+                continue;
             }
             if (!VarRec->Variable)
             {
-                VarRec->Variable = ArrayVarSetup(
-                    m_Engine, VarRec->VarName, VarRec->Type, meta_base->Dims,
-                    meta_base->Shape, meta_base->Offsets, meta_base->Count);
+                if (C.IsArray)
+                {
+                    MetaArrayRec *meta_base = (MetaArrayRec *)field_data;
+                    VarRec->Variable = ArrayVarSetup(
+                        m_Engine, VarRec->VarName, VarRec->Type,
+                        meta_base->Dims, meta_base->Shape, meta_base->Offsets,
+                        meta_base->Count);
+                }
+                else
+                {
+                    VarRec->Variable = VarSetup(m_Engine, VarRec->VarName,
+                                                VarRec->Type, field_data);
+                }
                 VarByKey[VarRec->Variable] = VarRec;
             }
-            VarRec->DimCount = meta_base->Dims;
-            VarRec->PerWriterBlockCount[WriterRank] =
-                meta_base->Dims ? meta_base->DBCount / meta_base->Dims : 1;
-            VarRec->PerWriterStart[WriterRank] = meta_base->Offsets;
-            VarRec->PerWriterCounts[WriterRank] = meta_base->Count;
-            VarRec->PerWriterDataLocation[WriterRank] = meta_base->DataLocation;
-            if (WriterRank == 0)
-            {
-                VarRec->PerWriterBlockStart[WriterRank] = 0;
-            }
-            if (WriterRank < m_WriterCohortSize - 1)
+            if (!m_LazyMetadata)
             {
-                VarRec->PerWriterBlockStart[WriterRank + 1] =
-                    VarRec->PerWriterBlockStart[WriterRank] +
-                    VarRec->PerWriterBlockCount[WriterRank];
+                ChainVarRecWriter(C, BaseData, WriterRank);
             }
-#ifdef NOTDEF
-            // needs to be replaced with Simple Blocks Info
-            for (int i = 0; i < VarRec->PerWriterBlockCount[WriterRank]; i++)
-            {
-                size_t *Offsets = NULL;
-                if (meta_base->Offsets)
-                    Offsets = meta_base->Offsets + (i * meta_base->Dims);
-                ArrayBlocksInfoUpcall(m_Engine, VarRec->Variable, VarRec->Type,
-                                      WriterRank, meta_base->Dims,
-                                      meta_base->Shape, Offsets,
-                                      meta_base->Count);
-            }
-#endif
         }
-        else
+    }
+}
+
+void BP5Deserializer::InstallVarRecWriter(const ControlStruct &C,
+                                          void *BaseData, size_t WriterRank)
+{
+    BP5VarRec *VarRec = C.VarRec;
+    if (!C.IsArray)
+    {
+        VarRec->PerWriterMetaFieldOffset[WriterRank] = C.FieldOffset;
+        return;
+    }
+    MetaArrayRec *meta_base =
+        (MetaArrayRec *)((char *)BaseData + C.FieldOffset);
+    VarRec->PerWriterBlockCount[WriterRank] =
+        meta_base->Dims ? meta_base->DBCount / meta_base->Dims : 1;
+    VarRec->PerWriterStart[WriterRank] = meta_base->Offsets;
+    VarRec->PerWriterCounts[WriterRank] = meta_base->Count;
+    VarRec->PerWriterDataLocation[WriterRank] = meta_base->DataLocation;
+    if (C.OperatorOffset >= 0)
+    {
+        MetaOperatorRec *meta_op =
+            (MetaOperatorRec *)((char *)BaseData + C.OperatorOffset);
+        VarRec->PerWriterDataBlockSize[WriterRank] = meta_op->DataBlockSize;
+        VarRec->PerWriterOperator[WriterRank] = meta_op->OperatorType;
+    }
+    else
+    {
+        VarRec->PerWriterDataBlockSize[WriterRank] = NULL;
+        VarRec->PerWriterOperator[WriterRank] = NULL;
+    }
+}
+
+void BP5Deserializer::ChainVarRecWriter(const ControlStruct &C, void *BaseData,
+                                        size_t WriterRank)
+{
+    if (!C.IsArray)
+    {
+        return;
+    }
+    BP5VarRec *VarRec = C.VarRec;
+    MetaArrayRec *meta_base =
+        (MetaArrayRec *)((char *)BaseData + C.FieldOffset);
+    if (WriterRank == 0)
+    {
+        VarRec->GlobalDims = meta_base->Shape;
+        VarRec->PerWriterBlockStart[WriterRank] = 0;
+    }
+    VarRec->DimCount = meta_base->Dims;
+    if (WriterRank < m_WriterCohortSize - 1)
+    {
+        VarRec->PerWriterBlockStart[WriterRank + 1] =
+            VarRec->PerWriterBlockStart[WriterRank] +
+            VarRec->PerWriterBlockCount[WriterRank];
+    }
+}
+
+void BP5Deserializer::MergeVarRec(BP5VarRec *VarRec)
+{
+    if (!m_LazyMetadata || VarRec->Merged)
+    {
+        return;
+    }
+    for (size_t WriterRank = 0; WriterRank < (size_t)m_WriterCohortSize;
+         WriterRank++)
+    {
+        const struct ControlInfo *Control = ActiveControl[WriterRank];
+        if (!Control)
         {
-            if (!VarRec->Variable)
-            {
-                VarRec->Variable = VarSetup(m_Engine, VarRec->VarName,
-                                            VarRec->Type, field_data);
-                VarByKey[VarRec->Variable] = VarRec;
-            }
-            VarRec->PerWriterMetaFieldOffset[WriterRank] = FieldOffset;
+            continue;
         }
+        auto it = Control->VarIndex->find(VarRec);
+        void *BaseData = MetadataBaseAddrs[WriterRank];
+        if ((it == Control->VarIndex->end()) ||
+            !FFSBitfieldTest((FFSMetadataInfoStruct *)BaseData, it->second))
+        {
+            continue;
+        }
+        InstallVarRecWriter(Control->Controls[it->second], BaseData,
+                            WriterRank);
+        ChainVarRecWriter(Control->Controls[it->second], BaseData, WriterRank);
     }
+    VarRec->Merged = true;
 }
 
 void BP5Deserializer::InstallAttributeData(void *AttributeBlock,
@@ -558,6 +770,7 @@ bool BP5Deserializer::QueueGet(core::VariableBase &variable, void *DestData)
             WriterRank = variable.m_BlockID;
 
         BP5VarRec *VarRec = VarByKey[&variable];
+        MergeVarRec(VarRec);
         char *src = ((char *)MetadataBaseAddrs[WriterRank]) +
                     VarRec->PerWriterMetaFieldOffset[WriterRank];
         memcpy(DestData, src, variable.m_ElementSize);
@@ -567,6 +780,7 @@ bool BP5Deserializer::QueueGet(core::VariableBase &variable, void *DestData)
     {
         BP5ArrayRequest Req;
         Req.VarRec = VarByKey[&variable];
+        MergeVarRec(Req.VarRec);
         Req.RequestType = Global;
         Req.BlockID = variable.m_BlockID;
         Req.Count = variable.m_Count;
@@ -578,6 +792,7 @@ bool BP5Deserializer::QueueGet(core::VariableBase &variable, void *DestData)
     {
         BP5ArrayRequest Req;
         Req.VarRec = VarByKey[&variable];
+        MergeVarRec(Req.VarRec);
         Req.RequestType = Local;
         Req.BlockID = variable.m_BlockID;
         Req.Count = variable.m_Count;
@@ -599,19 +814,35 @@ bool BP5Deserializer::NeedWriter(BP5ArrayRequest Req, int i)
         return (NodeFirst <= Req.BlockID) && (NodeLast >= Req.BlockID);
     }
     // else Global case
-    for (int j = 0; j < Req.VarRec->DimCount; j++)
+    if (Req.VarRec->PerWriterStart[i] == NULL)
+    /* this writer didn't write */
     {
-        size_t SelOffset = Req.Start[j];
-        size_t SelSize = Req.Count[j];
-        size_t RankOffset;
-        size_t RankSize;
-        if (Req.VarRec->PerWriterStart[i] == NULL)
-        /* this writer didn't write */
+        return false;
+    }
+    for (size_t b = 0; b < Req.VarRec->PerWriterBlockCount[i]; b++)
+    {
+        if (NeedBlock(Req, i, b))
         {
-            return false;
+            return true;
         }
-        RankOffset = Req.VarRec->PerWriterStart[i][j];
-        RankSize = Req.VarRec->PerWriterCounts[i][j];
+    }
+    return false;
+}
+
+bool BP5Deserializer::NeedBlock(const BP5ArrayRequest &Req, int i,
+                                size_t Block)
+{
+    if (Req.RequestType == Local)
+    {
+        return Req.BlockID == Req.VarRec->PerWriterBlockStart[i] + Block;
+    }
+    const size_t DimCount = Req.VarRec->DimCount;
+    for (size_t j = 0; j < DimCount; j++)
+    {
+        size_t SelOffset = Req.Start[j];
+        size_t SelSize = Req.Count[j];
+        size_t RankOffset = Req.VarRec->PerWriterStart[i][Block * DimCount + j];
+        size_t RankSize = Req.VarRec->PerWriterCounts[i][Block * DimCount + j];
         if ((SelSize == 0) || (RankSize == 0))
         {
             return false;
@@ -626,7 +857,7 @@ bool BP5Deserializer::NeedWriter(BP5ArrayRequest Req, int i)
 }
 
 std::vector<BP5Deserializer::ReadRequest>
-BP5Deserializer::GenerateReadRequests()
+BP5Deserializer::GenerateReadRequests(const bool doAllocation)
 {
     std::vector<BP5Deserializer::ReadRequest> Ret;
     for (auto &W : WriterInfo)
@@ -657,7 +888,9 @@ BP5Deserializer::GenerateReadRequests()
             RR.ReadLength =
                 ((struct FFSMetadataInfoStruct *)MetadataBaseAddrs[i])
                     ->DataBlockSize;
-            RR.DestinationAddr = (char *)malloc(RR.ReadLength);
+            RR.DestinationAddr =
+                doAllocation ? (char *)malloc(RR.ReadLength) : NULL;
+            RR.Mapped = false;
             RR.Internal = NULL;
             Ret.push_back(RR);
         }
@@ -665,84 +898,220 @@ BP5Deserializer::GenerateReadRequests()
     return Ret;
 }
 
+namespace
+{
+std::shared_ptr<BPOperation> MakeBPOperation(const std::string &type)
+{
+    std::shared_ptr<BPOperation> bpOp;
+    if (type == "sz")
+    {
+        bpOp = std::make_shared<BPSZ>();
+    }
+    else if (type == "zfp")
+    {
+        bpOp = std::make_shared<BPZFP>();
+    }
+    else if (type == "mgard")
+    {
+        bpOp = std::make_shared<BPMGARD>();
+    }
+    else if (type == "bzip2")
+    {
+        bpOp = std::make_shared<BPBZIP2>();
+    }
+    else if (type == "png")
+    {
+        bpOp = std::make_shared<BPPNG>();
+    }
+    else if (type == "blosc")
+    {
+        bpOp = std::make_shared<BPBlosc>();
+    }
+    else if (type == "libpressio")
+    {
+        bpOp = std::make_shared<BPLIBPRESSIO>();
+    }
+    return bpOp;
+}
+} // end anonymous namespace
+
+void BP5Deserializer::DecompressBlock(OperatedBlockRequest &Req)
+{
+    const BP5VarRec *VarRec = Req.VarRec;
+    const size_t DimCount = VarRec->DimCount;
+    const size_t BlockSize =
+        VarRec->PerWriterDataBlockSize[Req.WriterRank][Req.Block];
+    const size_t *Count =
+        VarRec->PerWriterCounts[Req.WriterRank] + Req.Block * DimCount;
+
+    helper::BlockOperationInfo OpInfo;
+    // the operator works in the writer's dimension order
+    OpInfo.PreCount.assign(Count, Count + DimCount);
+    if (m_WriterIsRowMajor != m_ReaderIsRowMajor)
+    {
+        std::reverse(OpInfo.PreCount.begin(), OpInfo.PreCount.end());
+    }
+    const size_t OutputSize =
+        helper::GetTotalSize(OpInfo.PreCount) * VarRec->ElementSize;
+    if ((BlockSize == 0) || (OutputSize == 0))
+    {
+        return;
+    }
+
+    const char *HeaderEnd = (const char *)memchr(Req.Input, '\0', BlockSize);
+    if (HeaderEnd == NULL)
+    {
+        throw std::runtime_error("ERROR: corrupt operated block of variable " +
+                                 std::string(VarRec->VarName) +
+                                 ", in call to Get\n");
+    }
+    const std::string OperatorType(VarRec->PerWriterOperator[Req.WriterRank]);
+    std::shared_ptr<BPOperation> bpOp = MakeBPOperation(OperatorType);
+    if (!bpOp)
+    {
+        throw std::invalid_argument("ERROR: variable " +
+                                    std::string(VarRec->VarName) +
+                                    " was written with unsupported operator " +
+                                    OperatorType + ", in call to Get\n");
+    }
+    OpInfo.Info = helper::BuildParametersMap(
+        std::string(Req.Input, HeaderEnd), '=', '\n');
+    OpInfo.PayloadSize = BlockSize - (HeaderEnd + 1 - Req.Input);
+    Req.Output.resize(OutputSize);
+    bpOp->GetData(HeaderEnd + 1, OpInfo, Req.Output.data());
+}
+
 void BP5Deserializer::FinalizeGets(std::vector<ReadRequest> Requests)
 {
+    struct BlockExtraction
+    {
+        const BP5ArrayRequest *Req;
+        int WriterRank;
+        size_t Block;
+        const char *IncomingData;
+        size_t Operated; // index in OperatedBlocks, or -1
+    };
+    std::vector<BlockExtraction> Extractions;
+    std::vector<OperatedBlockRequest> OperatedBlocks;
+    std::map<std::tuple<BP5VarRec *, int, size_t>, size_t> OperatedIndex;
+
     for (const auto &Req : PendingRequests)
     {
         //        ImplementGapWarning(Reqs);
         for (int i = 0; i < m_WriterCohortSize; i++)
         {
-            if (NeedWriter(Req, i))
+            if (!NeedWriter(Req, i))
             {
-                /* if needed this writer fill destination with acquired data */
-                int ElementSize = Req.VarRec->ElementSize;
-                int DimCount = Req.VarRec->DimCount;
-                size_t *GlobalDimensions = Req.VarRec->GlobalDims;
-                size_t *RankOffset = Req.VarRec->PerWriterStart[i];
-                const size_t *RankSize = Req.VarRec->PerWriterCounts[i];
-                std::vector<size_t> ZeroSel(DimCount);
-                std::vector<size_t> ZeroRankOffset(DimCount);
-                std::vector<size_t> ZeroGlobalDimensions(DimCount);
-                const size_t *SelOffset = NULL;
-                const size_t *SelSize = Req.Count.data();
-                int ReqIndex = 0;
-                while (Requests[ReqIndex].WriterRank != i)
-                    ReqIndex++;
-                char *IncomingData =
-                    (char *)Requests[ReqIndex].DestinationAddr +
-                    Req.VarRec->PerWriterDataLocation[i][0];
-
-                if (Req.Start.size())
+                continue;
+            }
+            int ReqIndex = 0;
+            while (Requests[ReqIndex].WriterRank != i)
+                ReqIndex++;
+            for (size_t b = 0; b < Req.VarRec->PerWriterBlockCount[i]; b++)
+            {
+                if (!NeedBlock(Req, i, b))
                 {
-                    SelOffset = Req.Start.data();
+                    continue;
                 }
-                if (Req.RequestType == Local)
+                const char *IncomingData =
+                    (char *)Requests[ReqIndex].DestinationAddr +
+                    Req.VarRec->PerWriterDataLocation[i][b];
+                size_t Operated = (size_t)-1;
+                if (Req.VarRec->PerWriterOperator[i])
                 {
-                    int LocalBlockID =
-                        Req.BlockID - Req.VarRec->PerWriterBlockStart[i];
-                    size_t DataOffset = 0;
-                    for (int i = 0; i < LocalBlockID; i++)
-                    {
-                        int BlockElemCount = 1;
-                        for (int j = 0; j < DimCount; j++)
-                        {
-                            BlockElemCount *= RankSize[j];
-                        }
-                        DataOffset += BlockElemCount * ElementSize;
-                        RankSize += DimCount;
-                    }
-                    RankOffset = ZeroRankOffset.data();
-                    GlobalDimensions = ZeroGlobalDimensions.data();
-                    if (SelOffset == NULL)
+                    auto Key = std::make_tuple(Req.VarRec, i, b);
+                    auto It = OperatedIndex.find(Key);
+                    if (It == OperatedIndex.end())
                     {
-                        SelOffset = ZeroSel.data();
+                        It = OperatedIndex
+                                 .emplace(Key, OperatedBlocks.size())
+                                 .first;
+                        OperatedBlocks.push_back(
+                            {Req.VarRec, (size_t)i, b, IncomingData, {}});
                     }
-                    for (int i = 0; i < DimCount; i++)
-                    {
-                        GlobalDimensions[i] = RankSize[i];
-                    }
-                    IncomingData = IncomingData + DataOffset;
-                }
-                if (m_ReaderIsRowMajor)
-                {
-                    ExtractSelectionFromPartialRM(
-                        ElementSize, DimCount, GlobalDimensions, RankOffset,
-                        RankSize, SelOffset, SelSize, IncomingData,
-                        (char *)Req.Data);
-                }
-                else
-                {
-                    ExtractSelectionFromPartialCM(
-                        ElementSize, DimCount, GlobalDimensions, RankOffset,
-                        RankSize, SelOffset, SelSize, IncomingData,
-                        (char *)Req.Data);
+                    Operated = It->second;
                 }
+                Extractions.push_back({&Req, i, b, IncomingData, Operated});
+            }
+        }
+    }
+
+    // operated blocks are independent, threads pick the next one
+    auto lf_Decompress = [&](const size_t o) {
+        DecompressBlock(OperatedBlocks[o]);
+    };
+    if (m_ThreadPool)
+    {
+        m_ThreadPool->ParallelFor(OperatedBlocks.size(), m_Threads,
+                                  lf_Decompress);
+    }
+    else
+    {
+        for (size_t o = 0; o < OperatedBlocks.size(); ++o)
+        {
+            lf_Decompress(o);
+        }
+    }
+
+    for (const auto &E : Extractions)
+    {
+        /* fill destination with this block's part of the selection */
+        const BP5ArrayRequest &Req = *E.Req;
+        int ElementSize = Req.VarRec->ElementSize;
+        int DimCount = Req.VarRec->DimCount;
+        const size_t *GlobalDimensions = Req.VarRec->GlobalDims;
+        const size_t *RankOffset =
+            Req.VarRec->PerWriterStart[E.WriterRank]
+                ? Req.VarRec->PerWriterStart[E.WriterRank] + E.Block * DimCount
+                : NULL;
+        const size_t *RankSize =
+            Req.VarRec->PerWriterCounts[E.WriterRank] + E.Block * DimCount;
+        std::vector<size_t> ZeroSel(DimCount);
+        std::vector<size_t> ZeroRankOffset(DimCount);
+        const size_t *SelOffset = NULL;
+        const size_t *SelSize = Req.Count.data();
+        const char *IncomingData = E.IncomingData;
+        if (E.Operated != (size_t)-1)
+        {
+            IncomingData = OperatedBlocks[E.Operated].Output.data();
+            if (OperatedBlocks[E.Operated].Output.empty())
+            {
+                continue;
+            }
+        }
+
+        if (Req.Start.size())
+        {
+            SelOffset = Req.Start.data();
+        }
+        if (Req.RequestType == Local)
+        {
+            RankOffset = ZeroRankOffset.data();
+            GlobalDimensions = RankSize;
+            if (SelOffset == NULL)
+            {
+                SelOffset = ZeroSel.data();
             }
         }
+        if (m_ReaderIsRowMajor)
+        {
+            ExtractSelectionFromPartialRM(
+                ElementSize, DimCount, GlobalDimensions, RankOffset, RankSize,
+                SelOffset, SelSize, IncomingData, (char *)Req.Data);
+        }
+        else
+        {
+            ExtractSelectionFromPartialCM(
+                ElementSize, DimCount, GlobalDimensions, RankOffset, RankSize,
+                SelOffset, SelSize, IncomingData, (char *)Req.Data);
+        }
     }
     for (const auto &Req : Requests)
     {
-        free((char *)Req.DestinationAddr);
+        if (!Req.Mapped)
+        {
+            free((char *)Req.DestinationAddr);
+        }
     }
     PendingRequests.clear();
 }
@@ -999,6 +1368,10 @@ BP5Deserializer::BP5Deserializer(int WriterCount, bool WriterIsRowMajor,
 
 BP5Deserializer::~BP5Deserializer()
 {
+    for (auto &Context : m_DecodeContexts)
+    {
+        free_FFSContext(Context);
+    }
     free_FFSContext(ReaderFFSContext);
     for (int i = 0; i < m_WriterCohortSize; i++)
     {
@@ -1019,9 +1392,11 @@ BP5Deserializer::~BP5Deserializer()
     // 	}
     struct ControlInfo *tmp = ControlBlocks;
     ControlBlocks = NULL;
+    ControlByFormat.clear();
     while (tmp)
     {
         struct ControlInfo *next = tmp->Next;
+        delete tmp->VarIndex;
         free(tmp);
         tmp = next;
     }
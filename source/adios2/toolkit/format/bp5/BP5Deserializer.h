@@ -43,22 +43,40 @@ public:
         size_t StartOffset;
         size_t ReadLength;
         char *DestinationAddr;
+        /** DestinationAddr points into a file mapping, it is not freed */
+        bool Mapped;
         void *Internal;
     };
     void InstallMetaMetaData(MetaMetaInfoBlock &MMList);
     void InstallMetaData(void *MetadataBlock, size_t BlockLen,
                          size_t WriterRank);
+    /** Installs the metadata blocks of writers 0 to MetadataBlocks.size() - 1
+     * for the step, decoding them concurrently with m_Threads */
+    void InstallMetaData(const std::vector<void *> &MetadataBlocks,
+                         const std::vector<size_t> &BlockLens);
     void InstallAttributeData(void *AttributeBlock, size_t BlockLen);
     void SetupForTimestep(size_t t);
     // return from QueueGet is true if a sync is needed to fill the data
     bool QueueGet(core::VariableBase &variable, void *DestData);
 
-    std::vector<ReadRequest> GenerateReadRequests();
+    /** @param doAllocation false: DestinationAddr is left NULL, the caller
+     * sets it to malloc'ed memory or to a file mapping */
+    std::vector<ReadRequest>
+    GenerateReadRequests(const bool doAllocation = true);
     void FinalizeGets(std::vector<ReadRequest>);
 
     bool m_WriterIsRowMajor = 1;
     bool m_ReaderIsRowMajor = 1;
     core::Engine *m_Engine = NULL;
+    /** threads decoding the metadata blocks of a step and decompressing the
+     * operated blocks of FinalizeGets */
+    unsigned int m_Threads = 1;
+    /** runs the m_Threads, set by the engine, nullptr works serially */
+    helper::ThreadPool *m_ThreadPool = nullptr;
+    /** true: the per-writer records of a variable are merged on its first
+     * Get in the step instead of by InstallMetaData, for readers getting
+     * few of many variables */
+    bool m_LazyMetadata = false;
 
     template <class T>
     std::vector<typename core::Variable<T>::BPInfo>
@@ -81,6 +99,12 @@ private:
         std::vector<void *> PerWriterIncomingData;
         std::vector<size_t> PerWriterIncomingSize; // important for compression
         std::vector<size_t *> PerWriterDataLocation;
+        // NULL unless the writer operated the variable
+        std::vector<size_t *> PerWriterDataBlockSize;
+        std::vector<const char *> PerWriterOperator;
+        /** the per-writer records are merged for the step, see
+         * m_LazyMetadata */
+        bool Merged = false;
         BP5VarRec(int WriterSize)
         {
             PerWriterMetaFieldOffset.resize(WriterSize);
@@ -91,6 +115,8 @@ private:
             PerWriterIncomingData.resize(WriterSize);
             PerWriterIncomingSize.resize(WriterSize);
             PerWriterDataLocation.resize(WriterSize);
+            PerWriterDataBlockSize.resize(WriterSize);
+            PerWriterOperator.resize(WriterSize);
         }
     };
 
@@ -100,6 +126,10 @@ private:
         int FieldOffset;
         BP5VarRec *VarRec;
         int IsArray;
+        // offsets of the groups following an array's MetaArrayRec, -1 if
+        // the writer did not add them
+        int OperatorOffset; // MetaOperatorRec
+        int MinMaxOffset;   // MetaMinMaxRec
         DataType Type;
         int ElementSize;
     };
@@ -108,6 +138,8 @@ private:
     {
         FMFormat Format;
         int ControlCount;
+        /** index in Controls of each variable of the format */
+        std::unordered_map<BP5VarRec *, int> *VarIndex;
         struct ControlInfo *Next;
         struct ControlStruct Controls[1];
     };
@@ -127,6 +159,10 @@ private:
     };
 
     FFSContext ReaderFFSContext;
+    /** contexts of the threads decoding metadata besides the calling one,
+     * sharing the formats of ReaderFFSContext. FFS contexts keep decoding
+     * state, so a context decodes one block at a time. */
+    std::vector<FFSContext> m_DecodeContexts;
     int m_WriterCohortSize;
     std::unordered_map<std::string, BP5VarRec *> VarByName;
     std::unordered_map<void *, BP5VarRec *> VarByKey;
@@ -140,9 +176,26 @@ private:
     //  struct ControlInfo *ControlBlocks;
 
     ControlInfo *ControlBlocks = nullptr;
+    /** ControlBlocks by the metadata format they decode */
+    std::unordered_map<FMFormat, ControlInfo *> ControlByFormat;
     ControlInfo *GetPriorControl(FMFormat Format);
     ControlInfo *BuildControl(FMFormat Format);
+    void InstallMetaData(void *const *MetadataBlocks, const size_t *BlockLens,
+                         size_t FirstWriterRank, size_t WriterCount);
+    FFSTypeHandle PrepareDecode(FFSContext Context, char *MetadataBlock);
+    /** records of a writer for a variable, independent of the other writers
+     */
+    void InstallVarRecWriter(const ControlStruct &C, void *BaseData,
+                             size_t WriterRank);
+    /** records of a writer for a variable depending on the prior writers,
+     * called in writer order */
+    void ChainVarRecWriter(const ControlStruct &C, void *BaseData,
+                           size_t WriterRank);
+    /** installs the records of all writers for the variable, see
+     * m_LazyMetadata */
+    void MergeVarRec(BP5VarRec *VarRec);
     bool NameIndicatesArray(const char *Name);
+    bool NameIndicatesArrayField(const char *Name, const char *Suffix);
     DataType TranslateFFSType2ADIOS(const char *Type, int size);
     BP5VarRec *LookupVarByKey(void *Key);
     BP5VarRec *LookupVarByName(const char *Name);
@@ -192,6 +245,19 @@ private:
     };
     std::vector<BP5ArrayRequest> PendingRequests;
     bool NeedWriter(BP5ArrayRequest Req, int i);
+    bool NeedBlock(const BP5ArrayRequest &Req, int i, size_t Block);
+
+    /** block of an operated variable, decompressed once in FinalizeGets
+     * however many requests it serves */
+    struct OperatedBlockRequest
+    {
+        BP5VarRec *VarRec;
+        size_t WriterRank;
+        size_t Block;
+        const char *Input;
+        std::vector<char> Output;
+    };
+    void DecompressBlock(OperatedBlockRequest &Req);
     size_t CurTimestep = 0;
     std::vector<struct ControlInfo *> ActiveControl;
 };
@@ -26,57 +26,85 @@ std::vector<typename core::Variable<T>::BPInfo>
 BP5Deserializer::BlocksInfo(const core::Variable<T> &variable,
                             const size_t step) const
 {
-    auto VarRec = VarByKey.find((void *)&variable)->second;
-    if (!VarRec)
+    // looked up by name, the query toolkit passes copies of the variable
+    auto VarIt = VarByName.find(variable.m_Name);
+    if (VarIt == VarByName.end())
     {
         return std::vector<typename core::Variable<T>::BPInfo>();
     }
+    const BP5VarRec *VarRec = VarIt->second;
     std::vector<typename core::Variable<T>::BPInfo> Ret;
     for (int WriterRank = 0; WriterRank < m_WriterCohortSize; WriterRank++)
     {
-        const void *BaseData = MetadataBaseAddrs[WriterRank];
-        struct ControlStruct *ControlArray =
-            &ActiveControl[WriterRank]->Controls[0];
+        const ControlInfo *Control = ActiveControl[WriterRank];
+        if (!Control)
+        {
+            continue;
+        }
+        const struct ControlStruct *ControlArray = &Control->Controls[0];
         int i = 0;
-        while (ControlArray[i].VarRec != VarRec)
+        while ((i < Control->ControlCount) &&
+               (ControlArray[i].VarRec != VarRec))
             i++;
+        if (i == Control->ControlCount)
+        {
+            continue;
+        }
+        const void *BaseData = MetadataBaseAddrs[WriterRank];
         int FieldOffset = ControlArray[i].FieldOffset;
         void *field_data = (char *)BaseData + FieldOffset;
         MetaArrayRec *meta_base = (MetaArrayRec *)field_data;
-        for (int i = 0; i < VarRec->PerWriterBlockCount[WriterRank]; i++)
+        const MetaMinMaxRec *meta_mm =
+            (ControlArray[i].MinMaxOffset >= 0)
+                ? (const MetaMinMaxRec *)((const char *)BaseData +
+                                          ControlArray[i].MinMaxOffset)
+                : NULL;
+        size_t DimCount = meta_base->Dims;
+        // zero when this writer did not put the variable in the step
+        size_t BlockCount = DimCount ? meta_base->DBCount / DimCount : 0;
+        size_t MinMaxPos = 0;
+        for (size_t b = 0; b < BlockCount; b++)
         {
-            size_t *Offsets = NULL;
-            if (meta_base->Offsets)
-                Offsets = meta_base->Offsets + (i * meta_base->Dims);
             typename core::Variable<T>::BPInfo Tmp;
-            std::vector<size_t> VecShape;
-            std::vector<size_t> VecStart;
-            std::vector<size_t> VecCount;
-            size_t DimCount = meta_base->Dims;
-            size_t *Start = Offsets;
             size_t *Shape = meta_base->Shape;
-            size_t *Count = meta_base->Count;
+            size_t *Count = meta_base->Count + (b * DimCount);
             if (Shape)
             {
-                for (int i = 0; i < DimCount; i++)
-                {
-                    VecShape.push_back(Shape[i]);
-                    VecStart.push_back(Start[i]);
-                    VecCount.push_back(Count[i]);
-                }
+                size_t *Start = meta_base->Offsets + (b * DimCount);
+                Tmp.Shape.assign(Shape, Shape + DimCount);
+                Tmp.Start.assign(Start, Start + DimCount);
             }
-            else
+            Tmp.Count.assign(Count, Count + DimCount);
+            Tmp.Step = step;
+            Tmp.WriterID = WriterRank;
+            Tmp.BlockID = Ret.size();
+            if (meta_mm && (MinMaxPos + 2 <= meta_mm->MinMaxCount))
             {
-                VecShape = {};
-                VecStart = {};
-                for (int i = 0; i < DimCount; i++)
+                const T *MinMax = (const T *)meta_mm->MinMax + MinMaxPos;
+                Tmp.Min = MinMax[0];
+                Tmp.Max = MinMax[1];
+                MinMaxPos += 2;
+                // the writer divided the block in its own dimension order
+                Dims WriterCount = Tmp.Count;
+                if (m_WriterIsRowMajor != m_ReaderIsRowMajor)
+                {
+                    std::reverse(WriterCount.begin(), WriterCount.end());
+                }
+                helper::BlockDivisionInfo SubBlockInfo = helper::DivideBlock(
+                    WriterCount, meta_mm->StatsBlockSize,
+                    helper::BlockDivisionMethod::Contiguous);
+                if (SubBlockInfo.NBlocks > 1)
                 {
-                    VecCount.push_back(Count[i]);
+                    const size_t SubCount = 2 * SubBlockInfo.NBlocks;
+                    if ((m_WriterIsRowMajor == m_ReaderIsRowMajor) &&
+                        (MinMaxPos + SubCount <= meta_mm->MinMaxCount))
+                    {
+                        Tmp.MinMaxs.assign(MinMax + 2, MinMax + 2 + SubCount);
+                        Tmp.SubBlockInfo = SubBlockInfo;
+                    }
+                    MinMaxPos += SubCount;
                 }
             }
-            Tmp.Shape = VecShape;
-            Tmp.Start = VecStart;
-            Tmp.Count = VecCount;
             Ret.push_back(Tmp);
         }
     }
@@ -8,9 +8,12 @@
 
 #include "adios2/core/Attribute.h"
 #include "adios2/core/IO.h"
+#include "adios2/helper/adiosMath.h"
 #include "adios2/helper/adiosMemory.h"
 #include "adios2/toolkit/format/buffer/ffs/BufferFFS.h"
+#include "adios2/toolkit/format/buffer/malloc/MallocV.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include "BP5Serializer.h"
@@ -27,6 +30,8 @@ namespace format
 BP5Serializer::BP5Serializer() { Init(); }
 BP5Serializer::~BP5Serializer()
 {
+    if (CurDataBuffer)
+        delete CurDataBuffer;
     if (Info.RecList)
         free(Info.RecList);
     if (Info.MetaFieldCount)
@@ -52,6 +57,7 @@ void BP5Serializer::Init()
     memset(&Info, 0, sizeof(Info));
     Info.RecCount = 0;
     Info.RecList = (BP5Serializer::BP5WriterRec)malloc(sizeof(Info.RecList[0]));
+    RecListCapacity = 1;
     Info.MetaFieldCount = 0;
     Info.MetaFields = NULL;
     Info.DataFieldCount = 0;
@@ -72,15 +78,12 @@ void BP5Serializer::Init()
 }
 BP5Serializer::BP5WriterRec BP5Serializer::LookupWriterRec(void *Key)
 {
-    for (int i = 0; i < Info.RecCount; i++)
+    auto it = RecByKey.find(Key);
+    if (it == RecByKey.end())
     {
-        if (Info.RecList[i].Key == Key)
-        {
-            return &Info.RecList[i];
-        }
+        return NULL;
     }
-
-    return NULL;
+    return &Info.RecList[it->second];
 }
 
 void BP5Serializer::RecalcMarshalStorageSize()
@@ -246,6 +249,19 @@ char *BP5Serializer::BuildArrayBlockCountName(const char *base_name,
     return Ret;
 }
 
+char *BP5Serializer::BuildArrayFieldName(const char *base_name,
+                                         const int type,
+                                         const int element_size,
+                                         const char *suffix)
+{
+    int Len = strlen(base_name) + strlen(suffix) + strlen("SST_") + 24;
+    char *Ret = (char *)malloc(Len);
+    sprintf(Ret, "SST%d_%d_", element_size, type);
+    strcat(Ret, base_name);
+    strcat(Ret, suffix);
+    return Ret;
+}
+
 char *BP5Serializer::TranslateADIOS2Type2FFS(const DataType Type)
 {
     switch (Type)
@@ -317,15 +333,23 @@ BP5Serializer::BP5WriterRec
 BP5Serializer::CreateWriterRec(void *Variable, const char *Name, DataType Type,
                                size_t ElemSize, size_t DimCount)
 {
-    Info.RecList = (BP5WriterRec)realloc(
-        Info.RecList, (Info.RecCount + 1) * sizeof(Info.RecList[0]));
+    if (static_cast<size_t>(Info.RecCount) == RecListCapacity)
+    {
+        // records are never removed, grow geometrically for many variables
+        RecListCapacity *= 2;
+        Info.RecList = (BP5WriterRec)realloc(
+            Info.RecList, RecListCapacity * sizeof(Info.RecList[0]));
+    }
     BP5WriterRec Rec = &Info.RecList[Info.RecCount];
+    RecByKey[Variable] = Info.RecCount;
     if (Type == DataType::String)
         ElemSize = sizeof(char *);
     Rec->Key = Variable;
     Rec->FieldID = Info.RecCount;
     Rec->DimCount = DimCount;
     Rec->Type = (int)Type;
+    Rec->OperatorOffset = (size_t)-1;
+    Rec->MinMaxOffset = (size_t)-1;
     if (DimCount == 0)
     {
         // simple field, only add base value FMField to metadata
@@ -367,6 +391,44 @@ BP5Serializer::CreateWriterRec(void *Variable, const char *Name, DataType Type,
                          DataType::Int64, sizeof(size_t), ArrayDBCount);
         AddVarArrayField(&Info.MetaFields, &Info.MetaFieldCount, LocationsName,
                          DataType::Int64, sizeof(size_t), ArrayBlockCount);
+        if (FindOperation(*static_cast<core::VariableBase *>(Variable), Type))
+        {
+            // MetaOperatorRec, the reader recognizes it by the DataBlockSize
+            // field following the MetaArrayRec
+            char *DataBlockSizeName =
+                BuildArrayFieldName(Name, (int)Type, ElemSize, "DataBlockSize");
+            char *OperatorTypeName = ConcatName(Name, "OperatorType");
+            AddVarArrayField(&Info.MetaFields, &Info.MetaFieldCount,
+                             DataBlockSizeName, DataType::Int64,
+                             sizeof(size_t), ArrayBlockCount);
+            Rec->OperatorOffset =
+                Info.MetaFields[Info.MetaFieldCount - 1].field_offset;
+            AddField(&Info.MetaFields, &Info.MetaFieldCount, OperatorTypeName,
+                     DataType::String, sizeof(char *));
+            free(DataBlockSizeName);
+            free(OperatorTypeName);
+        }
+        if ((m_StatsLevel > 0) && MinMaxPossible(Type))
+        {
+            // MetaMinMaxRec, the reader recognizes it by the StatsBlockSize
+            // field
+            char *StatsBlockSizeName = BuildArrayFieldName(
+                Name, (int)Type, ElemSize, "StatsBlockSize");
+            char *MinMaxCountName =
+                BuildArrayFieldName(Name, (int)Type, ElemSize, "MinMaxCount");
+            char *MinMaxName = ConcatName(Name, "MinMax");
+            AddField(&Info.MetaFields, &Info.MetaFieldCount,
+                     StatsBlockSizeName, DataType::Int64, sizeof(size_t));
+            Rec->MinMaxOffset =
+                Info.MetaFields[Info.MetaFieldCount - 1].field_offset;
+            AddField(&Info.MetaFields, &Info.MetaFieldCount, MinMaxCountName,
+                     DataType::Int64, sizeof(size_t));
+            AddVarArrayField(&Info.MetaFields, &Info.MetaFieldCount,
+                             MinMaxName, Type, ElemSize, MinMaxCountName);
+            free(StatsBlockSizeName);
+            free(MinMaxCountName);
+            free(MinMaxName);
+        }
         free(ArrayDBCount);
         free(ArrayBlockCount);
         free(ShapeName);
@@ -429,11 +491,236 @@ size_t BP5Serializer::CalcSize(const size_t Count, const size_t *Vals)
     return Elems;
 }
 
+bool BP5Serializer::MinMaxPossible(const DataType Type)
+{
+    switch (Type)
+    {
+    case DataType::Int8:
+    case DataType::Int16:
+    case DataType::Int32:
+    case DataType::Int64:
+    case DataType::UInt8:
+    case DataType::UInt16:
+    case DataType::UInt32:
+    case DataType::UInt64:
+    case DataType::Char:
+    case DataType::Float:
+    case DataType::Double:
+    case DataType::LongDouble:
+        return true;
+    default:
+        return false;
+    }
+}
+
+size_t BP5Serializer::AppendMinMax(MetaMinMaxRec *MetaEntry,
+                                   const DataType Type, size_t ElemSize,
+                                   size_t DimCount, const size_t *Count,
+                                   const void *Data)
+{
+    const Dims BlockCount(Count, Count + DimCount);
+    const size_t NSubBlocks =
+        helper::DivideBlock(BlockCount, m_StatsBlockSize,
+                            helper::BlockDivisionMethod::Contiguous)
+            .NBlocks;
+    // block min, max then the sub-block pairs, as in the BP4 characteristic
+    const size_t NewCount = 2 + (NSubBlocks > 1 ? 2 * NSubBlocks : 0);
+    MetaEntry->MinMax = realloc(MetaEntry->MinMax,
+                                (MetaEntry->MinMaxCount + NewCount) * ElemSize);
+    const size_t Index = MetaEntry->MinMaxCount;
+    MetaEntry->MinMaxCount += NewCount;
+
+    if (Data)
+    {
+        ComputeMinMax((char *)MetaEntry->MinMax + Index * ElemSize, Type,
+                      BlockCount, Data);
+    }
+    return Index;
+}
+
+void BP5Serializer::ComputeMinMax(char *Dest, const DataType Type,
+                                  const Dims &Count, const void *Data)
+{
+    const helper::BlockDivisionInfo SubBlockInfo = helper::DivideBlock(
+        Count, m_StatsBlockSize, helper::BlockDivisionMethod::Contiguous);
+
+    if (Type == DataType::None)
+    {
+    }
+#define declare_type(T)                                                        \
+    else if (Type == helper::GetDataType<T>())                                 \
+    {                                                                          \
+        std::vector<T> MinMaxs;                                                \
+        T Min = {};                                                            \
+        T Max = {};                                                            \
+        helper::GetMinMaxSubblocks(static_cast<const T *>(Data), Count,        \
+                                   SubBlockInfo, MinMaxs, Min, Max, 1);        \
+        memcpy(Dest, &Min, sizeof(T));                                         \
+        memcpy(Dest + sizeof(T), &Max, sizeof(T));                             \
+        if (SubBlockInfo.NBlocks > 1)                                          \
+        {                                                                      \
+            memcpy(Dest + 2 * sizeof(T), MinMaxs.data(),                       \
+                   MinMaxs.size() * sizeof(T));                                \
+        }                                                                      \
+    }
+    ADIOS2_FOREACH_ATTRIBUTE_PRIMITIVE_STDTYPE_1ARG(declare_type)
+#undef declare_type
+}
+
+void BP5Serializer::ComputeDeferredMinMax()
+{
+    for (const auto &D : DeferredMinMaxs)
+    {
+        MetaMinMaxRec *MMEntry =
+            (MetaMinMaxRec *)((char *)(MetadataBuf) + D.MinMaxOffset);
+        ComputeMinMax((char *)MMEntry->MinMax + D.Index * D.ElemSize, D.Type,
+                      D.Count,
+                      CurDataBuffer->GetPtr(D.Pos.bufferIdx,
+                                            D.Pos.posInBuffer));
+    }
+    DeferredMinMaxs.clear();
+}
+
+const core::VariableBase::Operation *
+BP5Serializer::FindOperation(const core::VariableBase &Variable,
+                             const DataType Type)
+{
+    // TODO: we only take the first operation for now, as BP4
+    if (Variable.m_Operations.empty() ||
+        !Variable.m_Operations[0].Op->IsDataTypeValid(Type))
+    {
+        return NULL;
+    }
+    return &Variable.m_Operations[0];
+}
+
+BP5Serializer::OperatedBlock
+BP5Serializer::OperateBlock(const core::VariableBase::Operation &Operation,
+                            const DataType Type, size_t ElemSize,
+                            const Dims &Count, const void *Data)
+{
+    OperatedBlock Ret;
+    const size_t InputSize = helper::GetTotalSize(Count) * ElemSize;
+    if (InputSize == 0)
+    {
+        return Ret;
+    }
+
+    size_t MaxSize;
+    try
+    {
+        MaxSize = Operation.Op->BufferMaxSize(InputSize);
+    }
+    catch (std::invalid_argument &)
+    {
+        // operators bounding their output by the input shape only (zfp) or
+        // not at all, BP4 sizes its buffer by the input too
+        MaxSize = 2 * InputSize + 1024;
+    }
+    Ret.Payload.resize(MaxSize);
+
+    // Info is per block, several blocks may be operated at once
+    Params OperatorInfo;
+    const size_t OutputSize =
+        Operation.Op->Compress(Data, Count, ElemSize, Type, Ret.Payload.data(),
+                               Operation.Parameters, OperatorInfo);
+    Ret.Payload.resize(OutputSize);
+
+    Params HeaderInfo(Operation.Parameters);
+    for (const auto &Item : OperatorInfo)
+    {
+        HeaderInfo[Item.first] = Item.second;
+    }
+    HeaderInfo["InputSize"] = std::to_string(InputSize);
+    HeaderInfo["PreDataType"] = ToString(Type);
+    for (const auto &Item : HeaderInfo)
+    {
+        if (!Item.first.empty() && !Item.second.empty())
+        {
+            Ret.Header += Item.first + "=" + Item.second + "\n";
+        }
+    }
+    return Ret;
+}
+
+size_t BP5Serializer::AddOperatedBlock(const OperatedBlock &Block,
+                                       size_t *BlockSize)
+{
+    if (Block.Payload.empty())
+    {
+        *BlockSize = 0;
+        return CurDataBuffer->AddToVec(0, NULL, 1, true);
+    }
+    // header and payload are contiguous, nothing aligns the payload
+    const size_t Offset = CurDataBuffer->AddToVec(
+        Block.Header.size() + 1, Block.Header.c_str(), sizeof(size_t), true);
+    CurDataBuffer->AddToVec(Block.Payload.size(), Block.Payload.data(), 1,
+                            true);
+    *BlockSize = Block.Header.size() + 1 + Block.Payload.size();
+    return Offset;
+}
+
+void BP5Serializer::OperateDeferredBlocks()
+{
+    if (DeferredOperations.empty())
+    {
+        return;
+    }
+
+    // blocks are independent, threads pick the next one
+    auto lf_Operate = [&](const size_t i) {
+        DeferredOperation &D = DeferredOperations[i];
+        D.Result =
+            OperateBlock(D.Operation, D.Type, D.ElemSize, D.Count, D.Data);
+    };
+    if (m_ThreadPool)
+    {
+        m_ThreadPool->ParallelFor(DeferredOperations.size(), m_Threads,
+                                  lf_Operate);
+    }
+    else
+    {
+        for (size_t i = 0; i < DeferredOperations.size(); ++i)
+        {
+            lf_Operate(i);
+        }
+    }
+
+    // appended in put order so the data layout does not depend on threads
+    for (const auto &D : DeferredOperations)
+    {
+        MetaArrayRec *MetaEntry =
+            (MetaArrayRec *)((char *)(MetadataBuf) + D.MetaOffset);
+        MetaOperatorRec *OpEntry =
+            (MetaOperatorRec *)((char *)(MetadataBuf) + D.OperatorOffset);
+        MetaEntry->DataLocation[D.Block] =
+            AddOperatedBlock(D.Result, &OpEntry->DataBlockSize[D.Block]);
+    }
+    DeferredOperations.clear();
+}
+
+void *BP5Serializer::GetPtr(const size_t bufferIdx,
+                            const size_t posInBuffer) noexcept
+{
+    return CurDataBuffer->GetPtr(bufferIdx, posInBuffer);
+}
+
+void BP5Serializer::InitStep(BufferV *DataBuffer)
+{
+    if (CurDataBuffer != NULL)
+    {
+        throw std::logic_error(
+            "ERROR: BP5Serializer::InitStep called with a step already open");
+    }
+    CurDataBuffer = DataBuffer;
+}
+
 void BP5Serializer::Marshal(void *Variable, const char *Name,
                             const DataType Type, size_t ElemSize,
                             size_t DimCount, const size_t *Shape,
                             const size_t *Count, const size_t *Offsets,
-                            const void *Data, bool Sync)
+                            const void *Data, bool Sync,
+                            BufferV::BufferPos *Span)
 {
 
     FFSMetadataInfoStruct *MBase;
@@ -466,16 +753,54 @@ void BP5Serializer::Marshal(void *Variable, const char *Name,
         MetaArrayRec *MetaEntry =
             (MetaArrayRec *)((char *)(MetadataBuf) + Rec->MetaOffset);
         size_t ElemCount = CalcSize(DimCount, Count);
-        size_t DataOffset;
+        size_t DataOffset = 0;
+        size_t OperatedSize = 0;
+        const core::VariableBase::Operation *Operation = NULL;
 
         /* handle metadata */
         MetaEntry->Dims = DimCount;
         if (CurDataBuffer == NULL)
         {
-            CurDataBuffer = new BufferV("data buffer");
+            CurDataBuffer = new MallocV("BP5Serializer");
+        }
+        if (Rec->OperatorOffset != (size_t)-1)
+        {
+            Operation = FindOperation(
+                *static_cast<core::VariableBase *>(Variable), Type);
+            if (!Operation)
+            {
+                throw std::invalid_argument(
+                    "ERROR: the operations of variable " + std::string(Name) +
+                    " were removed after its first Put, not supported by "
+                    "BP5, in call to Put\n");
+            }
+            if (Span)
+            {
+                throw std::invalid_argument(
+                    "ERROR: variable " + std::string(Name) +
+                    " has operations, returning a Span is not supported by "
+                    "BP5 for operated variables, in call to Put\n");
+            }
+            if (Sync)
+            {
+                // the application may reuse Data when Put returns
+                DataOffset = AddOperatedBlock(
+                    OperateBlock(*Operation, Type, ElemSize,
+                                 Dims(Count, Count + DimCount), Data),
+                    &OperatedSize);
+            }
+            // deferred blocks get their location in CloseTimestep
+        }
+        else if (Span)
+        {
+            *Span = CurDataBuffer->Allocate(ElemCount * ElemSize, ElemSize);
+            DataOffset = Span->globalPos;
+        }
+        else
+        {
+            DataOffset = CurDataBuffer->AddToVec(ElemCount * ElemSize, Data,
+                                                 ElemSize, Sync);
         }
-        DataOffset =
-            CurDataBuffer->AddToVec(ElemCount * ElemSize, Data, ElemSize, Sync);
 
         if (!AlreadyWritten)
         {
@@ -513,6 +838,48 @@ void BP5Serializer::Marshal(void *Variable, const char *Name,
                 MetaEntry->Offsets = AppendDims(
                     MetaEntry->Offsets, PreviousDBCount, DimCount, Offsets);
         }
+        if (Operation)
+        {
+            MetaOperatorRec *OpEntry =
+                (MetaOperatorRec *)((char *)(MetadataBuf) +
+                                    Rec->OperatorOffset);
+            if (!AlreadyWritten)
+            {
+                OpEntry->DataBlockSize = NULL;
+                OpEntry->OperatorType = strdup(Operation->Op->m_Type.c_str());
+            }
+            OpEntry->DataBlockSize = (size_t *)realloc(
+                OpEntry->DataBlockSize, MetaEntry->BlockCount * sizeof(size_t));
+            OpEntry->DataBlockSize[MetaEntry->BlockCount - 1] = OperatedSize;
+            if (!Sync)
+            {
+                DeferredOperations.push_back(
+                    {Rec->MetaOffset, Rec->OperatorOffset,
+                     MetaEntry->BlockCount - 1, *Operation, Type, ElemSize,
+                     Dims(Count, Count + DimCount), Data, OperatedBlock()});
+            }
+        }
+        if (Rec->MinMaxOffset != (size_t)-1)
+        {
+            MetaMinMaxRec *MMEntry =
+                (MetaMinMaxRec *)((char *)(MetadataBuf) + Rec->MinMaxOffset);
+            if (!AlreadyWritten)
+            {
+                MMEntry->StatsBlockSize = m_StatsBlockSize;
+                MMEntry->MinMaxCount = 0;
+                MMEntry->MinMax = NULL;
+            }
+            const size_t Index = AppendMinMax(MMEntry, Type, ElemSize,
+                                              DimCount, Count,
+                                              Span ? NULL : Data);
+            if (Span)
+            {
+                DeferredMinMaxs.push_back({Rec->MinMaxOffset, Index, Type,
+                                           ElemSize,
+                                           Dims(Count, Count + DimCount),
+                                           *Span});
+            }
+        }
 
         //            if ((Stream->ConfigParams->CompressionMethod ==
         //            SstCompressZFP) &&
@@ -667,8 +1034,10 @@ BP5Serializer::TimestepInfo BP5Serializer::CloseTimestep(int timestep)
 
     if (CurDataBuffer == NULL)
     {
-        CurDataBuffer = new BufferV("data buffer");
+        CurDataBuffer = new MallocV("BP5Serializer");
     }
+    ComputeDeferredMinMax();
+    OperateDeferredBlocks();
     MBase->DataBlockSize = CurDataBuffer->AddToVec(
         0, NULL, 8, true); //  output block size multiple of 8, offset is size
 
@@ -11,11 +11,15 @@
 #include "BP5Base.h"
 #include "adios2/core/Attribute.h"
 #include "adios2/core/IO.h"
+#include "adios2/core/VariableBase.h"
 #include "adios2/toolkit/format/buffer/BufferV.h"
 #include "adios2/toolkit/format/buffer/heap/BufferSTL.h"
 #include "atl.h"
 #include "ffs.h"
 #include "fm.h"
+
+#include <unordered_map>
+
 #ifdef _WIN32
 #pragma warning(disable : 4250)
 #endif
@@ -59,16 +63,44 @@ public:
         Buffer BackingBuffer;
     } AggregatedMetadataInfo;
 
+    /**
+     * Sets the buffer the data of the next step is marshaled into, takes
+     * ownership (released with TimestepInfo). If not called, a MallocV
+     * is created on the first Marshal of the step.
+     */
+    void InitStep(BufferV *DataBuffer);
+    /**
+     * Adds a block of Variable to the step
+     * @param Span if not NULL, Data is ignored and the block's space is
+     * allocated in the data buffer and returned in Span, for the application
+     * to produce the data in place before CloseTimestep
+     */
     void Marshal(void *Variable, const char *Name, const DataType Type,
                  size_t ElemSize, size_t DimCount, const size_t *Shape,
                  const size_t *Count, const size_t *Offsets, const void *Data,
-                 bool Sync);
+                 bool Sync, BufferV::BufferPos *Span = NULL);
     void MarshalAttribute(const char *Name, const DataType Type,
                           size_t ElemSize, size_t ElemCount, const void *Data);
     TimestepInfo CloseTimestep(int timestep);
 
+    /** current address of a block allocated by Marshal with Span */
+    void *GetPtr(const size_t bufferIdx, const size_t posInBuffer) noexcept;
+
     core::Engine *m_Engine = NULL;
 
+    /** 0: no statistics, otherwise the min/max of every block of the arrays
+     * of primitive, non-complex types are added to the metadata */
+    unsigned int m_StatsLevel = 1;
+    /** blocks larger than this many elements also get the min/max of their
+     * sub-blocks, as in BP4 */
+    size_t m_StatsBlockSize = 1125899906842624ULL;
+
+    /** threads operating (compressing) the blocks of deferred puts in
+     * CloseTimestep, independent blocks are operated concurrently */
+    unsigned int m_Threads = 1;
+    /** runs the m_Threads, set by the engine, nullptr operates serially */
+    helper::ThreadPool *m_ThreadPool = nullptr;
+
     std::vector<char> CopyMetadataToContiguous(
         const std::vector<MetaMetaInfoBlock> NewmetaMetaBlocks,
         const format::Buffer *MetaEncodeBuffer,
@@ -92,8 +124,47 @@ private:
         size_t MetaOffset;
         int DimCount;
         int Type;
+        // offsets in MetadataBuf of the groups following the MetaArrayRec,
+        // (size_t)-1 if the variable has none
+        size_t OperatorOffset; // MetaOperatorRec
+        size_t MinMaxOffset;   // MetaMinMaxRec
     } * BP5WriterRec;
 
+    /** operated block, Header is "key=value\n" lines of everything the
+     * reader's BPOperation needs and is written NUL-terminated before
+     * Payload */
+    struct OperatedBlock
+    {
+        std::string Header;
+        std::vector<char> Payload;
+    };
+
+    /** deferred put of an operated variable, operated in CloseTimestep */
+    struct DeferredOperation
+    {
+        size_t MetaOffset;
+        size_t OperatorOffset;
+        size_t Block;
+        core::VariableBase::Operation Operation;
+        DataType Type;
+        size_t ElemSize;
+        Dims Count;
+        const void *Data;
+        OperatedBlock Result;
+    };
+
+    /** span put of an array with statistics, its min/max are computed in
+     * CloseTimestep once the application produced the data */
+    struct DeferredMinMax
+    {
+        size_t MinMaxOffset;
+        size_t Index; // of the block's first entry in MetaMinMaxRec::MinMax
+        DataType Type;
+        size_t ElemSize;
+        Dims Count;
+        BufferV::BufferPos Pos;
+    };
+
     struct FFSWriterMarshalBase
     {
         int RecCount = 0;
@@ -115,12 +186,18 @@ private:
     };
 
     FFSWriterMarshalBase Info;
+    /** Info.RecList entries allocated, grown geometrically */
+    size_t RecListCapacity = 0;
+    /** index in Info.RecList of the record of a variable, by Key */
+    std::unordered_map<void *, size_t> RecByKey;
     void *MetadataBuf = NULL;
     bool NewAttribute = false;
 
     size_t MetadataSize = 0;
     BufferV *CurDataBuffer = NULL;
     std::vector<MetaMetaInfoBlock> PreviousMetaMetaInfoBlocks;
+    std::vector<DeferredOperation> DeferredOperations;
+    std::vector<DeferredMinMax> DeferredMinMaxs;
 
     BP5WriterRec LookupWriterRec(void *Key);
     BP5WriterRec CreateWriterRec(void *Variable, const char *Name,
@@ -148,11 +225,29 @@ private:
                                 const int element_size);
     char *BuildArrayBlockCountName(const char *base_name, const int type,
                                    const int element_size);
+    char *BuildArrayFieldName(const char *base_name, const int type,
+                              const int element_size, const char *suffix);
     char *TranslateADIOS2Type2FFS(const DataType Type);
     size_t *CopyDims(const size_t Count, const size_t *Vals);
     size_t *AppendDims(size_t *OldDims, const size_t OldCount,
                        const size_t Count, const size_t *Vals);
     size_t CalcSize(const size_t Count, const size_t *Vals);
+    bool MinMaxPossible(const DataType Type);
+    /** appends the entries of a block, left to ComputeMinMax if Data is NULL
+     * @return index of the block's first entry */
+    size_t AppendMinMax(MetaMinMaxRec *MetaEntry, const DataType Type,
+                        size_t ElemSize, size_t DimCount, const size_t *Count,
+                        const void *Data);
+    void ComputeMinMax(char *Dest, const DataType Type, const Dims &Count,
+                       const void *Data);
+    void ComputeDeferredMinMax();
+    const core::VariableBase::Operation *
+    FindOperation(const core::VariableBase &Variable, const DataType Type);
+    OperatedBlock OperateBlock(const core::VariableBase::Operation &Operation,
+                               const DataType Type, size_t ElemSize,
+                               const Dims &Count, const void *Data);
+    size_t AddOperatedBlock(const OperatedBlock &Block, size_t *BlockSize);
+    void OperateDeferredBlocks();
 
     typedef struct _ArrayRec
     {
@@ -9,37 +9,74 @@
 
 #include "adios2/common/ADIOSConfig.h"
 #include "adios2/common/ADIOSTypes.h"
-#include "heap/BufferSTL.h"
 
 namespace adios2
 {
 namespace format
 {
 
+/**
+ * Abstract vector of data blocks making up one step of output.  Blocks are
+ * either copied into buffer-owned memory or referenced in place (external),
+ * and are handed to transports as a NULL-terminated iovec list.
+ */
 class BufferV
 {
 public:
     const std::string m_Type;
 
-    typedef struct iovec
-    {
-        const void
-            *iov_base;  //  Base address of a memory region for input or output.
-        size_t iov_len; //  The size of the memory pointed to by iov_base.
-    } * BufferV_iovec;
+    typedef core::iovec iovec;
+    typedef iovec *BufferV_iovec;
 
     uint64_t Size() noexcept;
 
     BufferV(const std::string type);
     virtual ~BufferV() = default;
 
-    virtual BufferV_iovec DataVec() noexcept;
-    //  virtual const BufferV_iovec DataVec() const noexcept;
+    /**
+     * Returns a new[] allocated, {NULL, 0} terminated list of the blocks
+     * added so far. Caller owns the list (but not the memory it points to).
+     */
+    virtual BufferV_iovec DataVec() noexcept = 0;
 
+    /**
+     * Adds a block to the vector
+     * @param size of the block in bytes
+     * @param buf start of the block
+     * @param align alignment of the block start relative to the vector start
+     * @param CopyReqd true: data is copied, false: buf is referenced and must
+     * remain valid until the vector is written
+     * @return offset of the block start relative to the vector start
+     */
     virtual size_t AddToVec(const size_t size, const void *buf, int align,
-                            bool CopyReqd);
+                            bool CopyReqd) = 0;
+
+    /** location of space reserved with Allocate */
+    struct BufferPos
+    {
+        size_t bufferIdx;   // internal block holding the space
+        size_t posInBuffer; // offset of the space in that block
+        size_t globalPos;   // offset relative to the vector start
+    };
+
+    /**
+     * Reserves contiguous, uninitialized buffer-owned memory for a block whose
+     * data is produced in place after the call, e.g. by a Span Put
+     * @param size of the block in bytes
+     * @param align alignment of the block start, both relative to the vector
+     * start and in memory
+     * @return location of the block, its address is given by GetPtr
+     */
+    virtual BufferPos Allocate(const size_t size, int align) = 0;
 
-private:
+    /**
+     * Current address of a location returned by Allocate, which may change
+     * with later AddToVec or Allocate calls on buffers that grow by moving
+     */
+    virtual void *GetPtr(const size_t bufferIdx,
+                         const size_t posInBuffer) noexcept = 0;
+
+protected:
     struct VecEntry
     {
         bool External;
@@ -49,8 +86,9 @@ private:
     };
     std::vector<VecEntry> DataV;
     size_t CurOffset = 0;
-    size_t m_internalPos = 0;
-    BufferSTL InternalBlock;
+
+    /** number of zero bytes needed to align CurOffset to align */
+    size_t AlignmentPadding(const int align) const noexcept;
 };
 
 } // end namespace format
@@ -0,0 +1,233 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * ChunkV.cpp
+ *
+ */
+
+#include "ChunkV.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+namespace adios2
+{
+namespace format
+{
+
+ChunkPool::ChunkPool(const size_t ChunkSize) : m_ChunkSize(ChunkSize)
+{
+    if (m_ChunkSize == 0)
+    {
+        throw std::invalid_argument(
+            "ERROR: ChunkPool chunk size must be greater than zero\n");
+    }
+}
+
+ChunkPool::~ChunkPool()
+{
+    for (char *chunk : m_FreeChunks)
+    {
+        free(chunk);
+    }
+}
+
+char *ChunkPool::Acquire()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (!m_FreeChunks.empty())
+        {
+            char *chunk = m_FreeChunks.back();
+            m_FreeChunks.pop_back();
+            return chunk;
+        }
+        ++m_AllocatedCount;
+    }
+    char *chunk = (char *)malloc(m_ChunkSize);
+    if (!chunk)
+    {
+        throw std::runtime_error("ERROR: ChunkPool could not allocate a " +
+                                 std::to_string(m_ChunkSize) +
+                                 " bytes chunk\n");
+    }
+    return chunk;
+}
+
+void ChunkPool::Release(char *chunk) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_FreeChunks.push_back(chunk);
+}
+
+size_t ChunkPool::ChunkSize() const noexcept { return m_ChunkSize; }
+
+size_t ChunkPool::AllocatedCount() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_AllocatedCount;
+}
+
+ChunkV::ChunkV(const std::string type, ChunkPool &pool)
+: BufferV(type), m_Pool(pool), m_ChunkSize(pool.ChunkSize())
+{
+}
+
+ChunkV::~ChunkV()
+{
+    for (char *chunk : m_Chunks)
+    {
+        if (std::find(m_LargeChunks.begin(), m_LargeChunks.end(), chunk) !=
+            m_LargeChunks.end())
+        {
+            free(chunk);
+        }
+        else
+        {
+            m_Pool.Release(chunk);
+        }
+    }
+}
+
+size_t ChunkV::AddToVec(const size_t size, const void *buf, int align,
+                        bool CopyReqd)
+{
+    const size_t padding = AlignmentPadding(align);
+    if (padding)
+    {
+        char zero[16] = {0};
+        AddToVec(padding, zero, 1, true);
+    }
+    size_t retOffset = CurOffset;
+
+    if (size == 0)
+        return CurOffset;
+
+    if (!CopyReqd)
+    {
+        // just add buf to internal version of output vector
+        VecEntry entry = {true, buf, 0, size};
+        DataV.push_back(entry);
+    }
+    else
+    {
+        const char *src = static_cast<const char *>(buf);
+        size_t remaining = size;
+        while (remaining > 0)
+        {
+            if (m_Chunks.empty() || m_TailChunkPos == m_ChunkSize)
+            {
+                m_Chunks.push_back(m_Pool.Acquire());
+                m_TailChunkPos = 0;
+            }
+            char *dest = m_Chunks.back() + m_TailChunkPos;
+            const size_t n = std::min(remaining, m_ChunkSize - m_TailChunkPos);
+            memcpy(dest, src, n);
+            if (DataV.size() && !DataV.back().External &&
+                (static_cast<const char *>(DataV.back().Base) +
+                     DataV.back().Size ==
+                 dest))
+            {
+                // just add to the size of the existing tail entry
+                DataV.back().Size += n;
+            }
+            else
+            {
+                DataV.push_back({false, dest, 0, n});
+            }
+            m_TailChunkPos += n;
+            src += n;
+            remaining -= n;
+        }
+    }
+    CurOffset = retOffset + size;
+    return retOffset;
+}
+
+ChunkV::BufferPos ChunkV::Allocate(const size_t size, int align)
+{
+    const size_t padding = AlignmentPadding(align);
+    if (padding)
+    {
+        char zero[16] = {0};
+        AddToVec(padding, zero, 1, true);
+    }
+
+    // chunks are malloc'ed, aligning the position in the chunk aligns the
+    // address, skipped bytes are not part of the vector
+    size_t pos = m_TailChunkPos;
+    if (pos % align)
+    {
+        pos += align - pos % align;
+    }
+    if (size == 0)
+    {
+        return {m_Chunks.size(), 0, CurOffset};
+    }
+    if (m_Chunks.empty() || pos + size > m_ChunkSize)
+    {
+        pos = 0;
+        if (size > m_ChunkSize)
+        {
+            char *chunk = (char *)malloc(size);
+            if (!chunk)
+            {
+                throw std::runtime_error(
+                    "ERROR: ChunkV::Allocate could not allocate " +
+                    std::to_string(size) + " bytes for " + m_Type + "\n");
+            }
+            m_LargeChunks.push_back(chunk);
+            m_Chunks.push_back(chunk);
+        }
+        else
+        {
+            m_Chunks.push_back(m_Pool.Acquire());
+        }
+    }
+
+    char *dest = m_Chunks.back() + pos;
+    if (DataV.size() && !DataV.back().External &&
+        (static_cast<const char *>(DataV.back().Base) + DataV.back().Size ==
+         dest))
+    {
+        DataV.back().Size += size;
+    }
+    else
+    {
+        DataV.push_back({false, dest, 0, size});
+    }
+    // a large block is full, the next copy starts a new chunk
+    m_TailChunkPos = size > m_ChunkSize ? m_ChunkSize : pos + size;
+
+    const BufferPos ret = {m_Chunks.size() - 1, pos, CurOffset};
+    CurOffset += size;
+    return ret;
+}
+
+void *ChunkV::GetPtr(const size_t bufferIdx, const size_t posInBuffer) noexcept
+{
+    if (bufferIdx >= m_Chunks.size())
+    {
+        // empty block
+        return NULL;
+    }
+    return m_Chunks[bufferIdx] + posInBuffer;
+}
+
+ChunkV::BufferV_iovec ChunkV::DataVec() noexcept
+{
+    BufferV_iovec ret = new iovec[DataV.size() + 1];
+    for (std::size_t i = 0; i < DataV.size(); ++i)
+    {
+        ret[i].iov_base = DataV[i].Base;
+        ret[i].iov_len = DataV[i].Size;
+    }
+    ret[DataV.size()] = {NULL, 0};
+    return ret;
+}
+
+} // end namespace format
+} // end namespace adios2
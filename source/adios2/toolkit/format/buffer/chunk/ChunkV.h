@@ -0,0 +1,91 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * ChunkV.h
+ *
+ */
+
+#ifndef ADIOS2_TOOLKIT_FORMAT_BUFFER_CHUNK_CHUNKV_H_
+#define ADIOS2_TOOLKIT_FORMAT_BUFFER_CHUNK_CHUNKV_H_
+
+#include "adios2/common/ADIOSConfig.h"
+#include "adios2/common/ADIOSTypes.h"
+
+#include "adios2/toolkit/format/buffer/BufferV.h"
+
+#include <mutex>
+
+namespace adios2
+{
+namespace format
+{
+
+/**
+ * Pool of fixed-size memory chunks shared by all ChunkV buffers of an
+ * engine. Chunks released by a finished step are handed out again to the
+ * next one instead of being freed. Thread-safe, so buffers can be released
+ * from a different thread than the one filling new ones.
+ */
+class ChunkPool
+{
+public:
+    ChunkPool(const size_t ChunkSize);
+    ~ChunkPool();
+
+    /** @return a chunk of ChunkSize() bytes, recycled if available */
+    char *Acquire();
+
+    /** gives chunk back to the pool for later reuse */
+    void Release(char *chunk) noexcept;
+
+    size_t ChunkSize() const noexcept;
+
+    /** number of chunks ever allocated by this pool */
+    size_t AllocatedCount() const noexcept;
+
+private:
+    const size_t m_ChunkSize;
+    mutable std::mutex m_Mutex;
+    std::vector<char *> m_FreeChunks;
+    size_t m_AllocatedCount = 0;
+};
+
+/**
+ * BufferV that copies data into a list of fixed-size chunks taken from a
+ * ChunkPool. Copied data is never moved once written, so buffering costs
+ * O(bytes) and block addresses are stable as soon as AddToVec returns.
+ * Copies larger than the remaining space in a chunk continue in the next one,
+ * while allocated blocks always get contiguous space, in a dedicated block
+ * when larger than a chunk.
+ */
+class ChunkV : public BufferV
+{
+public:
+    ChunkV(const std::string type, ChunkPool &pool);
+    virtual ~ChunkV();
+
+    virtual BufferV_iovec DataVec() noexcept;
+
+    virtual size_t AddToVec(const size_t size, const void *buf, int align,
+                            bool CopyReqd);
+
+    virtual BufferPos Allocate(const size_t size, int align);
+
+    virtual void *GetPtr(const size_t bufferIdx,
+                         const size_t posInBuffer) noexcept;
+
+private:
+    ChunkPool &m_Pool;
+    const size_t m_ChunkSize;
+    std::vector<char *> m_Chunks;
+    /** blocks of m_Chunks larger than a chunk, freed instead of released */
+    std::vector<char *> m_LargeChunks;
+    /** bytes used in m_Chunks.back() */
+    size_t m_TailChunkPos = 0;
+};
+
+} // end namespace format
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_FORMAT_BUFFER_CHUNK_CHUNKV_H_ */
@@ -0,0 +1,164 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * MallocV.cpp
+ *
+ */
+
+#include "MallocV.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+namespace adios2
+{
+namespace format
+{
+
+MallocV::MallocV(const std::string type, const size_t InitialBufferSize,
+                 const float GrowthFactor)
+: BufferV(type), m_InitialBufferSize(InitialBufferSize),
+  m_GrowthFactor(GrowthFactor)
+{
+}
+
+MallocV::~MallocV()
+{
+    if (m_InternalBlock)
+        free(m_InternalBlock);
+}
+
+void MallocV::Reserve(const size_t size)
+{
+    if (size <= m_AllocatedSize)
+    {
+        return;
+    }
+    // grow geometrically so that many small copies stay amortized
+    size_t NewSize =
+        std::max(static_cast<size_t>(m_AllocatedSize * m_GrowthFactor),
+                 std::max(size, m_InitialBufferSize));
+    char *NewBlock = (char *)realloc(m_InternalBlock, NewSize);
+    if (!NewBlock)
+    {
+        throw std::runtime_error("ERROR: MallocV could not allocate " +
+                                 std::to_string(NewSize) + " bytes for " +
+                                 m_Type + "\n");
+    }
+    m_InternalBlock = NewBlock;
+    m_AllocatedSize = NewSize;
+}
+
+size_t MallocV::AddToVec(const size_t size, const void *buf, int align,
+                         bool CopyReqd)
+{
+    const size_t padding = AlignmentPadding(align);
+    if (padding)
+    {
+        char zero[16] = {0};
+        AddToVec(padding, zero, 1, true);
+    }
+    size_t retOffset = CurOffset;
+
+    if (size == 0)
+        return CurOffset;
+
+    if (!CopyReqd)
+    {
+        // just add buf to internal version of output vector
+        VecEntry entry = {true, buf, 0, size};
+        DataV.push_back(entry);
+    }
+    else
+    {
+        Reserve(m_internalPos + size);
+        memcpy(m_InternalBlock + m_internalPos, buf, size);
+        if (DataV.size() && !DataV.back().External &&
+            (m_internalPos == (DataV.back().Offset + DataV.back().Size)))
+        {
+            // just add to the size of the existing tail entry
+            DataV.back().Size += size;
+        }
+        else
+        {
+            DataV.push_back({false, NULL, m_internalPos, size});
+        }
+        m_internalPos += size;
+    }
+    CurOffset = retOffset + size;
+    return retOffset;
+}
+
+MallocV::BufferPos MallocV::Allocate(const size_t size, int align)
+{
+    const size_t padding = AlignmentPadding(align);
+    if (padding)
+    {
+        char zero[16] = {0};
+        AddToVec(padding, zero, 1, true);
+    }
+
+    // external blocks advance CurOffset but not m_internalPos, also align the
+    // position in the malloc'ed block, skipped bytes are not part of the vector
+    size_t pos = m_internalPos;
+    if (pos % align)
+    {
+        pos += align - pos % align;
+    }
+    if (size == 0)
+    {
+        return {0, pos, CurOffset};
+    }
+    Reserve(pos + size);
+
+    if (DataV.size() && !DataV.back().External &&
+        (pos == (DataV.back().Offset + DataV.back().Size)))
+    {
+        DataV.back().Size += size;
+    }
+    else
+    {
+        DataV.push_back({false, NULL, pos, size});
+    }
+    m_internalPos = pos + size;
+
+    const BufferPos ret = {0, pos, CurOffset};
+    CurOffset += size;
+    return ret;
+}
+
+void *MallocV::GetPtr(const size_t /*bufferIdx*/,
+                      const size_t posInBuffer) noexcept
+{
+    if (!m_InternalBlock)
+    {
+        // only empty blocks so far
+        return NULL;
+    }
+    return m_InternalBlock + posInBuffer;
+}
+
+MallocV::BufferV_iovec MallocV::DataVec() noexcept
+{
+    BufferV_iovec ret = new iovec[DataV.size() + 1];
+    for (std::size_t i = 0; i < DataV.size(); ++i)
+    {
+        if (DataV[i].External)
+        {
+            ret[i].iov_base = DataV[i].Base;
+        }
+        else
+        {
+            ret[i].iov_base = m_InternalBlock + DataV[i].Offset;
+        }
+        ret[i].iov_len = DataV[i].Size;
+    }
+    ret[DataV.size()] = {NULL, 0};
+    return ret;
+}
+
+} // end namespace format
+} // end namespace adios2
@@ -0,0 +1,59 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * MallocV.h
+ *
+ */
+
+#ifndef ADIOS2_TOOLKIT_FORMAT_BUFFER_MALLOC_MALLOCV_H_
+#define ADIOS2_TOOLKIT_FORMAT_BUFFER_MALLOC_MALLOCV_H_
+
+#include "adios2/common/ADIOSConfig.h"
+#include "adios2/common/ADIOSTypes.h"
+
+#include "adios2/toolkit/format/buffer/BufferV.h"
+
+namespace adios2
+{
+namespace format
+{
+
+/**
+ * BufferV that copies data into a single contiguous, growing internal block.
+ * Internal blocks are only addressable after the last AddToVec, as growing
+ * the block may move it.
+ */
+class MallocV : public BufferV
+{
+public:
+    MallocV(const std::string type,
+            const size_t InitialBufferSize = DefaultInitialBufferSize,
+            const float GrowthFactor = 2.0f);
+    virtual ~MallocV();
+
+    virtual BufferV_iovec DataVec() noexcept;
+
+    virtual size_t AddToVec(const size_t size, const void *buf, int align,
+                            bool CopyReqd);
+
+    virtual BufferPos Allocate(const size_t size, int align);
+
+    virtual void *GetPtr(const size_t bufferIdx,
+                         const size_t posInBuffer) noexcept;
+
+private:
+    /** grows m_InternalBlock to hold at least size bytes */
+    void Reserve(const size_t size);
+
+    char *m_InternalBlock = NULL;
+    size_t m_AllocatedSize = 0;
+    size_t m_internalPos = 0;
+    const size_t m_InitialBufferSize;
+    const float m_GrowthFactor;
+};
+
+} // end namespace format
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_FORMAT_BUFFER_MALLOC_MALLOCV_H_ */
@@ -12,12 +12,316 @@
 
 #include <cstring>
 #include <iostream>
+#include <set>
 
 namespace adios2
 {
 namespace format
 {
 
+namespace
+{
+
+// magic at the start of binary metadata, followed by a BinaryPackKind byte
+const char BinaryMagic[3] = {'D', 'M', 'B'};
+
+enum BinaryPackKind : uint8_t
+{
+    // self-contained
+    FullPack = 1,
+    // self-contained, and the schema the following delta packs refer to
+    KeyframePack = 2,
+    // blocks are described relative to the last keyframe
+    DeltaPack = 3
+};
+
+enum BinaryVarFlags : uint8_t
+{
+    RowMajorFlag = 1,
+    LittleEndianFlag = 2,
+    AddressFlag = 4,
+    CompressionFlag = 8
+};
+
+enum BinaryDeltaFlags : uint8_t
+{
+    NewBlockFlag = 1,
+    ShapeChangedFlag = 2,
+    StartChangedFlag = 4,
+    CountChangedFlag = 8,
+    AddressChangedFlag = 16,
+    CompressionChangedFlag = 32
+};
+
+template <typename T>
+void PutBinary(std::vector<char> &buffer, const T value)
+{
+    const size_t pos = buffer.size();
+    buffer.resize(pos + sizeof(T));
+    std::memcpy(buffer.data() + pos, &value, sizeof(T));
+}
+
+void PutBinary(std::vector<char> &buffer, const char *data, const size_t size)
+{
+    buffer.insert(buffer.end(), data, data + size);
+}
+
+void PutBinaryString(std::vector<char> &buffer, const std::string &str)
+{
+    if (str.size() > std::numeric_limits<uint16_t>::max())
+    {
+        throw(std::invalid_argument(
+            "DataManSerializer binary metadata does not support strings "
+            "longer than 65535 bytes: " +
+            str.substr(0, 64) + "..."));
+    }
+    PutBinary(buffer, static_cast<uint16_t>(str.size()));
+    PutBinary(buffer, str.data(), str.size());
+}
+
+void PutBinaryDims(std::vector<char> &buffer, const Dims &dims)
+{
+    PutBinary(buffer, static_cast<uint8_t>(dims.size()));
+    for (const auto d : dims)
+    {
+        PutBinary(buffer, static_cast<uint64_t>(d));
+    }
+}
+
+class BinaryReader
+{
+public:
+    BinaryReader(const char *start, const size_t size)
+    : m_Pos(start), m_End(start + size)
+    {
+    }
+
+    template <typename T>
+    T Get()
+    {
+        T value;
+        std::memcpy(&value, Advance(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    void Get(std::vector<char> &output, const size_t size)
+    {
+        const char *p = Advance(size);
+        output.assign(p, p + size);
+    }
+
+    std::string GetString()
+    {
+        const size_t size = Get<uint16_t>();
+        return std::string(Advance(size), size);
+    }
+
+    Dims GetDims()
+    {
+        Dims dims(Get<uint8_t>());
+        for (auto &d : dims)
+        {
+            d = static_cast<size_t>(Get<uint64_t>());
+        }
+        return dims;
+    }
+
+    const char *Advance(const size_t size)
+    {
+        if (static_cast<size_t>(m_End - m_Pos) < size)
+        {
+            throw(std::runtime_error("DataManSerializer received truncated "
+                                     "binary metadata"));
+        }
+        const char *p = m_Pos;
+        m_Pos += size;
+        return p;
+    }
+
+private:
+    const char *m_Pos;
+    const char *m_End;
+};
+
+void PutBinaryCompression(std::vector<char> &output, const DataManVar &var)
+{
+    PutBinaryString(output, var.compression);
+    PutBinary(output, static_cast<uint16_t>(var.params.size()));
+    for (const auto &p : var.params)
+    {
+        PutBinaryString(output, p.first);
+        PutBinaryString(output, p.second);
+    }
+}
+
+void GetBinaryCompression(BinaryReader &reader, DataManVar &var)
+{
+    var.compression = reader.GetString();
+    var.params.clear();
+    const uint16_t paramCount = reader.Get<uint16_t>();
+    for (uint16_t p = 0; p < paramCount; ++p)
+    {
+        std::string key = reader.GetString();
+        var.params[key] = reader.GetString();
+    }
+}
+
+// the parts of a block that change every step
+void PutBinaryPayload(std::vector<char> &output, const DataManVar &var)
+{
+    PutBinary(output, static_cast<uint64_t>(var.position));
+    PutBinary(output, static_cast<uint64_t>(var.size));
+    PutBinary(output, static_cast<uint8_t>(var.max.size()));
+    PutBinary(output, var.min.data(), var.min.size());
+    PutBinary(output, var.max.data(), var.max.size());
+}
+
+void GetBinaryPayload(BinaryReader &reader, DataManVar &var)
+{
+    var.position = static_cast<size_t>(reader.Get<uint64_t>());
+    var.size = static_cast<size_t>(reader.Get<uint64_t>());
+    const uint8_t minMaxSize = reader.Get<uint8_t>();
+    reader.Get(var.min, minMaxSize);
+    reader.Get(var.max, minMaxSize);
+}
+
+void PutBinaryVar(std::vector<char> &output, const DataManVar &var)
+{
+    uint8_t flags = 0;
+    flags |= var.isRowMajor ? RowMajorFlag : 0;
+    flags |= var.isLittleEndian ? LittleEndianFlag : 0;
+    flags |= var.address.empty() ? 0 : AddressFlag;
+    flags |= var.compression.empty() ? 0 : CompressionFlag;
+
+    PutBinaryString(output, var.name);
+    PutBinary(output, static_cast<uint8_t>(var.type));
+    PutBinary(output, flags);
+    PutBinaryDims(output, var.shape);
+    PutBinaryDims(output, var.start);
+    PutBinaryDims(output, var.count);
+    PutBinaryPayload(output, var);
+    if (flags & AddressFlag)
+    {
+        PutBinaryString(output, var.address);
+    }
+    if (flags & CompressionFlag)
+    {
+        PutBinaryCompression(output, var);
+    }
+}
+
+void GetBinaryVar(BinaryReader &reader, DataManVar &var)
+{
+    var.name = reader.GetString();
+    var.type = static_cast<DataType>(reader.Get<uint8_t>());
+    const uint8_t flags = reader.Get<uint8_t>();
+    var.isRowMajor = flags & RowMajorFlag;
+    var.isLittleEndian = flags & LittleEndianFlag;
+    var.shape = reader.GetDims();
+    var.start = reader.GetDims();
+    var.count = reader.GetDims();
+    GetBinaryPayload(reader, var);
+    if (flags & AddressFlag)
+    {
+        var.address = reader.GetString();
+    }
+    if (flags & CompressionFlag)
+    {
+        GetBinaryCompression(reader, var);
+    }
+}
+
+// a block of a delta pack, described as the changes to block index of the
+// keyframe, or in full if the keyframe has no matching block there
+void PutBinaryDelta(std::vector<char> &output, const DataManVar &var,
+                    const std::vector<DataManVar> &schema, const size_t index)
+{
+    if (index >= schema.size() || schema[index].name != var.name ||
+        schema[index].type != var.type ||
+        schema[index].isRowMajor != var.isRowMajor ||
+        schema[index].isLittleEndian != var.isLittleEndian)
+    {
+        PutBinary(output, static_cast<uint8_t>(NewBlockFlag));
+        PutBinaryVar(output, var);
+        return;
+    }
+
+    const DataManVar &base = schema[index];
+    uint8_t flags = 0;
+    flags |= base.shape != var.shape ? ShapeChangedFlag : 0;
+    flags |= base.start != var.start ? StartChangedFlag : 0;
+    flags |= base.count != var.count ? CountChangedFlag : 0;
+    flags |= base.address != var.address ? AddressChangedFlag : 0;
+    flags |= base.compression != var.compression || base.params != var.params
+                 ? CompressionChangedFlag
+                 : 0;
+
+    PutBinary(output, flags);
+    PutBinary(output, static_cast<uint32_t>(index));
+    if (flags & ShapeChangedFlag)
+    {
+        PutBinaryDims(output, var.shape);
+    }
+    if (flags & StartChangedFlag)
+    {
+        PutBinaryDims(output, var.start);
+    }
+    if (flags & CountChangedFlag)
+    {
+        PutBinaryDims(output, var.count);
+    }
+    if (flags & AddressChangedFlag)
+    {
+        PutBinaryString(output, var.address);
+    }
+    if (flags & CompressionChangedFlag)
+    {
+        PutBinaryCompression(output, var);
+    }
+    PutBinaryPayload(output, var);
+}
+
+void GetBinaryDelta(BinaryReader &reader, DataManVar &var,
+                    const std::vector<DataManVar> &schema)
+{
+    const uint8_t flags = reader.Get<uint8_t>();
+    if (flags & NewBlockFlag)
+    {
+        GetBinaryVar(reader, var);
+        return;
+    }
+
+    const uint32_t index = reader.Get<uint32_t>();
+    if (index >= schema.size())
+    {
+        throw(std::runtime_error("DataManSerializer received a metadata delta "
+                                 "referring to a block its keyframe does not "
+                                 "have"));
+    }
+    const DataManVar &base = schema[index];
+    var.name = base.name;
+    var.type = base.type;
+    var.isRowMajor = base.isRowMajor;
+    var.isLittleEndian = base.isLittleEndian;
+    var.shape = flags & ShapeChangedFlag ? reader.GetDims() : base.shape;
+    var.start = flags & StartChangedFlag ? reader.GetDims() : base.start;
+    var.count = flags & CountChangedFlag ? reader.GetDims() : base.count;
+    var.address =
+        flags & AddressChangedFlag ? reader.GetString() : base.address;
+    if (flags & CompressionChangedFlag)
+    {
+        GetBinaryCompression(reader, var);
+    }
+    else
+    {
+        var.compression = base.compression;
+        var.params = base.params;
+    }
+    GetBinaryPayload(reader, var);
+}
+
+} // end anonymous namespace
+
 DataManSerializer::DataManSerializer(helper::Comm const &comm,
                                      const bool isRowMajor)
 : m_IsRowMajor(isRowMajor), m_IsLittleEndian(helper::IsLittleEndian()),
@@ -43,14 +347,45 @@ void DataManSerializer::NewWriterBuffer(size_t bufferSize)
     // queue in transport manager. It will be automatically released when the
     // entire workflow finishes using it.
     m_MetadataJson = nullptr;
+    m_MetadataVars.clear();
     m_LocalBuffer = std::make_shared<std::vector<char>>();
     m_LocalBuffer->reserve(bufferSize);
     m_LocalBuffer->resize(sizeof(uint64_t) * 2);
 }
 
+void DataManSerializer::SetSerializationMethod(const std::string &method)
+{
+    if (method != "string" && method != "msgpack" && method != "cbor" &&
+        method != "ubjson" && method != "binary")
+    {
+        throw(std::invalid_argument(method +
+                                    " is not a valid method. DataManSerializer "
+                                    "only uses string, msgpack, cbor, ubjson "
+                                    "or binary"));
+    }
+    m_UseJsonSerialization = method;
+}
+
+void DataManSerializer::SetFullMetadataInterval(const size_t interval)
+{
+    m_FullMetadataInterval = interval;
+    m_PacksSinceKeyframe = 0;
+}
+
 VecPtr DataManSerializer::GetLocalPack()
 {
     PERFSTUBS_SCOPED_TIMER_FUNC();
+    if (m_UseJsonSerialization == "binary")
+    {
+        const size_t metaPosition = m_LocalBuffer->size();
+        SerializeBinary(*m_LocalBuffer);
+        (reinterpret_cast<uint64_t *>(m_LocalBuffer->data()))[0] =
+            metaPosition;
+        (reinterpret_cast<uint64_t *>(m_LocalBuffer->data()))[1] =
+            m_LocalBuffer->size() - metaPosition;
+        return m_LocalBuffer;
+    }
+
     m_TimeStampsMutex.lock();
     if (!m_TimeStamps.empty())
     {
@@ -380,6 +715,136 @@ void DataManSerializer::JsonToVarMap(nlohmann::json &metaJ, VecPtr pack)
     }
 }
 
+void DataManSerializer::BinaryToVarMap(const char *start, size_t size,
+                                       VecPtr pack)
+{
+    PERFSTUBS_SCOPED_TIMER_FUNC();
+
+    // same locking as JsonToVarMap, a step must become visible at once
+    std::lock_guard<std::mutex> lDataManVarMapMutex(m_DataManVarMapMutex);
+
+    m_CombiningSteps = 0;
+
+    BinaryReader reader(start, size);
+    if (std::memcmp(reader.Advance(sizeof(BinaryMagic)), BinaryMagic,
+                    sizeof(BinaryMagic)) != 0)
+    {
+        throw(std::runtime_error(
+            "DataManSerializer::BinaryToVarMap received metadata that is not "
+            "in binary format, check SerializationMethod on the writer"));
+    }
+
+    const uint8_t kind = reader.Get<uint8_t>();
+    if (kind != FullPack && kind != KeyframePack && kind != DeltaPack)
+    {
+        throw(std::runtime_error(
+            "DataManSerializer::BinaryToVarMap received binary metadata of "
+            "unknown kind " +
+            std::to_string(kind)));
+    }
+
+    if (kind == KeyframePack || kind == DeltaPack)
+    {
+        const uint32_t schemaId = reader.Get<uint32_t>();
+        if (kind == KeyframePack)
+        {
+            m_SchemaId = schemaId;
+            m_Schema.clear();
+            m_HasSchema = true;
+        }
+        else if (!m_HasSchema || schemaId != m_SchemaId)
+        {
+            // joined the stream or lost packets after the keyframe this
+            // delta refers to, the steps are skipped until the next one
+            Log(5,
+                "DataManSerializer::BinaryToVarMap dropped a metadata delta "
+                "for keyframe " +
+                    std::to_string(schemaId),
+                true, true);
+            return;
+        }
+    }
+
+    const uint32_t timeStampCount = reader.Get<uint32_t>();
+    if (timeStampCount > 0)
+    {
+        std::vector<uint64_t> timeStamps(timeStampCount);
+        for (auto &t : timeStamps)
+        {
+            t = reader.Get<uint64_t>();
+        }
+        m_TimeStampsMutex.lock();
+        m_TimeStamps = std::move(timeStamps);
+        m_TimeStampsMutex.unlock();
+    }
+
+    const uint32_t attributesSize = reader.Get<uint32_t>();
+    if (attributesSize > 0)
+    {
+        const char *attributes = reader.Advance(attributesSize);
+        m_StaticDataJsonMutex.lock();
+        m_StaticDataJson["S"] = nlohmann::json::from_msgpack(
+            attributes, attributes + attributesSize);
+        m_StaticDataJsonMutex.unlock();
+    }
+
+    std::set<size_t> steps;
+    const uint32_t groupCount = reader.Get<uint32_t>();
+    for (uint32_t g = 0; g < groupCount; ++g)
+    {
+        const size_t step = static_cast<size_t>(reader.Get<uint64_t>());
+        const int rank = reader.Get<int32_t>();
+        const uint32_t varCount = reader.Get<uint32_t>();
+
+        if (steps.insert(step).second)
+        {
+            ++m_CombiningSteps;
+            m_DeserializedBlocksForStepMutex.lock();
+            ++m_DeserializedBlocksForStep[step];
+            m_DeserializedBlocksForStepMutex.unlock();
+        }
+
+        auto &vars = m_DataManVarMap[step];
+        if (vars == nullptr)
+        {
+            vars = std::make_shared<std::vector<DataManVar>>();
+        }
+        vars->reserve(vars->size() + varCount);
+
+        for (uint32_t v = 0; v < varCount; ++v)
+        {
+            DataManVar var;
+            if (kind == DeltaPack)
+            {
+                GetBinaryDelta(reader, var, m_Schema);
+            }
+            else
+            {
+                GetBinaryVar(reader, var);
+            }
+            var.step = step;
+            var.rank = rank;
+            if (kind == KeyframePack)
+            {
+                m_Schema.push_back(var);
+            }
+            var.buffer = pack;
+            vars->emplace_back(std::move(var));
+        }
+    }
+
+    if (m_Verbosity >= 5)
+    {
+        std::cout << "DataManSerializer::BinaryToVarMap Total buffered steps = "
+                  << m_DataManVarMap.size() << ": ";
+        for (const auto &i : m_DataManVarMap)
+        {
+            std::cout << i.first << ", ";
+        }
+        std::cout << std::endl;
+    }
+}
+
 void DataManSerializer::PutPack(const VecPtr data, const bool useThread)
 {
     if (useThread)
@@ -407,8 +872,16 @@ int DataManSerializer::PutPackThread(const VecPtr data)
     uint64_t metaPosition =
         (reinterpret_cast<const uint64_t *>(data->data()))[0];
     uint64_t metaSize = (reinterpret_cast<const uint64_t *>(data->data()))[1];
-    nlohmann::json j = DeserializeJson(data->data() + metaPosition, metaSize);
-    JsonToVarMap(j, data);
+    if (m_UseJsonSerialization == "binary")
+    {
+        BinaryToVarMap(data->data() + metaPosition, metaSize, data);
+    }
+    else
+    {
+        nlohmann::json j =
+            DeserializeJson(data->data() + metaPosition, metaSize);
+        JsonToVarMap(j, data);
+    }
     return 0;
 }
 
@@ -508,6 +981,128 @@ VecPtr DataManSerializer::SerializeJson(const nlohmann::json &message)
     return pack;
 }
 
+/*
+ * Binary metadata layout, integers in the byte order of the writer:
+ *
+ *   'D' 'M' 'B', uint8 BinaryPackKind, [uint32 keyframe id if not FullPack]
+ *   uint32 time stamp count, uint64 time stamps
+ *   uint32 attribute size, attributes as msgpack of the "S" JSON array
+ *   uint32 block group count, each group being
+ *     uint64 step, int32 rank, uint32 block count, followed by the blocks
+ *
+ * A block in a full or keyframe pack is
+ *   uint16 + name, uint8 type, uint8 flags (BinaryVarFlags),
+ *   uint8 + uint64 shape, start and count each, uint64 position,
+ *   uint64 size, uint8 min/max size + min + max, [uint16 + address],
+ *   [uint16 + compression method, uint16 parameter count,
+ *   (uint16 + key, uint16 + value)...]
+ *
+ * A block in a delta pack is a uint8 BinaryDeltaFlags followed by either a
+ * full block (NewBlockFlag) or by the uint32 index of the keyframe block it
+ * derives from, the fields that changed and position, size and min/max.
+ * Deltas only ever refer to the last keyframe, never to another delta, so a
+ * reader that misses packs resumes at the next keyframe. Attributes are only
+ * sent with full packs and keyframes.
+ *
+ * Blocks are grouped as long as consecutive PutData calls share step and
+ * rank, which is the normal case, so the group header is paid once per step.
+ */
+void DataManSerializer::SerializeBinary(std::vector<char> &output)
+{
+    PERFSTUBS_SCOPED_TIMER_FUNC();
+
+    BinaryPackKind kind = FullPack;
+    if (m_FullMetadataInterval > 0)
+    {
+        kind = m_PacksSinceKeyframe == 0 ? KeyframePack : DeltaPack;
+        if (kind == KeyframePack)
+        {
+            ++m_SchemaId;
+        }
+        if (++m_PacksSinceKeyframe >= m_FullMetadataInterval)
+        {
+            m_PacksSinceKeyframe = 0;
+        }
+    }
+
+    PutBinary(output, BinaryMagic, sizeof(BinaryMagic));
+    PutBinary(output, static_cast<uint8_t>(kind));
+    if (kind != FullPack)
+    {
+        PutBinary(output, m_SchemaId);
+    }
+
+    m_TimeStampsMutex.lock();
+    PutBinary(output, static_cast<uint32_t>(m_TimeStamps.size()));
+    for (const auto t : m_TimeStamps)
+    {
+        PutBinary(output, t);
+    }
+    m_TimeStamps.clear();
+    m_TimeStampsMutex.unlock();
+
+    auto attributesIt = m_MetadataJson.find("S");
+    if (kind != DeltaPack && attributesIt != m_MetadataJson.end())
+    {
+        std::vector<char> attributes;
+        nlohmann::json::to_msgpack(*attributesIt, attributes);
+        PutBinary(output, static_cast<uint32_t>(attributes.size()));
+        PutBinary(output, attributes.data(), attributes.size());
+    }
+    else
+    {
+        PutBinary(output, static_cast<uint32_t>(0));
+    }
+
+    const size_t groupCountPos = output.size();
+    PutBinary(output, static_cast<uint32_t>(0));
+    uint32_t groupCount = 0;
+    size_t varCountPos = 0;
+    uint32_t varCount = 0;
+
+    for (size_t i = 0; i < m_MetadataVars.size(); ++i)
+    {
+        const DataManVar &var = m_MetadataVars[i];
+        if (i == 0 || var.step != m_MetadataVars[i - 1].step ||
+            var.rank != m_MetadataVars[i - 1].rank)
+        {
+            if (groupCount > 0)
+            {
+                std::memcpy(output.data() + varCountPos, &varCount,
+                            sizeof(varCount));
+            }
+            PutBinary(output, static_cast<uint64_t>(var.step));
+            PutBinary(output, static_cast<int32_t>(var.rank));
+            varCountPos = output.size();
+            PutBinary(output, static_cast<uint32_t>(0));
+            varCount = 0;
+            ++groupCount;
+        }
+
+        if (kind == DeltaPack)
+        {
+            PutBinaryDelta(output, var, m_Schema, i);
+        }
+        else
+        {
+            PutBinaryVar(output, var);
+        }
+        ++varCount;
+    }
+
+    if (groupCount > 0)
+    {
+        std::memcpy(output.data() + varCountPos, &varCount, sizeof(varCount));
+    }
+    std::memcpy(output.data() + groupCountPos, &groupCount,
+                sizeof(groupCount));
+
+    if (kind == KeyframePack)
+    {
+        m_Schema.swap(m_MetadataVars);
+    }
+}
+
 nlohmann::json DataManSerializer::DeserializeJson(const char *start,
                                                   size_t size)
 {
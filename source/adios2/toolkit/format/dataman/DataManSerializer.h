@@ -89,6 +89,14 @@ public:
     // clear and allocate new buffer for writer
     void NewWriterBuffer(size_t size);
 
+    // string, msgpack, cbor, ubjson or binary, must match between writer and
+    // reader
+    void SetSerializationMethod(const std::string &method);
+
+    // binary method only: send the full metadata every interval packs and
+    // only the changes relative to it in between, 0 sends it with every pack
+    void SetFullMetadataInterval(const size_t interval);
+
     // get attributes from IO and put into m_StaticDataJson
     void PutAttributes(core::IO &io);
 
@@ -178,13 +186,16 @@ private:
                                 const Dims &count);
 
     void JsonToVarMap(nlohmann::json &metaJ, VecPtr pack);
+    void BinaryToVarMap(const char *start, size_t size, VecPtr pack);
 
     VecPtr SerializeJson(const nlohmann::json &message);
     nlohmann::json DeserializeJson(const char *start, size_t size);
 
+    void SerializeBinary(std::vector<char> &output);
+
     template <typename T>
     void CalculateMinMax(const T *data, const Dims &count,
-                         nlohmann::json &metaj);
+                         std::vector<char> &min, std::vector<char> &max);
 
     bool StepHasMinimumBlocks(const size_t step,
                               const int requireMinimumBlocks);
@@ -200,6 +211,20 @@ private:
     // writer app API thread, do not need mutex
     nlohmann::json m_MetadataJson;
 
+    // local rank variable blocks for the binary metadata format, replaces the
+    // per-variable objects in m_MetadataJson, only accessed from writer app
+    // API thread, does not need mutex
+    std::vector<DataManVar> m_MetadataVars;
+
+    // blocks of the last binary metadata keyframe, which delta packs are
+    // encoded against. Written by the writer app API thread on the writer,
+    // and under m_DataManVarMapMutex on the reader.
+    std::vector<DataManVar> m_Schema;
+    uint32_t m_SchemaId = 0;
+    bool m_HasSchema = false;
+    size_t m_FullMetadataInterval = 0;
+    size_t m_PacksSinceKeyframe = 0;
+
     // temporary compression buffer, made class member only for saving costs for
     // memory allocation
     std::vector<char> m_CompressBuffer;
@@ -225,7 +250,7 @@ private:
     std::mutex m_StaticDataJsonMutex;
     bool m_StaticDataFinished = false;
 
-    // string, msgpack, cbor, ubjson
+    // string, msgpack, cbor, ubjson, binary
     std::string m_UseJsonSerialization = "string";
 
     OperatorMap m_OperatorMap;
@@ -39,46 +39,47 @@ namespace format
 
 template <>
 inline void DataManSerializer::CalculateMinMax<std::complex<float>>(
-    const std::complex<float> *data, const Dims &count, nlohmann::json &metaj)
+    const std::complex<float> *data, const Dims &count, std::vector<char> &min,
+    std::vector<char> &max)
 {
 }
 
 template <>
 inline void DataManSerializer::CalculateMinMax<std::complex<double>>(
-    const std::complex<double> *data, const Dims &count, nlohmann::json &metaj)
+    const std::complex<double> *data, const Dims &count,
+    std::vector<char> &min, std::vector<char> &max)
 {
 }
 
 template <typename T>
 void DataManSerializer::CalculateMinMax(const T *data, const Dims &count,
-                                        nlohmann::json &metaj)
+                                        std::vector<char> &min,
+                                        std::vector<char> &max)
 {
     PERFSTUBS_SCOPED_TIMER_FUNC();
     size_t size = std::accumulate(count.begin(), count.end(), 1,
                                   std::multiplies<size_t>());
-    T max = std::numeric_limits<T>::min();
-    T min = std::numeric_limits<T>::max();
+    T maxValue = std::numeric_limits<T>::min();
+    T minValue = std::numeric_limits<T>::max();
 
     for (size_t j = 0; j < size; ++j)
     {
         T value = data[j];
-        if (value > max)
+        if (value > maxValue)
         {
-            max = value;
+            maxValue = value;
         }
-        if (value < min)
+        if (value < minValue)
         {
-            min = value;
+            minValue = value;
         }
     }
 
-    std::vector<char> vectorValue(sizeof(T));
+    max.resize(sizeof(T));
+    std::memcpy(max.data(), &maxValue, sizeof(T));
 
-    reinterpret_cast<T *>(vectorValue.data())[0] = max;
-    metaj["+"] = vectorValue;
-
-    reinterpret_cast<T *>(vectorValue.data())[0] = min;
-    metaj["-"] = vectorValue;
+    min.resize(sizeof(T));
+    std::memcpy(min.data(), &minValue, sizeof(T));
 }
 
 template <class T>
@@ -114,32 +115,50 @@ void DataManSerializer::PutData(
         localBuffer = m_LocalBuffer;
     }
 
-    nlohmann::json metaj;
-
-    metaj["N"] = varName;
-    metaj["O"] = varStart;
-    metaj["C"] = varCount;
-    metaj["S"] = varShape;
-    metaj["Y"] = ToString(helper::GetDataType<T>());
-    metaj["P"] = localBuffer->size();
-
-    if (not address.empty())
-    {
-        metaj["A"] = address;
-    }
+    // the binary format keeps the block description in a plain struct and
+    // encodes all of them at once in GetLocalPack
+    const bool binary =
+        m_UseJsonSerialization == "binary" && metadataJson == nullptr;
 
+    std::vector<char> min;
+    std::vector<char> max;
     if (m_EnableStat)
     {
-        CalculateMinMax(inputData, varCount, metaj);
+        CalculateMinMax(inputData, varCount, min, max);
     }
 
-    if (not m_IsRowMajor)
-    {
-        metaj["M"] = m_IsRowMajor;
-    }
-    if (not m_IsLittleEndian)
+    const size_t position = localBuffer->size();
+
+    nlohmann::json metaj;
+
+    if (not binary)
     {
-        metaj["E"] = m_IsLittleEndian;
+        metaj["N"] = varName;
+        metaj["O"] = varStart;
+        metaj["C"] = varCount;
+        metaj["S"] = varShape;
+        metaj["Y"] = ToString(helper::GetDataType<T>());
+        metaj["P"] = position;
+
+        if (not address.empty())
+        {
+            metaj["A"] = address;
+        }
+
+        if (not max.empty())
+        {
+            metaj["+"] = max;
+            metaj["-"] = min;
+        }
+
+        if (not m_IsRowMajor)
+        {
+            metaj["M"] = m_IsRowMajor;
+        }
+        if (not m_IsLittleEndian)
+        {
+            metaj["E"] = m_IsLittleEndian;
+        }
     }
 
     size_t datasize = 0;
@@ -225,17 +244,20 @@ void DataManSerializer::PutData(
         }
     }
 
-    if (compressed)
+    if (compressed && not binary)
     {
         metaj["Z"] = compressionMethod;
         metaj["ZP"] = ops[0].Parameters;
     }
-    else
+    else if (not compressed)
     {
         datasize = std::accumulate(varCount.begin(), varCount.end(), sizeof(T),
                                    std::multiplies<size_t>());
     }
-    metaj["I"] = datasize;
+    if (not binary)
+    {
+        metaj["I"] = datasize;
+    }
 
     if (localBuffer->capacity() < localBuffer->size() + datasize)
     {
@@ -255,7 +277,31 @@ void DataManSerializer::PutData(
                     inputData, datasize);
     }
 
-    if (metadataJson == nullptr)
+    if (binary)
+    {
+        m_MetadataVars.emplace_back();
+        DataManVar &var = m_MetadataVars.back();
+        var.isRowMajor = m_IsRowMajor;
+        var.isLittleEndian = m_IsLittleEndian;
+        var.shape = varShape;
+        var.count = varCount;
+        var.start = varStart;
+        var.name = varName;
+        var.type = helper::GetDataType<T>();
+        var.min = std::move(min);
+        var.max = std::move(max);
+        var.step = step;
+        var.size = datasize;
+        var.position = position;
+        var.rank = rank;
+        var.address = address;
+        if (compressed)
+        {
+            var.compression = compressionMethod;
+            var.params = ops[0].Parameters;
+        }
+    }
+    else if (metadataJson == nullptr)
     {
         m_MetadataJson[std::to_string(step)][std::to_string(rank)].emplace_back(
             std::move(metaj));
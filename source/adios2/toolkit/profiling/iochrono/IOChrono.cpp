@@ -15,7 +15,7 @@ namespace adios2
 namespace profiling
 {
 
-void IOChrono::Start(const std::string process) noexcept
+void IOChrono::Start(const std::string &process) noexcept
 {
     if (m_IsActive)
     {
@@ -23,7 +23,7 @@ void IOChrono::Start(const std::string process) noexcept
     }
 }
 
-void IOChrono::Stop(const std::string process)
+void IOChrono::Stop(const std::string &process)
 {
     if (m_IsActive)
     {
@@ -49,13 +49,13 @@ public:
     ~IOChrono() = default;
 
     /** Start existing process in m_Timers */
-    void Start(const std::string process) noexcept;
+    void Start(const std::string &process) noexcept;
 
     /**
      * Stop existing process in m_Timers
      * @throws std::invalid_argument if Start wasn't called
      * */
-    void Stop(const std::string process);
+    void Stop(const std::string &process);
 };
 
 } // end namespace profiling
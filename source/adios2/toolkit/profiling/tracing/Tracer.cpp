@@ -0,0 +1,240 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * Tracer.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "Tracer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <numeric>
+
+#include "adios2/helper/adiosComm.h"
+
+namespace adios2
+{
+namespace profiling
+{
+
+namespace
+{
+
+// same order as TraceEvent, the part before "::" is the event category
+const char *const TraceEventNames[] = {
+    "BP4Writer::Marshal",         "BP4Writer::Aggregate",
+    "BP4Writer::WriteData",       "BP4Writer::WriteMetadata",
+    "BP4Reader::ReadMetadata",    "BP4Reader::InstallMetadata",
+    "BP4Reader::ReadData",        "BP5Writer::Marshal",
+    "BP5Writer::Aggregate",       "BP5Writer::WriteData",
+    "BP5Writer::WriteMetadata",   "BP5Reader::ReadMetadata",
+    "BP5Reader::InstallMetadata", "BP5Reader::ReadData"};
+
+static_assert(sizeof(TraceEventNames) / sizeof(TraceEventNames[0]) ==
+                  static_cast<size_t>(TraceEvent::Count),
+              "TraceEventNames must name every TraceEvent");
+
+} // end anonymous namespace
+
+struct Tracer::ThreadBuffer
+{
+    struct Entry
+    {
+        uint64_t Time;
+        uint32_t Step;
+        uint16_t Event;
+        char Phase;
+    };
+
+    std::vector<Entry> Entries;
+    /** total events recorded, only advanced by the owning thread */
+    std::atomic<uint64_t> Head;
+    /** set when the owning thread exits */
+    std::atomic<bool> Retired;
+    uint32_t ThreadId;
+
+    explicit ThreadBuffer(const uint32_t threadId)
+    : Entries(Tracer::ThreadCapacity), Head(0), Retired(false),
+      ThreadId(threadId)
+    {
+    }
+};
+
+namespace
+{
+
+std::mutex RegistryMutex;
+std::vector<std::unique_ptr<Tracer::ThreadBuffer>> Registry;
+uint32_t ThreadCount = 0;
+
+/** owned by a thread_local, retires the buffer when the thread exits */
+struct ThreadBufferHolder
+{
+    Tracer::ThreadBuffer *Buffer = nullptr;
+
+    ~ThreadBufferHolder()
+    {
+        if (Buffer != nullptr)
+        {
+            Buffer->Retired.store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local ThreadBufferHolder LocalBuffer;
+
+} // end anonymous namespace
+
+std::atomic<bool> Tracer::m_Enabled(false);
+
+void Tracer::Enable() noexcept
+{
+    m_Enabled.store(true, std::memory_order_relaxed);
+}
+
+uint64_t Tracer::Now() noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+void Tracer::Record(const TraceEvent event, const char phase,
+                    const size_t step) noexcept
+{
+    ThreadBuffer *buffer = LocalBuffer.Buffer;
+    if (buffer == nullptr)
+    {
+        try
+        {
+            buffer = GetThreadBuffer();
+        }
+        catch (...)
+        {
+            // tracing never fails the traced operation
+            return;
+        }
+    }
+
+    const uint64_t head = buffer->Head.load(std::memory_order_relaxed);
+    ThreadBuffer::Entry &entry =
+        buffer->Entries[head & (ThreadCapacity - 1)];
+    entry.Time = Now();
+    entry.Step = static_cast<uint32_t>(step);
+    entry.Event = static_cast<uint16_t>(event);
+    entry.Phase = phase;
+    buffer->Head.store(head + 1, std::memory_order_release);
+}
+
+Tracer::ThreadBuffer *Tracer::GetThreadBuffer()
+{
+    std::lock_guard<std::mutex> lock(RegistryMutex);
+    ThreadBuffer *buffer = nullptr;
+    if (Registry.size() >= MaxThreadBuffers)
+    {
+        for (auto &retired : Registry)
+        {
+            if (retired->Retired.load(std::memory_order_acquire))
+            {
+                buffer = retired.get();
+                buffer->Head.store(0, std::memory_order_relaxed);
+                buffer->Retired.store(false, std::memory_order_relaxed);
+                buffer->ThreadId = ++ThreadCount;
+                break;
+            }
+        }
+    }
+    if (buffer == nullptr)
+    {
+        Registry.emplace_back(new ThreadBuffer(++ThreadCount));
+        buffer = Registry.back().get();
+    }
+    LocalBuffer.Buffer = buffer;
+    return buffer;
+}
+
+std::string Tracer::GetChromeTraceJSON(const int pid, const uint64_t since)
+{
+    std::string json;
+    char line[256];
+    std::snprintf(line, sizeof(line),
+                  "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+                  "\"tid\":0,\"args\":{\"name\":\"rank %d\"}},\n",
+                  pid, pid);
+    json += line;
+
+    // entries being overwritten by their thread while exporting may come out
+    // torn, engines export on Close when their own threads are done
+    std::lock_guard<std::mutex> lock(RegistryMutex);
+    for (const auto &buffer : Registry)
+    {
+        const uint64_t head = buffer->Head.load(std::memory_order_acquire);
+        const uint64_t first =
+            head > ThreadCapacity ? head - ThreadCapacity : 0;
+        for (uint64_t i = first; i < head; ++i)
+        {
+            const ThreadBuffer::Entry &entry =
+                buffer->Entries[i & (ThreadCapacity - 1)];
+            if (entry.Time < since ||
+                entry.Event >= static_cast<uint16_t>(TraceEvent::Count))
+            {
+                continue;
+            }
+            const char *name = TraceEventNames[entry.Event];
+            const int categoryLength =
+                static_cast<int>(std::strchr(name, ':') - name);
+            std::snprintf(
+                line, sizeof(line),
+                "{\"name\":\"%s\",\"cat\":\"%.*s\",\"ph\":\"%c\","
+                "\"ts\":%.3f,\"pid\":%d,\"tid\":%u,\"args\":{\"step\":%u}},\n",
+                name, categoryLength, name, entry.Phase,
+                static_cast<double>(entry.Time - since) / 1000.0, pid,
+                buffer->ThreadId, entry.Step);
+            json += line;
+        }
+    }
+    return json;
+}
+
+std::vector<char> Tracer::AggregateChromeTraceJSON(helper::Comm const &comm,
+                                                   const uint64_t since)
+{
+    const std::string rankJSON = GetChromeTraceJSON(comm.Rank(), since);
+    const std::vector<size_t> sizes = comm.GatherValues(rankJSON.size());
+
+    const std::string header("[\n");
+    const std::string footer("\n]\n");
+    std::vector<char> traceJSON;
+    size_t gatheredSize = 0;
+    if (comm.Rank() == 0)
+    {
+        gatheredSize = std::accumulate(sizes.begin(), sizes.end(), size_t(0));
+        traceJSON.resize(header.size() + gatheredSize);
+        std::copy(header.begin(), header.end(), traceJSON.begin());
+    }
+
+    comm.GathervArrays(rankJSON.data(), rankJSON.size(), sizes.data(),
+                       sizes.size(),
+                       comm.Rank() == 0 ? traceJSON.data() + header.size()
+                                        : nullptr);
+
+    if (comm.Rank() == 0)
+    {
+        // every rank contributes at least its process_name entry, drop the
+        // separator after the last entry
+        traceJSON.resize(traceJSON.size() - 2);
+        traceJSON.insert(traceJSON.end(), footer.begin(), footer.end());
+    }
+    return traceJSON;
+}
+
+} // end namespace profiling
+} // end namespace adios2
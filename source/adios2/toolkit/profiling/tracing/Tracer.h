@@ -0,0 +1,154 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * Tracer.h : timestamped begin/end events of engine phases, kept in per-thread
+ * ring buffers and exported in the Chrome trace event format that
+ * chrome://tracing and Perfetto load
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef ADIOS2_TOOLKIT_PROFILING_TRACING_TRACER_H_
+#define ADIOS2_TOOLKIT_PROFILING_TRACING_TRACER_H_
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+/// \endcond
+
+#include "adios2/common/ADIOSConfig.h"
+
+namespace adios2
+{
+namespace helper
+{
+class Comm;
+}
+namespace profiling
+{
+
+/**
+ * Pre-registered events, recording them costs no string handling or lookup.
+ * Names are in Tracer.cpp TraceEventNames, keep both in the same order.
+ */
+enum class TraceEvent : uint16_t
+{
+    BP4WriterMarshal,
+    BP4WriterAggregate,
+    BP4WriterWriteData,
+    BP4WriterWriteMetadata,
+    BP4ReaderReadMetadata,
+    BP4ReaderInstallMetadata,
+    BP4ReaderReadData,
+    BP5WriterMarshal,
+    BP5WriterAggregate,
+    BP5WriterWriteData,
+    BP5WriterWriteMetadata,
+    BP5ReaderReadMetadata,
+    BP5ReaderInstallMetadata,
+    BP5ReaderReadData,
+    Count
+};
+
+/**
+ * Process-wide tracing. Every thread records into its own ring buffer, so
+ * recording takes no lock, and a buffer keeps only the latest events once it
+ * is full. Recording is a single relaxed load while tracing is off.
+ */
+class Tracer
+{
+public:
+    /** events kept per thread before the oldest are overwritten */
+    static constexpr size_t ThreadCapacity = 1 << 14;
+
+    /** threads that keep their events after exiting, beyond that the buffer
+     * of an exited thread is handed to a new one */
+    static constexpr size_t MaxThreadBuffers = 256;
+
+    /** a thread's ring buffer, defined in Tracer.cpp */
+    struct ThreadBuffer;
+
+    /** turns on recording for the whole process, never turned off since
+     * other engines may still be tracing */
+    static void Enable() noexcept;
+
+    static bool IsEnabled() noexcept
+    {
+        return m_Enabled.load(std::memory_order_relaxed);
+    }
+
+    /** nanoseconds on the steady clock, the time base of all events */
+    static uint64_t Now() noexcept;
+
+    /**
+     * Record the start of event on the calling thread
+     * @param step engine step counter at the time, shown as the event's
+     * "step" argument
+     */
+    static void Begin(const TraceEvent event, const size_t step) noexcept
+    {
+        if (IsEnabled())
+        {
+            Record(event, 'B', step);
+        }
+    }
+
+    static void End(const TraceEvent event, const size_t step) noexcept
+    {
+        if (IsEnabled())
+        {
+            Record(event, 'E', step);
+        }
+    }
+
+    /**
+     * Events of all threads recorded at or after since, as Chrome trace
+     * JSON array entries each followed by ",\n", timestamps relative to since
+     * @param pid process id to show, the MPI rank
+     * @param since from Now()
+     */
+    static std::string GetChromeTraceJSON(const int pid, const uint64_t since);
+
+    /**
+     * Collective, gathers GetChromeTraceJSON from all ranks of comm
+     * @return complete Chrome trace JSON array on rank 0, empty elsewhere
+     */
+    static std::vector<char> AggregateChromeTraceJSON(helper::Comm const &comm,
+                                                      const uint64_t since);
+
+private:
+    static std::atomic<bool> m_Enabled;
+
+    static void Record(const TraceEvent event, const char phase,
+                       const size_t step) noexcept;
+
+    static ThreadBuffer *GetThreadBuffer();
+};
+
+/** Begin on construction, End on destruction, also when unwinding */
+class ScopedTrace
+{
+public:
+    ScopedTrace(const TraceEvent event, const size_t step) noexcept
+    : m_Event(event), m_Step(step)
+    {
+        Tracer::Begin(m_Event, m_Step);
+    }
+
+    ~ScopedTrace() { Tracer::End(m_Event, m_Step); }
+
+    ScopedTrace(const ScopedTrace &) = delete;
+    ScopedTrace &operator=(const ScopedTrace &) = delete;
+
+private:
+    const TraceEvent m_Event;
+    const size_t m_Step;
+};
+
+} // end namespace profiling
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_PROFILING_TRACING_TRACER_H_ */
@@ -66,6 +66,15 @@ void CP_validateParams(SstStream Stream, SstParams Params, int Writer)
         {
             Params->DataTransport = strdup("rdma");
         }
+        else if ((strcmp(SelectedTransport, "shm") == 0) ||
+                 (strcmp(SelectedTransport, "sharedmemory") == 0))
+        {
+            Params->DataTransport = strdup("shm");
+        }
+        else
+        {
+            Params->DataTransport = strdup(SelectedTransport);
+        }
         free(SelectedTransport);
     }
     if (Params->ControlTransport == NULL)
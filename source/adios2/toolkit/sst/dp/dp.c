@@ -16,6 +16,9 @@ extern CP_DP_Interface LoadRdmaDP();
 #ifdef SST_HAVE_DAOS
 extern CP_DP_Interface LoadDaosDP();
 #endif /* SST_HAVE_LIBFABRIC */
+#ifdef SST_HAVE_POSIX_SHM
+extern CP_DP_Interface LoadShmDP();
+#endif /* SST_HAVE_POSIX_SHM */
 extern CP_DP_Interface LoadEVpathDP();
 
 typedef struct _DPElement
@@ -58,6 +61,9 @@ CP_DP_Interface SelectDP(CP_Services Svcs, void *CP_Stream,
     DPlist List = NULL;
     List = AddDPPossibility(Svcs, CP_Stream, List, LoadEVpathDP(), "evpath",
                             Params);
+#ifdef SST_HAVE_POSIX_SHM
+    List = AddDPPossibility(Svcs, CP_Stream, List, LoadShmDP(), "shm", Params);
+#endif /* SST_HAVE_POSIX_SHM */
 #ifdef SST_HAVE_LIBFABRIC
     List =
         AddDPPossibility(Svcs, CP_Stream, List, LoadRdmaDP(), "rdma", Params);
@@ -0,0 +1,774 @@
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atl.h>
+#include <evpath.h>
+
+#include "sst_data.h"
+
+#include "dp_interface.h"
+#include <adios2-perfstubs-interface.h>
+
+#if defined(__has_feature)
+#if __has_feature(thread_sanitizer)
+#define NO_SANITIZE_THREAD __attribute__((no_sanitize("thread")))
+#endif
+#endif
+
+#ifndef NO_SANITIZE_THREAD
+#define NO_SANITIZE_THREAD
+#endif
+
+/*
+ *  This "shm" data plane is meant for the case where writer and reader
+ *  ranks share a node (e.g. an in-situ analysis sidecar).  On the writer
+ *  side, each timestep's data block is published in a POSIX shared-memory
+ *  segment whose name is derived from a per-writer-rank prefix and the
+ *  timestep number.  On the reader side, ReadRemoteMemory maps the segment
+ *  of a writer rank that runs on the same host and copies the requested
+ *  range directly out of it.  No read request or reply messages are
+ *  exchanged for those reads; the control plane is only used for the
+ *  contact information and the usual timestep release protocol.
+ *
+ *  Everything else is delegated to the "evpath" data plane, which this DP
+ *  wraps.  Its contact information is carried inside ours, and any read
+ *  that cannot be satisfied from shared memory (an off-node writer rank, a
+ *  timestep that was published before a local reader connected, a
+ *  segment that could not be created) is forwarded to it.  This makes the
+ *  fallback a per-writer-rank decision rather than a selection-time one:
+ *  SelectDP() runs independently on each side and cannot know where the
+ *  peers live.
+ *
+ *  The host name exchanged in the contact information is only a hint.  A
+ *  reader on a different node with the same host name fails to open the
+ *  writer's segment and falls back to evpath as well.
+ *
+ *  Segments are unlinked when the writer releases the timestep or is
+ *  destroyed.  A writer that is killed leaves its segments behind in the
+ *  shared-memory file system (/dev/shm on Linux).
+ *
+ *  Preloading is disabled under this DP.  The evpath reader waits for
+ *  preloaded data instead of asking for it, so both sides must agree on
+ *  the preload mode for every writer/reader pair, and shared-memory reads
+ *  don't benefit from it anyway.
+ */
+
+typedef struct _Shm_RS_Stream
+{
+    void *CP_Stream;
+    DP_RS_Stream Evpath_Stream;
+    struct _ShmReaderContactInfo *MyContactInfo;
+
+    /* writer info */
+    int WriterCohortSize;
+    char **WriterSegmentPrefix; /* NULL for writer ranks on another host */
+
+    /* mapped segments, guarded by DataLock */
+    pthread_mutex_t DataLock;
+    struct _ShmMappedSegment *Segments;
+
+    SstStats Stats;
+} * Shm_RS_Stream;
+
+typedef struct _ShmMappedSegment
+{
+    int WriterRank;
+    long Timestep;
+    void *Addr; /* NULL if the segment could not be mapped */
+    size_t Size;
+    struct _ShmMappedSegment *Next;
+} * ShmMappedSegment;
+
+typedef struct _ShmPublishedSegment
+{
+    long Timestep;
+    char *Name;
+    struct _ShmPublishedSegment *Next;
+} * ShmPublishedSegment;
+
+typedef struct _Shm_WS_Stream
+{
+    void *CP_Stream;
+    DP_WS_Stream Evpath_Stream;
+    char *SegmentPrefix;
+    int LocalReaderCount;
+
+    /* contact info handed out by InitWriterPerReader */
+    int ReaderCount;
+    struct _ShmWriterContactInfo **WriterContactInfo;
+
+    /* published segments, guarded by DataLock */
+    pthread_mutex_t DataLock;
+    ShmPublishedSegment Segments;
+
+    SstStats Stats;
+} * Shm_WS_Stream;
+
+typedef struct _ShmReaderContactInfo
+{
+    char *Hostname;
+    void *Evpath_Info;
+} * ShmReaderContactInfo;
+
+typedef struct _ShmWriterContactInfo
+{
+    char *Hostname;
+    char *SegmentPrefix;
+    void *Evpath_Info;
+} * ShmWriterContactInfo;
+
+typedef struct _ShmCompletionHandle
+{
+    void *Evpath_Handle; /* NULL if the read was served from shared memory */
+} * ShmCompletionHandle;
+
+static CP_DP_Interface EvpathDP = NULL;
+
+static char *ShmGetHostname()
+{
+    char Hostname[HOST_NAME_MAX + 1];
+    if (gethostname(Hostname, sizeof(Hostname)) != 0)
+    {
+        return strdup("");
+    }
+    Hostname[HOST_NAME_MAX] = 0;
+    return strdup(Hostname);
+}
+
+static char *ShmSegmentName(const char *Prefix, long Timestep)
+{
+    size_t Len = strlen(Prefix) + 32;
+    char *Name = malloc(Len);
+    snprintf(Name, Len, "%s-%ld", Prefix, Timestep);
+    return Name;
+}
+
+// reader-side routine, called from the main program
+static DP_RS_Stream ShmInitReader(CP_Services Svcs, void *CP_Stream,
+                                  void **ReaderContactInfoPtr,
+                                  struct _SstParams *Params,
+                                  attr_list WriterContact, SstStats Stats)
+{
+    Shm_RS_Stream Stream = calloc(1, sizeof(struct _Shm_RS_Stream));
+    ShmReaderContactInfo Contact =
+        calloc(1, sizeof(struct _ShmReaderContactInfo));
+
+    Stream->CP_Stream = CP_Stream;
+    Stream->Stats = Stats;
+    pthread_mutex_init(&Stream->DataLock, NULL);
+
+    Stream->Evpath_Stream =
+        EvpathDP->initReader(Svcs, CP_Stream, &Contact->Evpath_Info, Params,
+                             WriterContact, Stats);
+    Contact->Hostname = ShmGetHostname();
+    Stream->MyContactInfo = Contact;
+
+    *ReaderContactInfoPtr = Contact;
+    return Stream;
+}
+
+static void ShmUnmapSegments(Shm_RS_Stream Stream, long Timestep,
+                             int AllTimesteps)
+{
+    ShmMappedSegment Entry = Stream->Segments, Last = NULL;
+    while (Entry)
+    {
+        ShmMappedSegment Next = Entry->Next;
+        if (AllTimesteps || (Entry->Timestep == Timestep))
+        {
+            if (Last)
+            {
+                Last->Next = Next;
+            }
+            else
+            {
+                Stream->Segments = Next;
+            }
+            if (Entry->Addr)
+            {
+                munmap(Entry->Addr, Entry->Size);
+            }
+            free(Entry);
+        }
+        else
+        {
+            Last = Entry;
+        }
+        Entry = Next;
+    }
+}
+
+// reader-side routine, called from the main program
+static void ShmDestroyReader(CP_Services Svcs, DP_RS_Stream RS_Stream_v)
+{
+    Shm_RS_Stream RS_Stream = (Shm_RS_Stream)RS_Stream_v;
+    EvpathDP->destroyReader(Svcs, RS_Stream->Evpath_Stream);
+    pthread_mutex_lock(&RS_Stream->DataLock);
+    ShmUnmapSegments(RS_Stream, 0, 1);
+    pthread_mutex_unlock(&RS_Stream->DataLock);
+    for (int i = 0; i < RS_Stream->WriterCohortSize; i++)
+    {
+        free(RS_Stream->WriterSegmentPrefix[i]);
+    }
+    free(RS_Stream->WriterSegmentPrefix);
+    /* the evpath DP owns and has freed Evpath_Info */
+    free(RS_Stream->MyContactInfo->Hostname);
+    free(RS_Stream->MyContactInfo);
+    pthread_mutex_destroy(&RS_Stream->DataLock);
+    free(RS_Stream);
+}
+
+// writer-side routine, called from the main program
+static DP_WS_Stream ShmInitWriter(CP_Services Svcs, void *CP_Stream,
+                                  struct _SstParams *Params, attr_list DPAttrs,
+                                  SstStats Stats)
+{
+    static int StreamCount = 0;
+    Shm_WS_Stream Stream = calloc(1, sizeof(struct _Shm_WS_Stream));
+    char Prefix[64];
+
+    Stream->CP_Stream = CP_Stream;
+    Stream->Stats = Stats;
+    pthread_mutex_init(&Stream->DataLock, NULL);
+
+    Stream->Evpath_Stream =
+        EvpathDP->initWriter(Svcs, CP_Stream, Params, DPAttrs, Stats);
+
+    /* unique per process and per writer stream */
+    snprintf(Prefix, sizeof(Prefix), "/adios2-sst-%ld-%d", (long)getpid(),
+             __sync_fetch_and_add(&StreamCount, 1));
+    Stream->SegmentPrefix = strdup(Prefix);
+
+    return Stream;
+}
+
+// writer-side routine, called from the main program
+static void ShmDestroyWriter(CP_Services Svcs, DP_WS_Stream WS_Stream_v)
+{
+    Shm_WS_Stream WS_Stream = (Shm_WS_Stream)WS_Stream_v;
+    EvpathDP->destroyWriter(Svcs, WS_Stream->Evpath_Stream);
+    pthread_mutex_lock(&WS_Stream->DataLock);
+    while (WS_Stream->Segments)
+    {
+        ShmPublishedSegment Next = WS_Stream->Segments->Next;
+        shm_unlink(WS_Stream->Segments->Name);
+        free(WS_Stream->Segments->Name);
+        free(WS_Stream->Segments);
+        WS_Stream->Segments = Next;
+    }
+    pthread_mutex_unlock(&WS_Stream->DataLock);
+    pthread_mutex_destroy(&WS_Stream->DataLock);
+    for (int i = 0; i < WS_Stream->ReaderCount; i++)
+    {
+        /* the evpath DP owns and has freed Evpath_Info */
+        free(WS_Stream->WriterContactInfo[i]->Hostname);
+        free(WS_Stream->WriterContactInfo[i]->SegmentPrefix);
+        free(WS_Stream->WriterContactInfo[i]);
+    }
+    free(WS_Stream->WriterContactInfo);
+    free(WS_Stream->SegmentPrefix);
+    free(WS_Stream);
+}
+
+// writer-side routine, called from the main program
+static DP_WSR_Stream ShmInitWriterPerReader(CP_Services Svcs,
+                                            DP_WS_Stream WS_Stream_v,
+                                            int readerCohortSize,
+                                            CP_PeerCohort PeerCohort,
+                                            void **providedReaderInfo_v,
+                                            void **WriterContactInfoPtr)
+{
+    Shm_WS_Stream WS_Stream = (Shm_WS_Stream)WS_Stream_v;
+    ShmReaderContactInfo *providedReaderInfo =
+        (ShmReaderContactInfo *)providedReaderInfo_v;
+    void **EvpathReaderInfo = malloc(sizeof(void *) * readerCohortSize);
+    ShmWriterContactInfo ContactInfo =
+        calloc(1, sizeof(struct _ShmWriterContactInfo));
+    char *Hostname = ShmGetHostname();
+    int LocalReaders = 0;
+    DP_WSR_Stream WSR_Stream;
+
+    for (int i = 0; i < readerCohortSize; i++)
+    {
+        EvpathReaderInfo[i] = providedReaderInfo[i]->Evpath_Info;
+        if (strcmp(providedReaderInfo[i]->Hostname, Hostname) == 0)
+        {
+            LocalReaders++;
+        }
+    }
+    Svcs->verbose(WS_Stream->CP_Stream, DPPerRankVerbose,
+                  "Reader cohort of size %d has %d ranks on host \"%s\"\n",
+                  readerCohortSize, LocalReaders, Hostname);
+    pthread_mutex_lock(&WS_Stream->DataLock);
+    if (LocalReaders)
+    {
+        WS_Stream->LocalReaderCount++;
+    }
+    WS_Stream->WriterContactInfo =
+        realloc(WS_Stream->WriterContactInfo,
+                sizeof(ContactInfo) * (WS_Stream->ReaderCount + 1));
+    WS_Stream->WriterContactInfo[WS_Stream->ReaderCount] = ContactInfo;
+    WS_Stream->ReaderCount++;
+    pthread_mutex_unlock(&WS_Stream->DataLock);
+
+    WSR_Stream = EvpathDP->initWriterPerReader(
+        Svcs, WS_Stream->Evpath_Stream, readerCohortSize, PeerCohort,
+        EvpathReaderInfo, &ContactInfo->Evpath_Info);
+    free(EvpathReaderInfo);
+
+    ContactInfo->Hostname = Hostname;
+    ContactInfo->SegmentPrefix = strdup(WS_Stream->SegmentPrefix);
+    *WriterContactInfoPtr = ContactInfo;
+
+    /*
+     * The per-reader stream we hand back is the evpath one, so per-reader
+     * calls can be forwarded as they are.
+     */
+    return WSR_Stream;
+}
+
+// reader-side routine, called from the main program
+static void ShmProvideWriterDataToReader(CP_Services Svcs,
+                                         DP_RS_Stream RS_Stream_v,
+                                         int writerCohortSize,
+                                         CP_PeerCohort PeerCohort,
+                                         void **providedWriterInfo_v)
+{
+    Shm_RS_Stream RS_Stream = (Shm_RS_Stream)RS_Stream_v;
+    ShmWriterContactInfo *providedWriterInfo =
+        (ShmWriterContactInfo *)providedWriterInfo_v;
+    void **EvpathWriterInfo = malloc(sizeof(void *) * writerCohortSize);
+    int LocalWriters = 0;
+
+    RS_Stream->WriterCohortSize = writerCohortSize;
+    RS_Stream->WriterSegmentPrefix = calloc(writerCohortSize, sizeof(char *));
+    for (int i = 0; i < writerCohortSize; i++)
+    {
+        EvpathWriterInfo[i] = providedWriterInfo[i]->Evpath_Info;
+        if (strcmp(providedWriterInfo[i]->Hostname,
+                   RS_Stream->MyContactInfo->Hostname) == 0)
+        {
+            RS_Stream->WriterSegmentPrefix[i] =
+                strdup(providedWriterInfo[i]->SegmentPrefix);
+            LocalWriters++;
+        }
+    }
+    Svcs->verbose(RS_Stream->CP_Stream, DPPerRankVerbose,
+                  "Writer cohort of size %d has %d ranks on host \"%s\"\n",
+                  writerCohortSize, LocalWriters,
+                  RS_Stream->MyContactInfo->Hostname);
+
+    EvpathDP->provideWriterDataToReader(Svcs, RS_Stream->Evpath_Stream,
+                                        writerCohortSize, PeerCohort,
+                                        EvpathWriterInfo);
+    free(EvpathWriterInfo);
+}
+
+/*
+ * Find (or map) the segment writer rank 'Rank' published for 'Timestep'.
+ * Called with the stream's DataLock held.
+ */
+static ShmMappedSegment ShmGetSegment(CP_Services Svcs, Shm_RS_Stream Stream,
+                                      int Rank, long Timestep)
+{
+    ShmMappedSegment Entry = Stream->Segments;
+    char *Name;
+    int fd;
+    struct stat Stat;
+
+    while (Entry)
+    {
+        if ((Entry->WriterRank == Rank) && (Entry->Timestep == Timestep))
+        {
+            return Entry;
+        }
+        Entry = Entry->Next;
+    }
+
+    Entry = calloc(1, sizeof(*Entry));
+    Entry->WriterRank = Rank;
+    Entry->Timestep = Timestep;
+    Entry->Next = Stream->Segments;
+    Stream->Segments = Entry;
+
+    Name = ShmSegmentName(Stream->WriterSegmentPrefix[Rank], Timestep);
+    fd = shm_open(Name, O_RDONLY, 0);
+    if (fd == -1)
+    {
+        Svcs->verbose(Stream->CP_Stream, DPTraceVerbose,
+                      "No shared memory segment \"%s\" for timestep %ld from "
+                      "rank %d (%s), using evpath\n",
+                      Name, Timestep, Rank, strerror(errno));
+        free(Name);
+        return Entry;
+    }
+    if ((fstat(fd, &Stat) == 0) && (Stat.st_size > 0))
+    {
+        void *Addr =
+            mmap(NULL, (size_t)Stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (Addr != MAP_FAILED)
+        {
+            Entry->Addr = Addr;
+            Entry->Size = (size_t)Stat.st_size;
+        }
+    }
+    close(fd);
+    Svcs->verbose(Stream->CP_Stream, DPTraceVerbose,
+                  "Mapped shared memory segment \"%s\" of size %zu at %p\n",
+                  Name, Entry->Size, Entry->Addr);
+    free(Name);
+    return Entry;
+}
+
+// reader-side routine, called from the main program
+static void *ShmReadRemoteMemory(CP_Services Svcs, DP_RS_Stream Stream_v,
+                                 int Rank, long Timestep, size_t Offset,
+                                 size_t Length, void *Buffer,
+                                 void *DP_TimestepInfo)
+{
+    Shm_RS_Stream Stream = (Shm_RS_Stream)Stream_v;
+    ShmCompletionHandle ret = malloc(sizeof(struct _ShmCompletionHandle));
+
+    if (Stream->WriterSegmentPrefix[Rank])
+    {
+        ShmMappedSegment Segment;
+        pthread_mutex_lock(&Stream->DataLock);
+        Segment = ShmGetSegment(Svcs, Stream, Rank, Timestep);
+        if (Segment->Addr && (Offset + Length <= Segment->Size))
+        {
+            memcpy(Buffer, (char *)Segment->Addr + Offset, Length);
+            pthread_mutex_unlock(&Stream->DataLock);
+            Stream->Stats->DataBytesReceived += Length;
+            ret->Evpath_Handle = NULL;
+            return ret;
+        }
+        pthread_mutex_unlock(&Stream->DataLock);
+    }
+
+    ret->Evpath_Handle =
+        EvpathDP->readRemoteMemory(Svcs, Stream->Evpath_Stream, Rank, Timestep,
+                                   Offset, Length, Buffer, DP_TimestepInfo);
+    return ret;
+}
+
+// reader-side routine, called from the main program
+static int ShmWaitForCompletion(CP_Services Svcs, void *Handle_v)
+{
+    ShmCompletionHandle Handle = (ShmCompletionHandle)Handle_v;
+    int Ret = 1;
+    if (Handle->Evpath_Handle)
+    {
+        Ret = EvpathDP->waitForCompletion(Svcs, Handle->Evpath_Handle);
+    }
+    free(Handle);
+    return Ret;
+}
+
+// reader-side routine, called from the network handler thread
+static void ShmNotifyConnFailure(CP_Services Svcs, DP_RS_Stream Stream_v,
+                                 int FailedPeerRank)
+{
+    Shm_RS_Stream Stream = (Shm_RS_Stream)Stream_v;
+    EvpathDP->notifyConnFailure(Svcs, Stream->Evpath_Stream, FailedPeerRank);
+}
+
+// writer-side routine, called from the main program
+static void ShmWSReaderRegisterTimestep(CP_Services Svcs,
+                                        DP_WSR_Stream WSRStream_v,
+                                        long Timestep,
+                                        SstPreloadModeType PreloadMode)
+{
+    EvpathDP->readerRegisterTimestep(Svcs, WSRStream_v, Timestep,
+                                     SstPreloadNone);
+}
+
+// reader-side routine, called from the network handler thread
+static void ShmRSTimestepArrived(CP_Services Svcs, DP_RS_Stream RS_Stream_v,
+                                 long Timestep, SstPreloadModeType PreloadMode)
+{
+    Shm_RS_Stream RS_Stream = (Shm_RS_Stream)RS_Stream_v;
+    EvpathDP->timestepArrived(Svcs, RS_Stream->Evpath_Stream, Timestep,
+                              SstPreloadNone);
+}
+
+// reader-side routine, called from the main program
+static void ShmRSReleaseTimestep(CP_Services Svcs, DP_RS_Stream RS_Stream_v,
+                                 long Timestep)
+{
+    Shm_RS_Stream RS_Stream = (Shm_RS_Stream)RS_Stream_v;
+    pthread_mutex_lock(&RS_Stream->DataLock);
+    ShmUnmapSegments(RS_Stream, Timestep, 0);
+    pthread_mutex_unlock(&RS_Stream->DataLock);
+    if (EvpathDP->RSReleaseTimestep)
+    {
+        EvpathDP->RSReleaseTimestep(Svcs, RS_Stream->Evpath_Stream, Timestep);
+    }
+}
+
+static void ShmReaderReleaseTimestep(CP_Services Svcs, DP_WSR_Stream Stream_v,
+                                     long Timestep)
+{
+    EvpathDP->readerReleaseTimestep(Svcs, Stream_v, Timestep);
+}
+
+/*
+ * Copy the timestep's data into a new shared memory segment.  Returns the
+ * segment name, or NULL if the segment could not be created (the readers
+ * then get the data through evpath).
+ */
+static char *ShmPublishTimestep(CP_Services Svcs, Shm_WS_Stream WS_Stream,
+                                struct _SstData *Data, long Timestep)
+{
+    char *Name = ShmSegmentName(WS_Stream->SegmentPrefix, Timestep);
+    void *Addr;
+    int fd, err;
+
+    fd = shm_open(Name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (fd == -1)
+    {
+        Svcs->verbose(WS_Stream->CP_Stream, DPCriticalVerbose,
+                      "Failed to create shared memory segment \"%s\": %s\n",
+                      Name, strerror(errno));
+        free(Name);
+        return NULL;
+    }
+#if defined(__linux__)
+    /* reserve the pages now rather than SIGBUS on a full /dev/shm later */
+    err = posix_fallocate(fd, 0, (off_t)Data->DataSize);
+#else
+    err = (ftruncate(fd, (off_t)Data->DataSize) == 0) ? 0 : errno;
+#endif
+    if (err != 0)
+    {
+        Svcs->verbose(WS_Stream->CP_Stream, DPCriticalVerbose,
+                      "Failed to size shared memory segment \"%s\" to %zu "
+                      "bytes: %s\n",
+                      Name, Data->DataSize, strerror(err));
+        close(fd);
+        shm_unlink(Name);
+        free(Name);
+        return NULL;
+    }
+    Addr = mmap(NULL, Data->DataSize, PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (Addr == MAP_FAILED)
+    {
+        shm_unlink(Name);
+        free(Name);
+        return NULL;
+    }
+    memcpy(Addr, Data->block, Data->DataSize);
+    munmap(Addr, Data->DataSize);
+    return Name;
+}
+
+static void ShmProvideTimestep(CP_Services Svcs, DP_WS_Stream Stream_v,
+                               struct _SstData *Data,
+                               struct _SstData *LocalMetadata, long Timestep,
+                               void **TimestepInfoPtr)
+{
+    Shm_WS_Stream WS_Stream = (Shm_WS_Stream)Stream_v;
+    int LocalReaderCount;
+
+    pthread_mutex_lock(&WS_Stream->DataLock);
+    LocalReaderCount = WS_Stream->LocalReaderCount;
+    pthread_mutex_unlock(&WS_Stream->DataLock);
+
+    /*
+     * Only pay for the copy if some reader can use it.  Readers that show
+     * up later read this timestep through evpath.
+     */
+    if (LocalReaderCount && (Data->DataSize > 0))
+    {
+        char *Name = ShmPublishTimestep(Svcs, WS_Stream, Data, Timestep);
+        if (Name)
+        {
+            ShmPublishedSegment Entry = malloc(sizeof(*Entry));
+            Entry->Timestep = Timestep;
+            Entry->Name = Name;
+            Svcs->verbose(WS_Stream->CP_Stream, DPPerRankVerbose,
+                          "Published timestep %ld, %zu bytes, in shared "
+                          "memory segment \"%s\"\n",
+                          Timestep, Data->DataSize, Name);
+            pthread_mutex_lock(&WS_Stream->DataLock);
+            Entry->Next = WS_Stream->Segments;
+            WS_Stream->Segments = Entry;
+            pthread_mutex_unlock(&WS_Stream->DataLock);
+        }
+    }
+
+    EvpathDP->provideTimestep(Svcs, WS_Stream->Evpath_Stream, Data,
+                              LocalMetadata, Timestep, TimestepInfoPtr);
+}
+
+static void ShmReleaseTimestep(CP_Services Svcs, DP_WS_Stream Stream_v,
+                               long Timestep)
+{
+    Shm_WS_Stream WS_Stream = (Shm_WS_Stream)Stream_v;
+    ShmPublishedSegment Entry, Last = NULL;
+
+    pthread_mutex_lock(&WS_Stream->DataLock);
+    Entry = WS_Stream->Segments;
+    while (Entry)
+    {
+        if (Entry->Timestep == Timestep)
+        {
+            if (Last)
+            {
+                Last->Next = Entry->Next;
+            }
+            else
+            {
+                WS_Stream->Segments = Entry->Next;
+            }
+            /* readers that still have it mapped keep their mapping */
+            shm_unlink(Entry->Name);
+            free(Entry->Name);
+            free(Entry);
+            break;
+        }
+        Last = Entry;
+        Entry = Entry->Next;
+    }
+    pthread_mutex_unlock(&WS_Stream->DataLock);
+
+    EvpathDP->releaseTimestep(Svcs, WS_Stream->Evpath_Stream, Timestep);
+}
+
+static void ShmDestroyWriterPerReader(CP_Services Svcs,
+                                      DP_WSR_Stream WSR_Stream_v)
+{
+    EvpathDP->destroyWriterPerReader(Svcs, WSR_Stream_v);
+}
+
+/*
+ * The "Evpath_Info" field types are filled in from the evpath DP's own
+ * contact formats when the DP is loaded.
+ */
+static FMField ShmReaderContactList[] = {
+    {"Hostname", "string", sizeof(char *),
+     FMOffset(ShmReaderContactInfo, Hostname)},
+    {"Evpath_Info", NULL, 0, FMOffset(ShmReaderContactInfo, Evpath_Info)},
+    {NULL, NULL, 0, 0}};
+
+static FMField ShmWriterContactList[] = {
+    {"Hostname", "string", sizeof(char *),
+     FMOffset(ShmWriterContactInfo, Hostname)},
+    {"SegmentPrefix", "string", sizeof(char *),
+     FMOffset(ShmWriterContactInfo, SegmentPrefix)},
+    {"Evpath_Info", NULL, 0, FMOffset(ShmWriterContactInfo, Evpath_Info)},
+    {NULL, NULL, 0, 0}};
+
+#define SHM_MAX_CONTACT_STRUCTS 4
+
+static FMStructDescRec ShmReaderContactStructs[SHM_MAX_CONTACT_STRUCTS];
+static FMStructDescRec ShmWriterContactStructs[SHM_MAX_CONTACT_STRUCTS];
+
+/*
+ * Build {Top, <evpath formats>} and point Top's Evpath_Info field at the
+ * first evpath format.
+ */
+static void ShmCombineContactFormats(FMStructDescList Combined,
+                                     const char *TopName, FMFieldList TopList,
+                                     int TopSize, FMStructDescList Evpath)
+{
+    int i = 0, j = 0;
+    char *PointerType = malloc(strlen(Evpath[0].format_name) + 2);
+
+    Combined[0].format_name = TopName;
+    Combined[0].field_list = TopList;
+    Combined[0].struct_size = TopSize;
+    Combined[0].opt_info = NULL;
+    while (Evpath[i].format_name)
+    {
+        assert(i + 2 < SHM_MAX_CONTACT_STRUCTS);
+        Combined[i + 1] = Evpath[i];
+        i++;
+    }
+    memset(&Combined[i + 1], 0, sizeof(Combined[0]));
+
+    strcpy(PointerType, "*");
+    strcat(PointerType, Evpath[0].format_name);
+    while (strcmp(TopList[j].field_name, "Evpath_Info") != 0)
+    {
+        j++;
+    }
+    TopList[j].field_type = PointerType;
+    TopList[j].field_size = Evpath[0].struct_size;
+}
+
+static struct _CP_DP_Interface shmDPInterface = {
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL};
+
+static int ShmGetPriority(CP_Services Svcs, void *CP_Stream,
+                          struct _SstParams *Params)
+{
+    /*
+     * Prefer this over plain evpath: same-host readers get shared memory
+     * and every other reader gets exactly what evpath would have done.  An
+     * RDMA dp, if one can run, still wins.
+     */
+    return 2;
+}
+
+extern CP_DP_Interface LoadEVpathDP();
+
+/*
+ * Reader and writer may select their data plane concurrently from different
+ * threads of the same process, and building the contact formats is not
+ * idempotent, so do it exactly once.
+ */
+static void ShmInitInterface(void)
+{
+    EvpathDP = LoadEVpathDP();
+
+    ShmCombineContactFormats(ShmReaderContactStructs, "ShmReaderContactInfo",
+                             ShmReaderContactList,
+                             sizeof(struct _ShmReaderContactInfo),
+                             EvpathDP->ReaderContactFormats);
+    ShmCombineContactFormats(ShmWriterContactStructs, "ShmWriterContactInfo",
+                             ShmWriterContactList,
+                             sizeof(struct _ShmWriterContactInfo),
+                             EvpathDP->WriterContactFormats);
+
+    shmDPInterface.ReaderContactFormats = ShmReaderContactStructs;
+    shmDPInterface.WriterContactFormats = ShmWriterContactStructs;
+    shmDPInterface.TimestepInfoFormats = EvpathDP->TimestepInfoFormats;
+    shmDPInterface.initReader = ShmInitReader;
+    shmDPInterface.initWriter = ShmInitWriter;
+    shmDPInterface.initWriterPerReader = ShmInitWriterPerReader;
+    shmDPInterface.provideWriterDataToReader = ShmProvideWriterDataToReader;
+    shmDPInterface.readRemoteMemory = ShmReadRemoteMemory;
+    shmDPInterface.waitForCompletion = ShmWaitForCompletion;
+    shmDPInterface.notifyConnFailure = ShmNotifyConnFailure;
+    shmDPInterface.provideTimestep = ShmProvideTimestep;
+    shmDPInterface.releaseTimestep = ShmReleaseTimestep;
+    shmDPInterface.readerRegisterTimestep = ShmWSReaderRegisterTimestep;
+    shmDPInterface.readerReleaseTimestep = ShmReaderReleaseTimestep;
+    shmDPInterface.RSReleaseTimestep = ShmRSReleaseTimestep;
+    shmDPInterface.WSRreadPatternLocked = EvpathDP->WSRreadPatternLocked;
+    shmDPInterface.RSreadPatternLocked = EvpathDP->RSreadPatternLocked;
+    shmDPInterface.timestepArrived = ShmRSTimestepArrived;
+    shmDPInterface.destroyReader = ShmDestroyReader;
+    shmDPInterface.destroyWriter = ShmDestroyWriter;
+    shmDPInterface.destroyWriterPerReader = ShmDestroyWriterPerReader;
+    shmDPInterface.getPriority = ShmGetPriority;
+    shmDPInterface.unGetPriority = NULL;
+}
+
+extern NO_SANITIZE_THREAD CP_DP_Interface LoadShmDP()
+{
+    static pthread_once_t ShmInitOnce = PTHREAD_ONCE_INIT;
+    pthread_once(&ShmInitOnce, ShmInitInterface);
+    return &shmDPInterface;
+}
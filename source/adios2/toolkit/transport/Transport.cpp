@@ -21,6 +21,16 @@ Transport::Transport(const std::string type, const std::string library,
 {
 }
 
+void Transport::WriteV(const core::iovec *iov, const int iovcnt, size_t start)
+{
+    for (int i = 0; i < iovcnt; ++i)
+    {
+        // only the first region is positioned, the rest follow it
+        Write(static_cast<const char *>(iov[i].iov_base), iov[i].iov_len,
+              i == 0 ? start : MaxSizeT);
+    }
+}
+
 void Transport::IWrite(const char *buffer, size_t size, Status &status,
                        size_t start)
 {
@@ -32,6 +42,11 @@ void Transport::IRead(char *buffer, size_t size, Status &status, size_t start)
     throw std::invalid_argument("ERROR: this class doesn't implement IRead\n");
 }
 
+const char *Transport::MappedData(const size_t size, const size_t start)
+{
+    return nullptr;
+}
+
 void Transport::InitProfiler(const Mode openMode, const TimeUnit timeUnit)
 {
     m_Profiler.m_IsActive = true;
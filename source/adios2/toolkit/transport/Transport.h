@@ -103,6 +103,17 @@ public:
     virtual void Write(const char *buffer, size_t size,
                        size_t start = MaxSizeT) = 0;
 
+    /**
+     * Writes several memory regions back to back as a single gathered write.
+     * Default implementation calls Write for each region.
+     * @param iov memory regions to be written, in order
+     * @param iovcnt number of entries in iov
+     * @param start starting position of the first region (to allow rewind),
+     * if not passed then start at current stream position
+     */
+    virtual void WriteV(const core::iovec *iov, const int iovcnt,
+                        size_t start = MaxSizeT);
+
     virtual void IWrite(const char *buffer, size_t size, Status &status,
                         size_t start = MaxSizeT);
 
@@ -121,6 +132,16 @@ public:
     virtual void IRead(char *buffer, size_t size, Status &status,
                        size_t start = MaxSizeT);
 
+    /**
+     * Gives access to file contents without copying them, for transports
+     * that map the file into memory.
+     * @param size number of bytes needed
+     * @param start position of the first byte in the file
+     * @return pointer valid until Close, nullptr if the transport doesn't
+     * map files (default)
+     */
+    virtual const char *MappedData(const size_t size, const size_t start);
+
     /**
      * Returns the size of current data in transport
      * @return size as size_t
@@ -0,0 +1,500 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileIOUring.cpp file I/O using Linux io_uring through liburing
+ *
+ */
+#include "FileIOUring.h"
+
+#include "adios2/helper/adiosFunctions.h"
+
+#include <algorithm>   // std::min
+#include <cstdio>      // remove
+#include <cstring>     // strerror
+#include <errno.h>     // errno
+#include <fcntl.h>     // open
+#include <sys/stat.h>  // open, fstat
+#include <sys/types.h> // open
+#include <unistd.h>    // close
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <ios> //std::ios_base::failure
+/// \endcond
+
+namespace adios2
+{
+namespace transport
+{
+
+FileIOUring::FileIOUring(helper::Comm const &comm)
+: Transport("File", "IOUring", comm)
+{
+}
+
+FileIOUring::~FileIOUring()
+{
+    if (m_RingIsInitialized)
+    {
+        // buffers of outstanding requests may be gone after this
+        try
+        {
+            Flush();
+        }
+        catch (...)
+        {
+        }
+        io_uring_queue_exit(&m_Ring);
+    }
+    if (m_IsOpen)
+    {
+        close(m_FileDescriptor);
+    }
+}
+
+void FileIOUring::SetParameters(const Params &parameters)
+{
+    for (const auto &pair : parameters)
+    {
+        const std::string key = helper::LowerCase(pair.first);
+        const std::string value = helper::LowerCase(pair.second);
+
+        if (key == "queuedepth")
+        {
+            m_QueueDepth = helper::StringTo<uint32_t>(
+                value, " in Parameter key=QueueDepth");
+            if (m_QueueDepth == 0)
+            {
+                throw std::invalid_argument(
+                    "ERROR: QueueDepth must be greater than zero for "
+                    "IOUring file transport\n");
+            }
+        }
+    }
+}
+
+void FileIOUring::Open(const std::string &name, const Mode openMode,
+                       const bool /*async*/)
+{
+    m_Name = name;
+    CheckName();
+    m_OpenMode = openMode;
+    ProfilerStart("open");
+    errno = 0;
+    switch (m_OpenMode)
+    {
+    case (Mode::Write):
+        m_FileDescriptor =
+            open(m_Name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+        break;
+
+    case (Mode::Append):
+        m_FileDescriptor = open(m_Name.c_str(), O_RDWR | O_CREAT, 0777);
+        break;
+
+    case (Mode::Read):
+        m_FileDescriptor = open(m_Name.c_str(), O_RDONLY);
+        break;
+
+    default:
+        CheckFile("unknown open mode for file " + m_Name +
+                  ", in call to IOUring open");
+    }
+    m_Errno = errno;
+    ProfilerStop("open");
+
+    CheckFile("couldn't open file " + m_Name + ", in call to IOUring open");
+    m_IsOpen = true;
+    m_CurrentPos = 0;
+    if (m_OpenMode == Mode::Append)
+    {
+        SeekToEnd();
+    }
+    InitRing();
+}
+
+void FileIOUring::Write(const char *buffer, size_t size, size_t start)
+{
+    const size_t position = StartPosition(start, size);
+
+    std::vector<Request> requests;
+    requests.reserve(size / DefaultMaxFileBatchSize + 1);
+    for (size_t done = 0; done < size; done += DefaultMaxFileBatchSize)
+    {
+        requests.push_back({const_cast<char *>(buffer) + done,
+                            std::min(size - done, DefaultMaxFileBatchSize),
+                            position + done, true, NULL, 0});
+    }
+
+    ProfilerStart("write");
+    Execute(requests, "couldn't write to file " + m_Name +
+                          ", in call to IOUring Write");
+    ProfilerStop("write");
+}
+
+void FileIOUring::WriteV(const core::iovec *iov, const int iovcnt,
+                         size_t start)
+{
+    size_t size = 0;
+    for (int i = 0; i < iovcnt; ++i)
+    {
+        size += iov[i].iov_len;
+    }
+    size_t position = StartPosition(start, size);
+
+    // every region is an independent request, all in flight at once
+    std::vector<Request> requests;
+    requests.reserve(static_cast<size_t>(iovcnt));
+    for (int i = 0; i < iovcnt; ++i)
+    {
+        if (iov[i].iov_len > 0)
+        {
+            requests.push_back({static_cast<char *>(
+                                    const_cast<void *>(iov[i].iov_base)),
+                                iov[i].iov_len, position, true, NULL, 0});
+        }
+        position += iov[i].iov_len;
+    }
+
+    ProfilerStart("write");
+    Execute(requests, "couldn't write to file " + m_Name +
+                          ", in call to IOUring WriteV");
+    ProfilerStop("write");
+}
+
+void FileIOUring::IWrite(const char *buffer, size_t size, Status &status,
+                         size_t start)
+{
+    status.Bytes = 0;
+    status.Running = true;
+    status.Successful = false;
+    const size_t position = StartPosition(start, size);
+    if (size == 0)
+    {
+        status.Running = false;
+        status.Successful = true;
+        return;
+    }
+
+    ProfilerStart("write");
+    Enqueue(new Request{const_cast<char *>(buffer), size, position, true,
+                        &status, 0});
+    Submit();
+    while (Reap(false))
+    {
+    }
+    Submit();
+    ProfilerStop("write");
+}
+
+void FileIOUring::Read(char *buffer, size_t size, size_t start)
+{
+    const size_t position = StartPosition(start, size);
+
+    std::vector<Request> requests;
+    requests.reserve(size / DefaultMaxFileBatchSize + 1);
+    for (size_t done = 0; done < size; done += DefaultMaxFileBatchSize)
+    {
+        requests.push_back({buffer + done,
+                            std::min(size - done, DefaultMaxFileBatchSize),
+                            position + done, false, NULL, 0});
+    }
+
+    ProfilerStart("read");
+    Execute(requests, "couldn't read from file " + m_Name +
+                          ", in call to IOUring Read");
+    ProfilerStop("read");
+}
+
+void FileIOUring::IRead(char *buffer, size_t size, Status &status,
+                        size_t start)
+{
+    status.Bytes = 0;
+    status.Running = true;
+    status.Successful = false;
+    const size_t position = StartPosition(start, size);
+    if (size == 0)
+    {
+        status.Running = false;
+        status.Successful = true;
+        return;
+    }
+
+    ProfilerStart("read");
+    Enqueue(new Request{buffer, size, position, false, &status, 0});
+    Submit();
+    while (Reap(false))
+    {
+    }
+    Submit();
+    ProfilerStop("read");
+}
+
+size_t FileIOUring::GetSize()
+{
+    struct stat fileStat;
+    errno = 0;
+    if (fstat(m_FileDescriptor, &fileStat) == -1)
+    {
+        m_Errno = errno;
+        throw std::ios_base::failure("ERROR: couldn't get size of file " +
+                                     m_Name + SysErrMsg());
+    }
+    m_Errno = errno;
+    return static_cast<size_t>(fileStat.st_size);
+}
+
+void FileIOUring::Flush()
+{
+    if (!m_RingIsInitialized)
+    {
+        return;
+    }
+    Submit();
+    while (m_InFlight > 0)
+    {
+        Reap(true);
+        Submit();
+    }
+}
+
+void FileIOUring::Close()
+{
+    Flush();
+    if (m_RingIsInitialized)
+    {
+        io_uring_queue_exit(&m_Ring);
+        m_RingIsInitialized = false;
+    }
+
+    ProfilerStart("close");
+    errno = 0;
+    const int status = close(m_FileDescriptor);
+    m_Errno = errno;
+    ProfilerStop("close");
+
+    if (status == -1)
+    {
+        throw std::ios_base::failure("ERROR: couldn't close file " + m_Name +
+                                     ", in call to IOUring close" +
+                                     SysErrMsg());
+    }
+
+    m_IsOpen = false;
+}
+
+void FileIOUring::Delete()
+{
+    if (m_IsOpen)
+    {
+        Close();
+    }
+    std::remove(m_Name.c_str());
+}
+
+void FileIOUring::SeekToEnd() { m_CurrentPos = GetSize(); }
+
+void FileIOUring::SeekToBegin() { m_CurrentPos = 0; }
+
+// PRIVATE
+void FileIOUring::InitRing()
+{
+    const int ret = io_uring_queue_init(m_QueueDepth, &m_Ring, 0);
+    if (ret < 0)
+    {
+        m_Errno = -ret;
+        throw std::ios_base::failure(
+            "ERROR: couldn't create io_uring with QueueDepth=" +
+            std::to_string(m_QueueDepth) + " for file " + m_Name +
+            SysErrMsg());
+    }
+    m_RingIsInitialized = true;
+}
+
+void FileIOUring::Enqueue(Request *req)
+{
+    // keep completions within the completion queue capacity
+    while (m_InFlight >= m_QueueDepth)
+    {
+        Submit();
+        Reap(true);
+    }
+    struct io_uring_sqe *sqe = io_uring_get_sqe(&m_Ring);
+    if (sqe == NULL)
+    {
+        Submit();
+        sqe = io_uring_get_sqe(&m_Ring);
+    }
+
+    const unsigned int size =
+        static_cast<unsigned int>(std::min(req->Size, DefaultMaxFileBatchSize));
+    if (req->IsWrite)
+    {
+        io_uring_prep_write(sqe, m_FileDescriptor, req->Buffer, size,
+                            req->Offset);
+    }
+    else
+    {
+        io_uring_prep_read(sqe, m_FileDescriptor, req->Buffer, size,
+                           req->Offset);
+    }
+    io_uring_sqe_set_data(sqe, req);
+    ++m_InFlight;
+}
+
+void FileIOUring::Submit()
+{
+    int ret;
+    do
+    {
+        ret = io_uring_submit(&m_Ring);
+    } while (ret == -EINTR);
+
+    if (ret < 0)
+    {
+        m_Errno = -ret;
+        throw std::ios_base::failure(
+            "ERROR: couldn't submit io_uring requests for file " + m_Name +
+            SysErrMsg());
+    }
+}
+
+bool FileIOUring::Reap(const bool wait)
+{
+    struct io_uring_cqe *cqe = NULL;
+    int ret;
+    if (wait)
+    {
+        do
+        {
+            ret = io_uring_wait_cqe(&m_Ring, &cqe);
+        } while (ret == -EINTR);
+    }
+    else
+    {
+        ret = io_uring_peek_cqe(&m_Ring, &cqe);
+        if (ret == -EAGAIN)
+        {
+            return false;
+        }
+    }
+    if (ret < 0)
+    {
+        m_Errno = -ret;
+        throw std::ios_base::failure(
+            "ERROR: couldn't get io_uring completion for file " + m_Name +
+            SysErrMsg());
+    }
+
+    Request *req = static_cast<Request *>(io_uring_cqe_get_data(cqe));
+    const int res = cqe->res;
+    io_uring_cqe_seen(&m_Ring, cqe);
+    --m_InFlight;
+
+    if (res == -EINTR || res == -EAGAIN)
+    {
+        Enqueue(req);
+        return true;
+    }
+
+    if (res <= 0)
+    {
+        // failure, or no progress (end of file on read)
+        m_Errno = (res < 0) ? -res : EIO;
+        if (req->AsyncStatus)
+        {
+            req->AsyncStatus->Running = false;
+            req->AsyncStatus->Successful = false;
+            delete req;
+        }
+        else
+        {
+            req->Error = m_Errno;
+            req->Size = 0;
+        }
+        return true;
+    }
+
+    const size_t transferred = static_cast<size_t>(res);
+    req->Buffer += transferred;
+    req->Size -= transferred;
+    req->Offset += transferred;
+    if (req->AsyncStatus)
+    {
+        req->AsyncStatus->Bytes += transferred;
+    }
+
+    if (req->Size > 0)
+    {
+        // short transfer, continue with the remainder
+        Enqueue(req);
+    }
+    else if (req->AsyncStatus)
+    {
+        req->AsyncStatus->Running = false;
+        req->AsyncStatus->Successful = true;
+        delete req;
+    }
+    return true;
+}
+
+void FileIOUring::Execute(std::vector<Request> &requests,
+                          const std::string &hint)
+{
+    for (auto &req : requests)
+    {
+        Enqueue(&req);
+    }
+    Submit();
+
+    auto lf_Pending = [&]() -> bool {
+        for (const auto &req : requests)
+        {
+            if (req.Size > 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    while (lf_Pending())
+    {
+        Reap(true);
+        Submit();
+    }
+
+    for (const auto &req : requests)
+    {
+        if (req.Error)
+        {
+            m_Errno = req.Error;
+            throw std::ios_base::failure("ERROR: " + hint + SysErrMsg());
+        }
+    }
+}
+
+size_t FileIOUring::StartPosition(const size_t start,
+                                  const size_t size) noexcept
+{
+    const size_t position = (start == MaxSizeT) ? m_CurrentPos : start;
+    m_CurrentPos = position + size;
+    return position;
+}
+
+void FileIOUring::CheckFile(const std::string hint) const
+{
+    if (m_FileDescriptor == -1)
+    {
+        throw std::ios_base::failure("ERROR: " + hint + SysErrMsg());
+    }
+}
+
+std::string FileIOUring::SysErrMsg() const
+{
+    return std::string(": errno = " + std::to_string(m_Errno) + ": " +
+                       strerror(m_Errno));
+}
+
+} // end namespace transport
+} // end namespace adios2
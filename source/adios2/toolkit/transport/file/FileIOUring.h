@@ -0,0 +1,135 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileIOUring.h file I/O using Linux io_uring through liburing
+ *
+ */
+
+#ifndef ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEIOURING_H_
+#define ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEIOURING_H_
+
+#include <liburing.h>
+
+#include "adios2/common/ADIOSConfig.h"
+#include "adios2/toolkit/transport/Transport.h"
+
+namespace adios2
+{
+namespace helper
+{
+class Comm;
+}
+namespace transport
+{
+
+/**
+ * File transport submitting reads and writes through an io_uring submission
+ * queue. Write/Read/WriteV block until their requests complete, but submit
+ * all pieces at once so that up to QueueDepth requests are in flight.
+ * IWrite/IRead return right after submission; the passed Status is updated
+ * when the completion is reaped, which happens in any later call on the
+ * transport or in Flush, which waits for all outstanding requests.
+ * Buffers passed to IWrite/IRead must stay valid until Status.Running is
+ * false.
+ */
+class FileIOUring : public Transport
+{
+
+public:
+    FileIOUring(helper::Comm const &comm);
+
+    ~FileIOUring();
+
+    /** Async option is ignored, the open itself is synchronous */
+    void Open(const std::string &name, const Mode openMode,
+              const bool async = false) final;
+
+    /** QueueDepth: number of submission queue entries (default 64) */
+    void SetParameters(const Params &parameters) final;
+
+    void Write(const char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    void WriteV(const core::iovec *iov, const int iovcnt,
+                size_t start = MaxSizeT) final;
+
+    void IWrite(const char *buffer, size_t size, Status &status,
+                size_t start = MaxSizeT) final;
+
+    void Read(char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    void IRead(char *buffer, size_t size, Status &status,
+               size_t start = MaxSizeT) final;
+
+    size_t GetSize() final;
+
+    /** Waits for all outstanding asynchronous requests */
+    void Flush() final;
+
+    void Close() final;
+
+    void Delete() final;
+
+    void SeekToEnd() final;
+
+    void SeekToBegin() final;
+
+private:
+    /** One read or write, resubmitted until all bytes are transferred */
+    struct Request
+    {
+        char *Buffer;
+        size_t Size;   // bytes still to be transferred
+        size_t Offset; // file offset of Buffer
+        bool IsWrite;
+        Status *AsyncStatus; // NULL for blocking requests
+        int Error;           // errno of a failed blocking request
+    };
+
+    /** POSIX file handle returned by Open */
+    int m_FileDescriptor = -1;
+    int m_Errno = 0;
+
+    struct io_uring m_Ring;
+    bool m_RingIsInitialized = false;
+    unsigned int m_QueueDepth = 64;
+
+    /** stream position for calls without an explicit start */
+    size_t m_CurrentPos = 0;
+
+    /** requests submitted and not completed yet */
+    size_t m_InFlight = 0;
+
+    void InitRing();
+
+    /** Queues req into the submission ring, submitting and reaping if full */
+    void Enqueue(Request *req);
+
+    /** Submits everything queued so far */
+    void Submit();
+
+    /**
+     * Handles one completion, resubmitting short transfers
+     * @param wait true: block until a completion arrives
+     * @return false if !wait and no completion was available
+     */
+    bool Reap(const bool wait);
+
+    /** Runs blocking requests to completion, throws on failure */
+    void Execute(std::vector<Request> &requests, const std::string &hint);
+
+    /** Position for a request: start if passed, else stream position */
+    size_t StartPosition(const size_t start, const size_t size) noexcept;
+
+    /**
+     * Check if m_FileDescriptor is -1 after an operation
+     * @param hint exception message
+     */
+    void CheckFile(const std::string hint) const;
+    std::string SysErrMsg() const;
+};
+
+} // end namespace transport
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEIOURING_H_ */
@@ -0,0 +1,211 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileMMap.cpp read-only file access through a POSIX memory mapping
+ *
+ */
+#include "FileMMap.h"
+
+#include <cstdio>     // remove
+#include <cstring>    // strerror, std::memcpy
+#include <errno.h>    // errno
+#include <fcntl.h>    // open
+#include <sys/mman.h> // mmap, munmap
+#include <sys/stat.h> // fstat
+#include <unistd.h>   // close
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <ios>       //std::ios_base::failure
+#include <stdexcept> //std::invalid_argument
+/// \endcond
+
+namespace adios2
+{
+namespace transport
+{
+
+FileMMap::FileMMap(helper::Comm const &comm) : Transport("File", "MMap", comm)
+{
+}
+
+FileMMap::~FileMMap()
+{
+    if (m_IsOpen)
+    {
+        UnmapAll();
+        close(m_FileDescriptor);
+    }
+}
+
+void FileMMap::Open(const std::string &name, const Mode openMode,
+                    const bool /*async*/)
+{
+    m_Name = name;
+    CheckName();
+    m_OpenMode = openMode;
+    if (m_OpenMode != Mode::Read)
+    {
+        throw std::invalid_argument("ERROR: MMap transport only supports "
+                                    "Mode::Read, in call to Open file " +
+                                    m_Name);
+    }
+
+    ProfilerStart("open");
+    errno = 0;
+    m_FileDescriptor = open(m_Name.c_str(), O_RDONLY);
+    m_Errno = errno;
+    ProfilerStop("open");
+
+    CheckFile("couldn't open file " + m_Name + ", in call to MMap open");
+    m_IsOpen = true;
+    m_CurrentPos = 0;
+}
+
+void FileMMap::Write(const char * /*buffer*/, size_t /*size*/,
+                     size_t /*start*/)
+{
+    throw std::invalid_argument("ERROR: MMap transport is read-only, in call "
+                                "to Write file " +
+                                m_Name);
+}
+
+void FileMMap::Read(char *buffer, size_t size, size_t start)
+{
+    if (start == MaxSizeT)
+    {
+        start = m_CurrentPos;
+    }
+    if (size == 0)
+    {
+        return;
+    }
+    const char *data = MappedData(size, start);
+    ProfilerStart("read");
+    std::memcpy(buffer, data, size);
+    ProfilerStop("read");
+    m_CurrentPos = start + size;
+}
+
+const char *FileMMap::MappedData(const size_t size, const size_t start)
+{
+    MapUpTo(start + size, "in call to MMap Read/MappedData");
+    return m_Data + start;
+}
+
+size_t FileMMap::GetSize()
+{
+    struct stat fileStat;
+    errno = 0;
+    if (fstat(m_FileDescriptor, &fileStat) == -1)
+    {
+        m_Errno = errno;
+        throw std::ios_base::failure("ERROR: couldn't get size of file " +
+                                     m_Name + SysErrMsg());
+    }
+    m_Errno = errno;
+    return static_cast<size_t>(fileStat.st_size);
+}
+
+void FileMMap::Flush() {}
+
+void FileMMap::Close()
+{
+    UnmapAll();
+
+    ProfilerStart("close");
+    errno = 0;
+    const int status = close(m_FileDescriptor);
+    m_Errno = errno;
+    ProfilerStop("close");
+
+    if (status == -1)
+    {
+        throw std::ios_base::failure("ERROR: couldn't close file " + m_Name +
+                                     ", in call to MMap close" + SysErrMsg());
+    }
+
+    m_IsOpen = false;
+}
+
+void FileMMap::Delete()
+{
+    if (m_IsOpen)
+    {
+        Close();
+    }
+    std::remove(m_Name.c_str());
+}
+
+void FileMMap::SeekToEnd() { m_CurrentPos = GetSize(); }
+
+void FileMMap::SeekToBegin() { m_CurrentPos = 0; }
+
+// PRIVATE
+void FileMMap::MapUpTo(const size_t end, const std::string &hint)
+{
+    if (end <= m_MappedSize)
+    {
+        return;
+    }
+
+    const size_t fileSize = GetSize();
+    if (end > fileSize)
+    {
+        throw std::ios_base::failure(
+            "ERROR: couldn't read up to position " + std::to_string(end) +
+            " of file " + m_Name + " with size " + std::to_string(fileSize) +
+            ", " + hint);
+    }
+
+    ProfilerStart("read");
+    errno = 0;
+    void *data =
+        mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, m_FileDescriptor, 0);
+    m_Errno = errno;
+    ProfilerStop("read");
+    if (data == MAP_FAILED)
+    {
+        throw std::ios_base::failure("ERROR: couldn't map file " + m_Name +
+                                     ", " + hint + SysErrMsg());
+    }
+
+    if (m_Data != nullptr)
+    {
+        m_OldMappings.emplace_back(m_Data, m_MappedSize);
+    }
+    m_Data = static_cast<char *>(data);
+    m_MappedSize = fileSize;
+}
+
+void FileMMap::UnmapAll() noexcept
+{
+    for (const auto &mapping : m_OldMappings)
+    {
+        munmap(mapping.first, mapping.second);
+    }
+    m_OldMappings.clear();
+    if (m_Data != nullptr)
+    {
+        munmap(m_Data, m_MappedSize);
+        m_Data = nullptr;
+    }
+    m_MappedSize = 0;
+}
+
+void FileMMap::CheckFile(const std::string hint) const
+{
+    if (m_FileDescriptor == -1)
+    {
+        throw std::ios_base::failure("ERROR: " + hint + SysErrMsg());
+    }
+}
+
+std::string FileMMap::SysErrMsg() const
+{
+    return std::string(": errno = " + std::to_string(m_Errno) + ": " +
+                       strerror(m_Errno));
+}
+
+} // end namespace transport
+} // end namespace adios2
@@ -0,0 +1,100 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileMMap.h read-only file access through a POSIX memory mapping
+ *
+ */
+
+#ifndef ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEMMAP_H_
+#define ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEMMAP_H_
+
+#include <utility> //std::pair
+#include <vector>
+
+#include "adios2/common/ADIOSConfig.h"
+#include "adios2/toolkit/transport/Transport.h"
+
+namespace adios2
+{
+namespace helper
+{
+class Comm;
+}
+namespace transport
+{
+
+/**
+ * Read-only file transport mapping the whole file into memory. Read copies
+ * out of the mapping, MappedData hands out pointers into it. A file that
+ * grew since it was mapped is mapped again, earlier mappings are kept until
+ * Close so that pointers returned by MappedData stay valid until then.
+ */
+class FileMMap : public Transport
+{
+
+public:
+    FileMMap(helper::Comm const &comm);
+
+    ~FileMMap();
+
+    /** Only Mode::Read is supported, async is ignored */
+    void Open(const std::string &name, const Mode openMode,
+              const bool async = false) final;
+
+    /** Throws, the transport is read-only */
+    void Write(const char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    void Read(char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    const char *MappedData(const size_t size, const size_t start) final;
+
+    size_t GetSize() final;
+
+    /** Does nothing, nothing is ever written */
+    void Flush() final;
+
+    void Close() final;
+
+    void Delete() final;
+
+    void SeekToEnd() final;
+
+    void SeekToBegin() final;
+
+private:
+    /** POSIX file handle returned by Open */
+    int m_FileDescriptor = -1;
+    int m_Errno = 0;
+
+    /** mapping of the first m_MappedSize bytes of the file */
+    char *m_Data = nullptr;
+    size_t m_MappedSize = 0;
+    /** smaller mappings of a file that grew, unmapped at Close */
+    std::vector<std::pair<char *, size_t>> m_OldMappings;
+
+    /** stream position for calls without an explicit start */
+    size_t m_CurrentPos = 0;
+
+    /**
+     * Makes sure the first end bytes of the file are mapped, mapping the
+     * file again if it grew
+     * @param end offset one past the last byte needed
+     * @param hint exception message
+     */
+    void MapUpTo(const size_t end, const std::string &hint);
+
+    void UnmapAll() noexcept;
+
+    /**
+     * Check if m_FileDescriptor is -1 after an operation
+     * @param hint exception message
+     */
+    void CheckFile(const std::string hint) const;
+    std::string SysErrMsg() const;
+};
+
+} // end namespace transport
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEMMAP_H_ */
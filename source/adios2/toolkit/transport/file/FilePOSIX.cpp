@@ -16,8 +16,12 @@
 #include <stddef.h>    // write output
 #include <sys/stat.h>  // open, fstat
 #include <sys/types.h> // open
+#include <sys/uio.h>   // writev, pwritev
 #include <unistd.h>    // write, close
 
+#include <algorithm> // std::min
+#include <climits>   // IOV_MAX
+
 /// \cond EXCLUDE_FROM_DOXYGEN
 #include <ios> //std::ios_base::failure
 /// \endcond
@@ -263,6 +267,123 @@ void FilePOSIX::Write(const char *buffer, size_t size, size_t start)
     }
 }
 
+void FilePOSIX::WriteV(const core::iovec *iov, const int iovcnt, size_t start)
+{
+#ifdef IOV_MAX
+    const int maxBatchCount = IOV_MAX;
+#else
+    const int maxBatchCount = 1024;
+#endif
+    WaitForOpen();
+
+    const bool positioned = (start != MaxSizeT);
+#ifndef ADIOS2_HAVE_PWRITEV
+    if (positioned)
+    {
+        errno = 0;
+        const auto newPosition = lseek(m_FileDescriptor, start, SEEK_SET);
+        m_Errno = errno;
+
+        if (static_cast<size_t>(newPosition) != start)
+        {
+            throw std::ios_base::failure(
+                "ERROR: couldn't move to start position " +
+                std::to_string(start) + " in file " + m_Name +
+                ", in call to POSIX lseek" + SysErrMsg());
+        }
+    }
+#endif
+    size_t position = start;
+
+    std::vector<struct ::iovec> batch(
+        static_cast<size_t>(std::min(iovcnt, maxBatchCount)));
+    int entry = 0;
+    // bytes of iov[entry] already written by a previous (partial) call
+    size_t entryPos = 0;
+    while (entry < iovcnt)
+    {
+        // gather as many regions as allowed, capped to the batch size limit
+        int count = 0;
+        size_t batchSize = 0;
+        for (int i = entry; i < iovcnt && count < maxBatchCount &&
+                            batchSize < DefaultMaxFileBatchSize;
+             ++i)
+        {
+            const size_t offset = (i == entry) ? entryPos : 0;
+            const size_t len = std::min(iov[i].iov_len - offset,
+                                        DefaultMaxFileBatchSize - batchSize);
+            if (len == 0)
+            {
+                continue;
+            }
+            batch[count].iov_base = const_cast<char *>(
+                static_cast<const char *>(iov[i].iov_base) + offset);
+            batch[count].iov_len = len;
+            batchSize += len;
+            ++count;
+        }
+        if (count == 0)
+        {
+            break;
+        }
+
+        ProfilerStart("write");
+        errno = 0;
+#ifdef ADIOS2_HAVE_PWRITEV
+        const auto writtenSize =
+            positioned ? pwritev(m_FileDescriptor, batch.data(), count,
+                                 static_cast<off_t>(position))
+                       : writev(m_FileDescriptor, batch.data(), count);
+#else
+        const auto writtenSize = writev(m_FileDescriptor, batch.data(), count);
+#endif
+        m_Errno = errno;
+        ProfilerStop("write");
+
+        if (writtenSize == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            throw std::ios_base::failure(
+                "ERROR: couldn't write to file " + m_Name +
+                ", in call to POSIX writev" + SysErrMsg());
+        }
+
+        position += static_cast<size_t>(writtenSize);
+        // advance over fully and partially written regions
+        size_t remaining = static_cast<size_t>(writtenSize);
+        while (entry < iovcnt && remaining >= iov[entry].iov_len - entryPos)
+        {
+            remaining -= iov[entry].iov_len - entryPos;
+            entryPos = 0;
+            ++entry;
+        }
+        entryPos += remaining;
+    }
+
+#ifdef ADIOS2_HAVE_PWRITEV
+    if (positioned)
+    {
+        // pwritev doesn't move the file offset, keep Write semantics so that
+        // subsequent non-positioned writes continue after this block
+        errno = 0;
+        const auto newPosition = lseek(m_FileDescriptor, position, SEEK_SET);
+        m_Errno = errno;
+
+        if (static_cast<size_t>(newPosition) != position)
+        {
+            throw std::ios_base::failure(
+                "ERROR: couldn't move to position " + std::to_string(position) +
+                " in file " + m_Name + ", in call to POSIX lseek" +
+                SysErrMsg());
+        }
+    }
+#endif
+}
+
 void FilePOSIX::Read(char *buffer, size_t size, size_t start)
 {
     auto lf_Read = [&](char *buffer, size_t size) {
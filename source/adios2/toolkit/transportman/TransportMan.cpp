@@ -17,6 +17,7 @@
 
 /// transports
 #ifndef _WIN32
+#include "adios2/toolkit/transport/file/FileMMap.h"
 #include "adios2/toolkit/transport/file/FilePOSIX.h"
 #endif
 #ifdef ADIOS2_HAVE_DAOS
@@ -25,6 +26,9 @@
 #ifdef ADIOS2_HAVE_IME
 #include "adios2/toolkit/transport/file/FileIME.h"
 #endif
+#ifdef ADIOS2_HAVE_IOURING
+#include "adios2/toolkit/transport/file/FileIOUring.h"
+#endif
 
 #ifdef _WIN32
 #pragma warning(disable : 4503) // length of std::function inside std::async
@@ -243,6 +247,35 @@ void TransportMan::WriteFileAt(const char *buffer, const size_t size,
     }
 }
 
+void TransportMan::WriteFiles(const core::iovec *iov, const size_t iovcnt,
+                              const int transportIndex)
+{
+    WriteFileAt(iov, iovcnt, MaxSizeT, transportIndex);
+}
+
+void TransportMan::WriteFileAt(const core::iovec *iov, const size_t iovcnt,
+                               const size_t start, const int transportIndex)
+{
+    if (transportIndex == -1)
+    {
+        for (auto &transportPair : m_Transports)
+        {
+            auto &transport = transportPair.second;
+            if (transport->m_Type == "File")
+            {
+                transport->WriteV(iov, static_cast<int>(iovcnt), start);
+            }
+        }
+    }
+    else
+    {
+        auto itTransport = m_Transports.find(transportIndex);
+        CheckFile(itTransport, ", in call to WriteFileAt with index " +
+                                   std::to_string(transportIndex));
+        itTransport->second->WriteV(iov, static_cast<int>(iovcnt), start);
+    }
+}
+
 void TransportMan::SeekToFileEnd(const int transportIndex)
 {
     if (transportIndex == -1)
@@ -304,6 +337,15 @@ void TransportMan::ReadFile(char *buffer, const size_t size, const size_t start,
     itTransport->second->Read(buffer, size, start);
 }
 
+const char *TransportMan::MappedData(const size_t size, const size_t start,
+                                     const size_t transportIndex)
+{
+    auto itTransport = m_Transports.find(transportIndex);
+    CheckFile(itTransport, ", in call to MappedData with index " +
+                               std::to_string(transportIndex));
+    return itTransport->second->MappedData(size, start);
+}
+
 void TransportMan::FlushFiles(const int transportIndex)
 {
     if (transportIndex == -1)
@@ -458,6 +500,16 @@ std::shared_ptr<Transport> TransportMan::OpenFileTransport(
                     " transport does not support buffered I/O.");
             }
         }
+        else if (library == "MMap" || library == "mmap")
+        {
+            transport = std::make_shared<transport::FileMMap>(m_Comm);
+            if (lf_GetBuffered("false"))
+            {
+                throw std::invalid_argument(
+                    "ERROR: " + library +
+                    " transport does not support buffered I/O.");
+            }
+        }
 #endif
 #ifdef ADIOS2_HAVE_DAOS
         else if (library == "Daos" || library == "daos")
@@ -476,6 +528,18 @@ std::shared_ptr<Transport> TransportMan::OpenFileTransport(
         {
             transport = std::make_shared<transport::FileIME>(m_Comm);
         }
+#endif
+#ifdef ADIOS2_HAVE_IOURING
+        else if (library == "IOUring" || library == "iouring")
+        {
+            transport = std::make_shared<transport::FileIOUring>(m_Comm);
+            if (lf_GetBuffered("false"))
+            {
+                throw std::invalid_argument(
+                    "ERROR: " + library +
+                    " transport does not support buffered I/O.");
+            }
+        }
 #endif
         else if (library == "NULL" || library == "null")
         {
@@ -132,6 +132,25 @@ public:
     void WriteFiles(const char *buffer, const size_t size,
                     const int transportIndex = -1);
 
+    /**
+     * Write a list of memory regions to file transports as one gathered write
+     * @param iov memory regions, in order
+     * @param iovcnt number of entries in iov
+     * @param transportIndex
+     */
+    void WriteFiles(const core::iovec *iov, const size_t iovcnt,
+                    const int transportIndex = -1);
+
+    /**
+     * Write a list of memory regions to a specific location in files
+     * @param iov memory regions, in order
+     * @param iovcnt number of entries in iov
+     * @param start file position of the first region
+     * @param transportIndex
+     */
+    void WriteFileAt(const core::iovec *iov, const size_t iovcnt,
+                     const size_t start, const int transportIndex = -1);
+
     /**
      * Write data to a specific location in files
      * @param transportIndex
@@ -153,6 +172,17 @@ public:
     void ReadFile(char *buffer, const size_t size, const size_t start = 0,
                   const size_t transportIndex = 0);
 
+    /**
+     * Pointer to contents of a single file if its transport maps it into
+     * memory, valid until the file is closed
+     * @param size
+     * @param start
+     * @param transportIndex
+     * @return nullptr if the transport doesn't map files
+     */
+    const char *MappedData(const size_t size, const size_t start = 0,
+                           const size_t transportIndex = 0);
+
     /**
      * Flush file or files depending on transport index. Throws an exception
      * if transport is not a file when transportIndex > -1.
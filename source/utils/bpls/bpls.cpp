@@ -97,6 +97,7 @@ bool hidden_attrs;     // show hidden attrs in BP file
 int hidden_attrs_flag; // to be passed on in option struct
 bool show_decomp;      // show decomposition of arrays
 bool show_version;     // print binary version info of file before work
+bool use_mmap;         // read files through a memory mapping
 
 // other global variables
 char *prgname; /* argv[0] */
@@ -167,6 +168,9 @@ void display_help()
         "file\n"
         "  --decomp    | -D           Show decomposition of variables as layed "
         "out in file\n"
+        "  --mmap                     Read BP files through a memory mapping "
+        "instead of\n"
+        "                               copying them into memory\n"
         /*
            "  --time    | -t N [M]      # print data for timesteps N..M only (or
            only N)\n"
@@ -583,6 +587,8 @@ int bplsMain(int argc, char *argv[])
         "--decompose", &show_decomp,
         "| -D Show decomposition of variables as layed out in file");
     arg.AddBooleanArgument("-D", &show_decomp, "");
+    arg.AddBooleanArgument("--mmap", &use_mmap,
+                           "  Read BP files through a memory mapping");
     arg.AddBooleanArgument(
         "--version", &show_version,
         "Print version information (add -verbose for additional"
@@ -708,6 +714,7 @@ void init_globals()
     printByteAsChar = false;
     show_decomp = false;
     show_version = false;
+    use_mmap = false;
     for (i = 0; i < MAX_DIMS; i++)
     {
         istart[i] = 0LL;
@@ -1488,6 +1495,10 @@ int doList(const char *path)
         // BP4 can process metadata in chuncks to conserve memory
         io.SetParameter("StreamReader", "true");
     }
+    if (use_mmap)
+    {
+        io.AddTransport("File", {{"Library", "mmap"}});
+    }
     core::Engine *fp = nullptr;
     std::vector<std::string> engineList = getEnginesList(path);
     for (auto &engineName : engineList)
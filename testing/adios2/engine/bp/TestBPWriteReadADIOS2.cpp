@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <cstring>
 
+#include <fstream>
 #include <iostream>
 #include <numeric> //std::iota
 #include <stdexcept>
@@ -1858,6 +1859,101 @@ TEST_F(BPWriteReadTestADIOS2, ReadStartCount)
     }
 }
 
+TEST_F(BPWriteReadTestADIOS2, TraceJSON)
+{
+    if (engineName == "BP3")
+    {
+        GTEST_SKIP();
+    }
+    const std::string fname("TraceJSON.bp");
+    const std::size_t Nx = 10;
+    const std::size_t NSteps = 3;
+
+    int mpiRank = 0, mpiSize = 1;
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+
+    std::vector<double> localData(Nx);
+    {
+        adios2::IO io = adios.DeclareIO("TraceWrite");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        io.SetParameter("Trace", "On");
+        auto var = io.DefineVariable<double>(
+            "r64", {static_cast<std::size_t>(Nx * mpiSize)},
+            {static_cast<std::size_t>(Nx * mpiRank)}, {Nx});
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            std::iota(localData.begin(), localData.end(),
+                      static_cast<double>(step * Nx));
+            bpWriter.BeginStep();
+            bpWriter.Put(var, localData.data());
+            bpWriter.EndStep();
+        }
+        bpWriter.Close();
+    }
+    {
+        adios2::IO io = adios.DeclareIO("TraceRead");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        io.SetParameter("Trace", "On");
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+        while (bpReader.BeginStep() == adios2::StepStatus::OK)
+        {
+            auto var = io.InquireVariable<double>("r64");
+            EXPECT_TRUE(var);
+            bpReader.Get(var, localData, adios2::Mode::Sync);
+            bpReader.EndStep();
+        }
+        bpReader.Close();
+    }
+
+    if (mpiRank == 0)
+    {
+        auto lf_ReadFile = [](const std::string &fileName) {
+            std::ifstream file(fileName);
+            EXPECT_TRUE(file.good()) << fileName;
+            return std::string(std::istreambuf_iterator<char>(file),
+                               std::istreambuf_iterator<char>());
+        };
+        const std::string engine = engineName.empty() ? "BP4" : engineName;
+
+        const std::string writerTrace = lf_ReadFile(fname + "/trace.json");
+        EXPECT_EQ(writerTrace.front(), '[');
+        EXPECT_EQ(writerTrace.substr(writerTrace.size() - 3), "\n]\n");
+        EXPECT_NE(writerTrace.find("\"name\":\"" + engine +
+                                   "Writer::WriteData\",\"cat\":\"" + engine +
+                                   "Writer\",\"ph\":\"E\""),
+                  std::string::npos);
+        EXPECT_NE(writerTrace.find("\"args\":{\"step\":" +
+                                   std::to_string(NSteps - 1) + "}"),
+                  std::string::npos);
+        EXPECT_NE(writerTrace.find("\"pid\":" + std::to_string(mpiSize - 1)),
+                  std::string::npos);
+
+        const std::string readerTrace =
+            lf_ReadFile(fname + "/reader_trace.json");
+        EXPECT_NE(readerTrace.find(engine + "Reader::ReadData"),
+                  std::string::npos);
+        EXPECT_NE(readerTrace.find(engine + "Reader::InstallMetadata"),
+                  std::string::npos);
+        // events of the writer engine happened before the reader was opened
+        EXPECT_EQ(readerTrace.find("Writer::"), std::string::npos);
+    }
+}
+
 //******************************************************************************
 // main
 //******************************************************************************
@@ -2057,6 +2057,291 @@ TEST_F(BPWriteReadMultiblockTest, ADIOS2BPWriteReadMultiblock2D4x2)
     }
 }
 
+//******************************************************************************
+// BP5 metadata installed eagerly and lazily
+//******************************************************************************
+
+TEST_F(BPWriteReadMultiblockTest, BP5WriteReadLazyMetadata)
+{
+    // variables written in some steps only and read in other steps, the
+    // lazily merged records must match the eagerly installed ones
+    int mpiRank = 0, mpiSize = 1;
+    const size_t Nx = 10;
+    const size_t NSteps = 4;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    const std::string fname("BP5WriteReadLazyMetadata.bp");
+    const auto lf_Value = [&](const size_t step, const size_t block,
+                              const size_t i) {
+        return static_cast<double>(step * 10000 + (mpiRank * 2 + block) * Nx +
+                                   i);
+    };
+
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetEngine("BP5");
+        const adios2::Dims shape{static_cast<size_t>(2 * Nx * mpiSize)};
+        auto var_r64 = io.DefineVariable<double>("r64", shape, {0}, {Nx});
+        auto var_odd = io.DefineVariable<int32_t>("odd", {}, {}, {Nx});
+        auto var_step = io.DefineVariable<uint64_t>("step");
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+        std::vector<double> r64(Nx);
+        std::vector<int32_t> odd(Nx);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            bpWriter.BeginStep();
+            for (size_t block = 0; block < 2; ++block)
+            {
+                for (size_t i = 0; i < Nx; ++i)
+                {
+                    r64[i] = lf_Value(step, block, i);
+                }
+                var_r64.SetSelection(
+                    {{(2 * static_cast<size_t>(mpiRank) + block) * Nx}, {Nx}});
+                bpWriter.Put(var_r64, r64.data(), adios2::Mode::Sync);
+            }
+            if (step % 2 == 1)
+            {
+                for (size_t i = 0; i < Nx; ++i)
+                {
+                    odd[i] =
+                        static_cast<int32_t>(step * 100 + mpiRank * Nx + i);
+                }
+                bpWriter.Put(var_odd, odd.data(), adios2::Mode::Sync);
+            }
+            if (mpiRank == 0)
+            {
+                bpWriter.Put(var_step, static_cast<uint64_t>(step));
+            }
+            bpWriter.EndStep();
+        }
+        bpWriter.Close();
+    }
+
+    for (const std::string lazy : {"false", "true"})
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO_" + lazy);
+        io.SetEngine("BP5");
+        io.SetParameters({{"LazyMetadata", lazy}, {"Threads", "4"}});
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        std::vector<double> r64;
+        std::vector<int32_t> odd;
+        while (bpReader.BeginStep() == adios2::StepStatus::OK)
+        {
+            const size_t step = bpReader.CurrentStep();
+            auto var_r64 = io.InquireVariable<double>("r64");
+            auto var_odd = io.InquireVariable<int32_t>("odd");
+            auto var_step = io.InquireVariable<uint64_t>("step");
+            ASSERT_TRUE(var_r64);
+            ASSERT_TRUE(var_step);
+            ASSERT_EQ(static_cast<bool>(var_odd), step % 2 == 1);
+
+            uint64_t writtenStep = 0;
+            bpReader.Get(var_step, writtenStep, adios2::Mode::Sync);
+            EXPECT_EQ(writtenStep, step) << lazy;
+
+            // r64 is left unread in step 1, odd in step 3
+            if (step != 1)
+            {
+                var_r64.SetSelection(
+                    {{2 * static_cast<size_t>(mpiRank) * Nx + Nx / 2}, {Nx}});
+                bpReader.Get(var_r64, r64);
+            }
+            if (step == 1)
+            {
+                var_odd.SetBlockSelection(mpiRank);
+                bpReader.Get(var_odd, odd);
+            }
+            const auto blocks = bpReader.BlocksInfo(var_r64, step);
+            EXPECT_EQ(blocks.size(), 2 * static_cast<size_t>(mpiSize));
+            bpReader.EndStep();
+
+            if (step != 1)
+            {
+                for (size_t i = 0; i < Nx; ++i)
+                {
+                    const size_t pos = Nx / 2 + i;
+                    ASSERT_EQ(r64[i], lf_Value(step, pos / Nx, pos % Nx))
+                        << lazy << " step=" << step << " i=" << i;
+                }
+            }
+            if (step == 1)
+            {
+                ASSERT_EQ(odd.size(), Nx);
+                for (size_t i = 0; i < Nx; ++i)
+                {
+                    ASSERT_EQ(odd[i],
+                              static_cast<int32_t>(step * 100 + mpiRank * Nx +
+                                                   i))
+                        << lazy << " i=" << i;
+                }
+            }
+        }
+        bpReader.Close();
+    }
+}
+
+// checks a variable read with LazyMetadata against the one read at Open
+template <class T>
+void CompareLazyMetadata(adios2::IO &eagerIO, adios2::Engine &eager,
+                         adios2::IO &lazyIO, adios2::Engine &lazy,
+                         const std::string &name, const size_t steps)
+{
+    adios2::Variable<T> e = eagerIO.InquireVariable<T>(name);
+    adios2::Variable<T> l = lazyIO.InquireVariable<T>(name);
+    ASSERT_TRUE(e);
+    ASSERT_TRUE(l);
+    EXPECT_EQ(l.Shape(), e.Shape()) << name;
+    EXPECT_EQ(l.Steps(), e.Steps()) << name;
+    EXPECT_EQ(l.ShapeID(), e.ShapeID()) << name;
+    EXPECT_EQ(l.MinMax(), e.MinMax()) << name;
+    for (size_t step = 0; step < steps; ++step)
+    {
+        const auto eBlocks = eager.BlocksInfo(e, step);
+        const auto lBlocks = lazy.BlocksInfo(l, step);
+        ASSERT_EQ(lBlocks.size(), eBlocks.size()) << name << " " << step;
+        for (size_t b = 0; b < eBlocks.size(); ++b)
+        {
+            EXPECT_EQ(lBlocks[b].Count, eBlocks[b].Count) << name;
+            EXPECT_EQ(lBlocks[b].Min, eBlocks[b].Min) << name;
+            EXPECT_EQ(lBlocks[b].Max, eBlocks[b].Max) << name;
+        }
+    }
+}
+
+TEST_F(BPWriteReadMultiblockTest, BP4WriteReadLazyMetadata)
+{
+    // the variables defined with block statistics parsed on demand must
+    // report the same shapes, steps, blocks and min/max as the ones parsed
+    // at Open
+    int mpiRank = 0, mpiSize = 1;
+    const size_t Nx = 10;
+    const size_t NSteps = 4;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    const std::string fname("BP4WriteReadLazyMetadata.bp");
+
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetEngine("BP4");
+        auto var_r64 = io.DefineVariable<double>(
+            "r64", {Nx * mpiSize}, {Nx * mpiRank}, {Nx});
+        auto var_odd = io.DefineVariable<int32_t>("odd", {}, {}, {Nx});
+        auto var_step = io.DefineVariable<uint64_t>("step");
+        auto var_rank = io.DefineVariable<int32_t>(
+            "rank", {adios2::LocalValueDim});
+        auto var_name = io.DefineVariable<std::string>("name");
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+        std::vector<double> r64;
+        std::vector<int32_t> odd(Nx);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            // the global array grows, its shape is set by the last block
+            const size_t rows = step + 1;
+            var_r64.SetShape({rows, Nx * mpiSize});
+            var_r64.SetSelection({{0, Nx * mpiRank}, {rows, Nx}});
+            r64.resize(rows * Nx);
+            for (size_t i = 0; i < r64.size(); ++i)
+            {
+                r64[i] = static_cast<double>(step * 1000 + mpiRank * 100 + i);
+            }
+            bpWriter.BeginStep();
+            bpWriter.Put(var_r64, r64.data());
+            if (step % 2 == 1)
+            {
+                for (size_t i = 0; i < Nx; ++i)
+                {
+                    odd[i] = static_cast<int32_t>(step * 100 + mpiRank * Nx +
+                                                  i) -
+                             50;
+                }
+                bpWriter.Put(var_odd, odd.data());
+            }
+            bpWriter.Put(var_rank, static_cast<int32_t>(mpiRank));
+            if (mpiRank == 0)
+            {
+                bpWriter.Put(var_step, static_cast<uint64_t>(step));
+                bpWriter.Put(var_name, "step" + std::to_string(step));
+            }
+            bpWriter.EndStep();
+        }
+        bpWriter.Close();
+    }
+
+    adios2::IO eagerIO = adios.DeclareIO("ReadIO_eager");
+    eagerIO.SetEngine("BP4");
+    adios2::Engine eager = eagerIO.Open(fname, adios2::Mode::Read);
+
+    adios2::IO lazyIO = adios.DeclareIO("ReadIO_lazy");
+    lazyIO.SetEngine("BP4");
+    lazyIO.SetParameters({{"LazyMetadata", "true"}, {"Threads", "2"}});
+    adios2::Engine lazy = lazyIO.Open(fname, adios2::Mode::Read);
+
+    EXPECT_EQ(lazy.Steps(), NSteps);
+    CompareLazyMetadata<double>(eagerIO, eager, lazyIO, lazy, "r64",
+                                NSteps);
+    CompareLazyMetadata<int32_t>(eagerIO, eager, lazyIO, lazy, "odd",
+                                 NSteps);
+    CompareLazyMetadata<uint64_t>(eagerIO, eager, lazyIO, lazy, "step",
+                                  NSteps);
+    CompareLazyMetadata<int32_t>(eagerIO, eager, lazyIO, lazy, "rank",
+                                 NSteps);
+
+    auto var_r64 = lazyIO.InquireVariable<double>("r64");
+    EXPECT_EQ(var_r64.Shape(), adios2::Dims({NSteps, Nx * mpiSize}));
+    EXPECT_EQ(var_r64.Min(), 0.0);
+    EXPECT_EQ(var_r64.Max(),
+              static_cast<double>((NSteps - 1) * 1000 + (mpiSize - 1) * 100 +
+                                  NSteps * Nx - 1));
+    auto var_rank = lazyIO.InquireVariable<int32_t>("rank");
+    EXPECT_EQ(var_rank.Shape(), adios2::Dims({static_cast<size_t>(mpiSize)}));
+    EXPECT_EQ(var_rank.Max(), mpiSize - 1);
+
+    // the data is read as without LazyMetadata
+    var_r64.SetStepSelection({2, 1});
+    var_r64.SetSelection({{1, Nx * mpiRank}, {2, Nx}});
+    std::vector<double> r64;
+    lazy.Get(var_r64, r64, adios2::Mode::Sync);
+    ASSERT_EQ(r64.size(), 2 * Nx);
+    for (size_t i = 0; i < r64.size(); ++i)
+    {
+        EXPECT_EQ(r64[i],
+                  static_cast<double>(2 * 1000 + mpiRank * 100 + Nx + i));
+    }
+
+    auto var_name = lazyIO.InquireVariable<std::string>("name");
+    ASSERT_TRUE(var_name);
+    EXPECT_EQ(var_name.Steps(), NSteps);
+    var_name.SetStepSelection({3, 1});
+    std::string name;
+    lazy.Get(var_name, name, adios2::Mode::Sync);
+    EXPECT_EQ(name, "step3");
+
+    lazy.Close();
+    eager.Close();
+}
+
 //******************************************************************************
 // main
 //******************************************************************************
@@ -1514,6 +1514,149 @@ TEST_F(BPWriteReadSpan, BPWriteRead1D8FillValue)
     }
 }
 
+TEST_F(BPWriteReadSpan, BP5WriteReadSpanBlocks)
+{
+    // BP5 places spans in the step's data buffer among copied blocks, with
+    // both buffer types and with blocks larger than a chunk
+    int mpiRank = 0, mpiSize = 1;
+    // Number of elements of the global array blocks, more than a chunk
+    const size_t Nx = 1000;
+    // Number of elements of the local array block
+    const size_t Nl = 8;
+
+    // Number of steps
+    const size_t NSteps = 3;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    for (const std::string bufferVType : {"malloc", "chunk"})
+    {
+        const std::string fname("BP5WriteReadSpanBlocks_" + bufferVType +
+                                ".bp");
+        // every rank writes 3 blocks: a span, a copied block and a span left
+        // at its fill value
+        const auto lf_Value = [&](const size_t step, const size_t i) {
+            return static_cast<double>(step * 100000 + mpiRank * 3 * Nx + i);
+        };
+        const auto lf_FillValue = [](const size_t step) {
+            return static_cast<double>(step) + 0.5;
+        };
+
+        {
+            adios2::IO io = adios.DeclareIO("WriteIO_" + bufferVType);
+            io.SetEngine("BP5");
+            io.SetParameters({{"BufferVType", bufferVType},
+                              {"BufferChunkSize", "4096"}});
+
+            const adios2::Dims shape{static_cast<size_t>(3 * Nx * mpiSize)};
+            auto var_r64 = io.DefineVariable<double>("r64", shape, {0}, {Nx});
+            auto var_i32 = io.DefineVariable<int32_t>("i32", {}, {}, {Nl});
+
+            adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+            std::vector<double> copied(Nx);
+            for (size_t step = 0; step < NSteps; ++step)
+            {
+                bpWriter.BeginStep();
+                const size_t rankStart = 3 * Nx * mpiRank;
+
+                var_r64.SetSelection({{rankStart}, {Nx}});
+                adios2::Variable<double>::Span r64Span = bpWriter.Put(var_r64);
+
+                for (size_t i = 0; i < Nx; ++i)
+                {
+                    copied[i] = lf_Value(step, Nx + i);
+                }
+                var_r64.SetSelection({{rankStart + Nx}, {Nx}});
+                bpWriter.Put(var_r64, copied.data(), adios2::Mode::Sync);
+
+                var_r64.SetSelection({{rankStart + 2 * Nx}, {Nx}});
+                bpWriter.Put(var_r64, 0, lf_FillValue(step));
+
+                adios2::Variable<int32_t>::Span i32Span =
+                    bpWriter.Put(var_i32, 0, static_cast<int32_t>(-1));
+                EXPECT_EQ(i32Span.size(), Nl);
+                EXPECT_EQ(i32Span[Nl - 1], -1);
+
+                // produced in place after the later puts
+                for (size_t i = 0; i < Nx; ++i)
+                {
+                    r64Span[i] = lf_Value(step, i);
+                }
+                for (size_t i = 0; i < Nl; ++i)
+                {
+                    i32Span.at(i) = static_cast<int32_t>(step * 100 + i);
+                }
+                bpWriter.EndStep();
+            }
+            bpWriter.Close();
+        }
+
+        {
+            adios2::IO io = adios.DeclareIO("ReadIO_" + bufferVType);
+            io.SetEngine("BP5");
+            adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+            std::vector<double> r64;
+            std::vector<int32_t> i32;
+            size_t t = 0;
+            while (bpReader.BeginStep() == adios2::StepStatus::OK)
+            {
+                const size_t step = bpReader.CurrentStep();
+                auto var_r64 = io.InquireVariable<double>("r64");
+                auto var_i32 = io.InquireVariable<int32_t>("i32");
+                ASSERT_TRUE(var_r64);
+                ASSERT_TRUE(var_i32);
+
+                const size_t rankStart = 3 * Nx * mpiRank;
+                var_r64.SetSelection({{rankStart}, {3 * Nx}});
+                var_i32.SetBlockSelection(mpiRank);
+                bpReader.Get(var_r64, r64);
+                bpReader.Get(var_i32, i32);
+
+                const auto blocks = bpReader.BlocksInfo(var_r64, step);
+                ASSERT_EQ(blocks.size(), 3 * static_cast<size_t>(mpiSize));
+                bpReader.EndStep();
+
+                for (size_t i = 0; i < 2 * Nx; ++i)
+                {
+                    ASSERT_EQ(r64[i], lf_Value(step, i))
+                        << bufferVType << " t=" << t << " i=" << i;
+                }
+                for (size_t i = 2 * Nx; i < 3 * Nx; ++i)
+                {
+                    ASSERT_EQ(r64[i], lf_FillValue(step))
+                        << bufferVType << " t=" << t << " i=" << i;
+                }
+                ASSERT_EQ(i32.size(), Nl);
+                for (size_t i = 0; i < Nl; ++i)
+                {
+                    ASSERT_EQ(i32[i], static_cast<int32_t>(step * 100 + i));
+                }
+
+                // statistics of spans are taken from the data at EndStep
+                const size_t b = 3 * mpiRank;
+                EXPECT_EQ(blocks[b].Min, lf_Value(step, 0));
+                EXPECT_EQ(blocks[b].Max, lf_Value(step, Nx - 1));
+                EXPECT_EQ(blocks[b + 1].Min, lf_Value(step, Nx));
+                EXPECT_EQ(blocks[b + 2].Min, lf_FillValue(step));
+                EXPECT_EQ(blocks[b + 2].Max, lf_FillValue(step));
+                ++t;
+            }
+            EXPECT_EQ(t, NSteps);
+            bpReader.Close();
+        }
+    }
+}
+
 int main(int argc, char **argv)
 {
 #if ADIOS2_USE_MPI
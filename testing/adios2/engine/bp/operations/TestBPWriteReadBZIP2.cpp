@@ -878,6 +878,156 @@ TEST_P(BPWriteReadBZIP2, ADIOS2BPWriteReadBZIP23DSel)
     BZIP2Accuracy3DSel(GetParam());
 }
 
+// BP5 operates blocks on put (sync) or at EndStep (deferred) on several
+// threads, writers put several interleaved blocks of a variable per step
+TEST(BPWriteReadBZIP2BP5, ADIOS2BP5WriteReadBZIP2Blocks)
+{
+    const std::string fname("BPWR_BZIP2_BP5_Blocks.bp");
+
+    int mpiRank = 0, mpiSize = 1;
+    const size_t Nx = 10;
+    const size_t Ny = 50;
+    const size_t NBlocks = 3;
+    const size_t NSteps = 2;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+    const size_t Columns = static_cast<size_t>(mpiSize) * NBlocks * Ny;
+
+    auto lf_Value = [&](const size_t step, const size_t i, const size_t j) {
+        return static_cast<double>(step * 100000 + i * Columns + j);
+    };
+
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("TestIO");
+        io.SetEngine("BP5");
+        io.SetParameter("Threads", "4");
+
+        auto var_r32 = io.DefineVariable<float>("r32", {Nx, Columns},
+                                                {0, 0}, {Nx, Ny});
+        auto var_r64 = io.DefineVariable<double>("r64", {Nx, Columns},
+                                                 {0, 0}, {Nx, Ny});
+        auto var_local = io.DefineVariable<int32_t>("local", {}, {}, {Nx * Ny});
+
+        adios2::Operator BZIP2Op =
+            adios.DefineOperator("BZIP2Compressor", adios2::ops::LosslessBZIP2);
+        var_r32.AddOperation(BZIP2Op, {});
+        var_r64.AddOperation(
+            BZIP2Op, {{adios2::ops::bzip2::key::blockSize100k, "9"}});
+        var_local.AddOperation(BZIP2Op, {});
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        std::vector<std::vector<float>> r32s(NBlocks);
+        std::vector<std::vector<double>> r64s(NBlocks);
+        std::vector<std::vector<int32_t>> locals(NBlocks);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            bpWriter.BeginStep();
+            for (size_t b = 0; b < NBlocks; ++b)
+            {
+                const size_t column = (mpiRank * NBlocks + b) * Ny;
+                r32s[b].resize(Nx * Ny);
+                r64s[b].resize(Nx * Ny);
+                locals[b].assign(Nx * Ny, static_cast<int32_t>(
+                                         step * 1000 + mpiRank * NBlocks + b));
+                for (size_t i = 0; i < Nx; ++i)
+                {
+                    for (size_t j = 0; j < Ny; ++j)
+                    {
+                        r64s[b][i * Ny + j] = lf_Value(step, i, column + j);
+                        r32s[b][i * Ny + j] =
+                            static_cast<float>(r64s[b][i * Ny + j]);
+                    }
+                }
+                var_r32.SetSelection({{0, column}, {Nx, Ny}});
+                var_r64.SetSelection({{0, column}, {Nx, Ny}});
+                // the first block is operated right away
+                const adios2::Mode mode =
+                    (b == 0) ? adios2::Mode::Sync : adios2::Mode::Deferred;
+                bpWriter.Put(var_r32, r32s[b].data(), mode);
+                bpWriter.Put(var_r64, r64s[b].data(), mode);
+                bpWriter.Put(var_local, locals[b].data(), mode);
+            }
+            bpWriter.EndStep();
+        }
+        bpWriter.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+        io.SetEngine("BP5");
+        io.SetParameter("Threads", "4");
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        size_t step = 0;
+        while (bpReader.BeginStep() == adios2::StepStatus::OK)
+        {
+            auto var_r32 = io.InquireVariable<float>("r32");
+            auto var_r64 = io.InquireVariable<double>("r64");
+            auto var_local = io.InquireVariable<int32_t>("local");
+            ASSERT_TRUE(var_r32);
+            ASSERT_TRUE(var_r64);
+            ASSERT_TRUE(var_local);
+
+            // every block of every writer
+            std::vector<float> r32s;
+            std::vector<double> r64s;
+            var_r32.SetSelection({{0, 0}, {Nx, Columns}});
+            var_r64.SetSelection({{0, 0}, {Nx, Columns}});
+            bpReader.Get(var_r32, r32s);
+            bpReader.Get(var_r64, r64s);
+
+            // part of two blocks
+            std::vector<double> part;
+            var_r64.SetSelection({{2, Ny / 2}, {Nx - 4, Ny}});
+            bpReader.Get(var_r64, part);
+
+            // a single block of the local array
+            const size_t blockID = mpiRank * NBlocks + NBlocks - 1;
+            std::vector<int32_t> local;
+            var_local.SetBlockSelection(blockID);
+            bpReader.Get(var_local, local);
+            bpReader.EndStep();
+
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                for (size_t j = 0; j < Columns; ++j)
+                {
+                    ASSERT_EQ(r64s[i * Columns + j], lf_Value(step, i, j))
+                        << "step " << step << " i " << i << " j " << j;
+                    ASSERT_EQ(r32s[i * Columns + j],
+                              static_cast<float>(lf_Value(step, i, j)))
+                        << "step " << step << " i " << i << " j " << j;
+                }
+            }
+            for (size_t i = 0; i < Nx - 4; ++i)
+            {
+                for (size_t j = 0; j < Ny; ++j)
+                {
+                    ASSERT_EQ(part[i * Ny + j],
+                              lf_Value(step, i + 2, j + Ny / 2));
+                }
+            }
+            ASSERT_EQ(local.size(), Nx * Ny);
+            for (const int32_t value : local)
+            {
+                ASSERT_EQ(value, static_cast<int32_t>(step * 1000 + blockID));
+            }
+            ++step;
+        }
+        ASSERT_EQ(step, NSteps);
+        bpReader.Close();
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     BZIP2Accuracy, BPWriteReadBZIP2,
     ::testing::Values(adios2::ops::bzip2::value::blockSize100k_1,
@@ -290,6 +290,47 @@ TEST_F(DataManEngineTest, 1D)
     w.join();
     r.join();
 }
+
+TEST_F(DataManEngineTest, 1DBinaryMetadata)
+{
+    // set parameters
+    Dims shape = {10};
+    Dims start = {0};
+    Dims count = {10};
+    size_t steps = 1000;
+    adios2::Params engineParams = {{"IPAddress", "127.0.0.1"},
+                                   {"Port", "12302"},
+                                   {"SerializationMethod", "binary"}};
+
+    // run workflow
+    auto r =
+        std::thread(DataManReader, shape, start, count, steps, engineParams);
+    auto w =
+        std::thread(DataManWriter, shape, start, count, steps, engineParams);
+    w.join();
+    r.join();
+}
+
+TEST_F(DataManEngineTest, 1DBinaryMetadataDelta)
+{
+    // set parameters
+    Dims shape = {10};
+    Dims start = {0};
+    Dims count = {10};
+    size_t steps = 1000;
+    adios2::Params engineParams = {{"IPAddress", "127.0.0.1"},
+                                   {"Port", "12304"},
+                                   {"SerializationMethod", "binary"},
+                                   {"FullMetadataInterval", "10"}};
+
+    // run workflow
+    auto r =
+        std::thread(DataManReader, shape, start, count, steps, engineParams);
+    auto w =
+        std::thread(DataManWriter, shape, start, count, steps, engineParams);
+    w.join();
+    r.join();
+}
 #endif // ZEROMQ
 
 int main(int argc, char **argv)
@@ -6,9 +6,11 @@
 #include <cstdint>
 #include <cstring>
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <stdexcept>
+#include <type_traits>
 
 #include <adios2.h>
 #include <adios2/common/ADIOSTypes.h>
@@ -1170,6 +1172,134 @@ TEST(ADIOS2MinMaxs, ADIOS2MinMaxs_4D_3x2x5x4)
     }
 }
 
+template <typename T>
+void assert_getminmax(const size_t seed)
+{
+    // all sizes around the vector widths plus a few long arrays, starting at
+    // unaligned offsets, checked against std::minmax_element
+    std::vector<size_t> sizes;
+    for (size_t n = 1; n <= 300; ++n)
+    {
+        sizes.push_back(n);
+    }
+    sizes.push_back(1000);
+    sizes.push_back(4099);
+
+    std::vector<T> data(4099 + 3);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        // spread values over the whole range of T including negatives
+        const uint64_t r = (i + seed) * 6364136223846793005ULL +
+                           1442695040888963407ULL;
+        if (std::is_floating_point<T>::value)
+        {
+            data[i] = static_cast<T>(static_cast<int64_t>(r) / 1e6);
+        }
+        else
+        {
+            data[i] = static_cast<T>(r >> 17);
+        }
+    }
+
+    for (const size_t n : sizes)
+    {
+        for (size_t offset = 0; offset < 3; ++offset)
+        {
+            const T *values = data.data() + offset;
+            T min, max;
+            adios2::helper::GetMinMax(values, n, min, max);
+            auto bounds = std::minmax_element(values, values + n);
+            ASSERT_EQ(min, *bounds.first) << "size " << n << " offset "
+                                          << offset;
+            ASSERT_EQ(max, *bounds.second) << "size " << n << " offset "
+                                           << offset;
+
+            std::vector<T> copy(n + offset);
+            adios2::helper::CopyGetMinMax(copy.data() + offset, values, n, min,
+                                          max);
+            ASSERT_EQ(min, *bounds.first);
+            ASSERT_EQ(max, *bounds.second);
+            ASSERT_TRUE(std::equal(values, values + n, copy.data() + offset));
+        }
+    }
+}
+
+TEST(ADIOS2MinMaxs, ADIOS2MinMaxs_GetMinMax_Types)
+{
+    assert_getminmax<int8_t>(1);
+    assert_getminmax<int16_t>(2);
+    assert_getminmax<int32_t>(3);
+    assert_getminmax<int64_t>(4);
+    assert_getminmax<uint8_t>(5);
+    assert_getminmax<uint16_t>(6);
+    assert_getminmax<uint32_t>(7);
+    assert_getminmax<uint64_t>(8);
+    assert_getminmax<float>(9);
+    assert_getminmax<double>(10);
+}
+
+TEST(ADIOS2MinMaxs, ADIOS2MinMaxs_GetMinMax_Extremes)
+{
+    std::vector<int64_t> i64(67, 0);
+    i64[3] = std::numeric_limits<int64_t>::min();
+    i64[64] = std::numeric_limits<int64_t>::max();
+    int64_t imin, imax;
+    adios2::helper::GetMinMax(i64.data(), i64.size(), imin, imax);
+    ASSERT_EQ(imin, std::numeric_limits<int64_t>::min());
+    ASSERT_EQ(imax, std::numeric_limits<int64_t>::max());
+
+    std::vector<uint64_t> u64(67, 1ULL << 63);
+    u64[5] = 0;
+    u64[40] = std::numeric_limits<uint64_t>::max();
+    uint64_t umin, umax;
+    adios2::helper::GetMinMax(u64.data(), u64.size(), umin, umax);
+    ASSERT_EQ(umin, 0U);
+    ASSERT_EQ(umax, std::numeric_limits<uint64_t>::max());
+
+    // NaN values are skipped
+    std::vector<double> f64(100, 1.0);
+    f64[10] = std::nan("");
+    f64[50] = -2.5;
+    f64[99] = 4.0;
+    double dmin, dmax;
+    adios2::helper::GetMinMax(f64.data(), f64.size(), dmin, dmax);
+    ASSERT_EQ(dmin, -2.5);
+    ASSERT_EQ(dmax, 4.0);
+}
+
+TEST(ADIOS2MinMaxs, ADIOS2MinMaxs_CopyGetMinMaxSubblocks)
+{
+    const adios2::Dims count = {24, 24, 48};
+    const size_t nElems = adios2::helper::GetTotalSize(count);
+    std::vector<double> data(nElems);
+    for (size_t i = 0; i < nElems; ++i)
+    {
+        data[i] = static_cast<double>((i * 7919) % 10007) - 5000.0;
+    }
+
+    for (const size_t blockSize : {nElems, size_t(1000)})
+    {
+        const adios2::helper::BlockDivisionInfo info =
+            adios2::helper::DivideBlock(
+                count, blockSize,
+                adios2::helper::BlockDivisionMethod::Contiguous);
+
+        std::vector<double> expectedMinMaxs, minMaxs;
+        double expectedMin, expectedMax, min, max;
+        adios2::helper::GetMinMaxSubblocks(data.data(), count, info,
+                                           expectedMinMaxs, expectedMin,
+                                           expectedMax, 1);
+
+        std::vector<double> copy(nElems);
+        adios2::helper::CopyGetMinMaxSubblocks(copy.data(), data.data(), count,
+                                               info, minMaxs, min, max, 1);
+        ASSERT_EQ(copy, data);
+        ASSERT_EQ(min, expectedMin);
+        ASSERT_EQ(max, expectedMax);
+        ASSERT_EQ(minMaxs, expectedMinMaxs);
+    }
+}
+
 int main(int argc, char **argv)
 {
 
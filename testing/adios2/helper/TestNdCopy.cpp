@@ -0,0 +1,230 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <adios2/helper/adiosMemory.h>
+#include <adios2/helper/adiosThreadPool.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+adios2::helper::ThreadPool &Pool()
+{
+    static adios2::helper::ThreadPool pool(4);
+    return pool;
+}
+
+template <class T>
+std::vector<T> Sequence(const size_t size)
+{
+    std::vector<T> values(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        values[i] = static_cast<T>(i * 7 + 1);
+    }
+    return values;
+}
+
+template <class T>
+T Reversed(T value)
+{
+    char *bytes = reinterpret_cast<char *>(&value);
+    std::reverse(bytes, bytes + sizeof(T));
+    return value;
+}
+
+/** copies a row major block into a larger row major selection and checks it
+ * element by element */
+template <class T>
+void CheckRowMajor(const bool revEndian, const unsigned int threads,
+                   adios2::helper::ThreadPool *pool)
+{
+    const adios2::Dims inStart = {10, 20, 30};
+    const adios2::Dims inCount = {48, 96, 80};
+    const adios2::Dims outStart = {0, 0, 0};
+    const adios2::Dims outCount = {64, 128, 128};
+    const std::vector<T> in = Sequence<T>(48 * 96 * 80);
+    std::vector<T> out(64 * 128 * 128, T());
+
+    adios2::helper::NdCopy<T>(reinterpret_cast<const char *>(in.data()),
+                              inStart, inCount, true, true,
+                              reinterpret_cast<char *>(out.data()), outStart,
+                              outCount, true, !revEndian, adios2::Dims(),
+                              adios2::Dims(), adios2::Dims(), adios2::Dims(),
+                              false, threads, pool);
+
+    for (size_t i = 0; i < inCount[0]; ++i)
+    {
+        for (size_t j = 0; j < inCount[1]; ++j)
+        {
+            for (size_t k = 0; k < inCount[2]; ++k)
+            {
+                const T expected =
+                    in[(i * inCount[1] + j) * inCount[2] + k];
+                const T actual =
+                    out[((i + 10) * outCount[1] + j + 20) * outCount[2] + k +
+                        30];
+                ASSERT_EQ(revEndian ? Reversed(actual) : actual, expected)
+                    << i << " " << j << " " << k;
+            }
+        }
+    }
+    EXPECT_EQ(out[0], T());
+    EXPECT_EQ(out.back(), T());
+}
+
+} // end anonymous namespace
+
+TEST(ADIOS2NdCopy, RowMajorParallel)
+{
+    CheckRowMajor<double>(false, 4, &Pool());
+    CheckRowMajor<int32_t>(false, 3, &Pool());
+}
+
+TEST(ADIOS2NdCopy, RowMajorRevEndian)
+{
+    CheckRowMajor<int16_t>(true, 1, nullptr);
+    CheckRowMajor<int16_t>(true, 4, &Pool());
+    CheckRowMajor<float>(true, 4, &Pool());
+    CheckRowMajor<uint64_t>(true, 4, &Pool());
+}
+
+TEST(ADIOS2NdCopy, RevEndianComplex)
+{
+    const size_t elements = 1000;
+    std::vector<std::complex<double>> in(elements);
+    for (size_t i = 0; i < elements; ++i)
+    {
+        in[i] = std::complex<double>(static_cast<double>(i), -1.0 / (i + 1));
+    }
+    std::vector<std::complex<double>> out(elements);
+    adios2::helper::NdCopy<std::complex<double>>(
+        reinterpret_cast<const char *>(in.data()), {0}, {elements}, true,
+        true, reinterpret_cast<char *>(out.data()), {0}, {elements}, true,
+        false);
+
+    // the whole element is reversed, as it was before specializing on size
+    for (size_t i = 0; i < elements; ++i)
+    {
+        std::complex<double> expected = in[i];
+        char *bytes = reinterpret_cast<char *>(&expected);
+        std::reverse(bytes, bytes + sizeof(expected));
+        ASSERT_EQ(std::memcmp(&out[i], &expected, sizeof(expected)), 0) << i;
+    }
+}
+
+TEST(ADIOS2NdCopy, ContiguousStreaming)
+{
+    // a single contiguous run above the streaming threshold, to an
+    // unaligned destination
+    const size_t bytes =
+        adios2::helper::NdCopyStreamingBytes + 4 * 1024 + 13;
+    const std::vector<char> in = Sequence<char>(bytes);
+    std::vector<char> out(bytes + 3, 0);
+
+    for (auto pool : {static_cast<adios2::helper::ThreadPool *>(nullptr),
+                      &Pool()})
+    {
+        std::fill(out.begin(), out.end(), 0);
+        adios2::helper::NdCopy<char>(in.data(), {0}, {bytes}, true, true,
+                                     out.data() + 3, {0}, {bytes}, true, true,
+                                     adios2::Dims(), adios2::Dims(),
+                                     adios2::Dims(), adios2::Dims(), false, 4,
+                                     pool);
+        EXPECT_EQ(std::memcmp(out.data() + 3, in.data(), bytes), 0);
+        EXPECT_EQ(out[0] | out[1] | out[2], 0);
+    }
+}
+
+TEST(ADIOS2NdCopy, CopyStreaming)
+{
+    const std::vector<char> in = Sequence<char>(1000);
+    for (size_t offset = 0; offset < 17; ++offset)
+    {
+        for (size_t bytes : {0, 1, 15, 16, 63, 64, 65, 200, 977})
+        {
+            std::vector<char> out(1100, 0);
+            adios2::helper::CopyStreaming(out.data() + offset,
+                                          in.data() + 1, bytes);
+            adios2::helper::StreamingFence();
+            ASSERT_EQ(std::memcmp(out.data() + offset, in.data() + 1, bytes),
+                      0)
+                << offset << " " << bytes;
+            ASSERT_EQ(out[offset + bytes], 0) << offset << " " << bytes;
+        }
+    }
+}
+
+TEST(ADIOS2NdCopy, ColumnMajorParallel)
+{
+    // the serial copy is the reference
+    const adios2::Dims inStart = {5, 6, 7};
+    const adios2::Dims inCount = {70, 60, 50};
+    const adios2::Dims outStart = {0, 0, 0};
+    const adios2::Dims outCount = {80, 64, 64};
+    const std::vector<double> in = Sequence<double>(70 * 60 * 50);
+
+    for (const bool outIsRowMajor : {false, true})
+    {
+        for (const bool revEndian : {false, true})
+        {
+            std::vector<double> serial(80 * 64 * 64, 0);
+            std::vector<double> parallel(80 * 64 * 64, 0);
+            adios2::helper::NdCopy<double>(
+                reinterpret_cast<const char *>(in.data()), inStart, inCount,
+                false, true, reinterpret_cast<char *>(serial.data()),
+                outStart, outCount, outIsRowMajor, !revEndian);
+            adios2::helper::NdCopy<double>(
+                reinterpret_cast<const char *>(in.data()), inStart, inCount,
+                false, true, reinterpret_cast<char *>(parallel.data()),
+                outStart, outCount, outIsRowMajor, !revEndian, adios2::Dims(),
+                adios2::Dims(), adios2::Dims(), adios2::Dims(), false, 4,
+                &Pool());
+            EXPECT_EQ(serial, parallel) << outIsRowMajor << " " << revEndian;
+        }
+    }
+}
+
+TEST(ADIOS2NdCopy, CopyMemoryBlockParallel)
+{
+    // a block in the middle of user memory, as written with a memory
+    // selection
+    const adios2::Dims start = {0, 0};
+    const adios2::Dims count = {1000, 300};
+    const adios2::Dims memStart = {2, 4};
+    const adios2::Dims memCount = {1004, 310};
+    const std::vector<float> memory = Sequence<float>(1004 * 310);
+    std::vector<float> block(1000 * 300);
+
+    adios2::helper::CopyMemoryBlock(block.data(), start, count, true,
+                                    memory.data(), start, count, true, false,
+                                    adios2::Dims(), adios2::Dims(), memStart,
+                                    memCount, 4, &Pool());
+    for (size_t i = 0; i < count[0]; ++i)
+    {
+        for (size_t j = 0; j < count[1]; ++j)
+        {
+            ASSERT_EQ(block[i * count[1] + j],
+                      memory[(i + 2) * memCount[1] + j + 4])
+                << i << " " << j;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+    return result;
+}
@@ -0,0 +1,151 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <adios2/helper/adiosMath.h>
+#include <adios2/helper/adiosMemory.h>
+#include <adios2/helper/adiosThreadPool.h>
+
+#include <gtest/gtest.h>
+
+TEST(ADIOS2ThreadPool, EveryIterationOnce)
+{
+    adios2::helper::ThreadPool pool(4);
+    const size_t count = 10000;
+    std::vector<std::atomic<int>> calls(count);
+    for (auto &c : calls)
+    {
+        c = 0;
+    }
+
+    pool.ParallelFor(count, 8, [&](const size_t i) { ++calls[i]; });
+    for (size_t i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(calls[i], 1) << "iteration " << i;
+    }
+    EXPECT_LE(pool.Workers(), 4);
+
+    // empty loops return without starting anything
+    pool.ParallelFor(0, 8, [&](const size_t) { FAIL(); });
+}
+
+TEST(ADIOS2ThreadPool, SerialInCaller)
+{
+    adios2::helper::ThreadPool pool(4);
+    const std::thread::id caller = std::this_thread::get_id();
+    std::vector<size_t> order;
+    pool.ParallelFor(100, 1, [&](const size_t i) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        order.push_back(i);
+    });
+    ASSERT_EQ(order.size(), 100);
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        EXPECT_EQ(order[i], i);
+    }
+    EXPECT_EQ(pool.Workers(), 0);
+}
+
+TEST(ADIOS2ThreadPool, ThreadsBound)
+{
+    adios2::helper::ThreadPool pool(8);
+    std::mutex mutex;
+    std::set<std::thread::id> ids;
+    pool.ParallelFor(1000, 3, [&](const size_t) {
+        std::this_thread::sleep_for(std::chrono::microseconds(10));
+        std::lock_guard<std::mutex> lock(mutex);
+        ids.insert(std::this_thread::get_id());
+    });
+    EXPECT_LE(ids.size(), 3);
+    EXPECT_EQ(pool.Workers(), 2);
+}
+
+TEST(ADIOS2ThreadPool, Exception)
+{
+    adios2::helper::ThreadPool pool(4);
+    EXPECT_THROW(pool.ParallelFor(1000, 4,
+                                  [&](const size_t i) {
+                                      if (i == 10)
+                                      {
+                                          throw std::runtime_error("task");
+                                      }
+                                  }),
+                 std::runtime_error);
+
+    // the pool is still usable
+    std::atomic<size_t> sum(0);
+    pool.ParallelFor(100, 4, [&](const size_t i) { sum += i; });
+    EXPECT_EQ(sum, 4950);
+}
+
+TEST(ADIOS2ThreadPool, NestedAndConcurrent)
+{
+    adios2::helper::ThreadPool pool(3);
+    std::atomic<size_t> sum(0);
+    auto lf_Caller = [&]() {
+        pool.ParallelFor(16, 4, [&](const size_t) {
+            pool.ParallelFor(64, 4, [&](const size_t j) { sum += j; });
+        });
+    };
+
+    std::thread other(lf_Caller);
+    lf_Caller();
+    other.join();
+    EXPECT_EQ(sum, 2 * 16 * 2016);
+}
+
+TEST(ADIOS2ThreadPool, Helpers)
+{
+    adios2::helper::ThreadPool pool;
+    const size_t elements = 3000001;
+    std::vector<int64_t> data(elements);
+    for (size_t i = 0; i < elements; ++i)
+    {
+        data[i] = static_cast<int64_t>((i * 2654435761U) % 1000003) - 500000;
+    }
+    data[elements - 1] = -600000;
+    data[elements / 3] = 600000;
+
+    int64_t min, max;
+    adios2::helper::GetMinMaxThreads(data.data(), elements, min, max, 4,
+                                     &pool);
+    EXPECT_EQ(min, -600000);
+    EXPECT_EQ(max, 600000);
+
+    std::vector<int64_t> copy(elements);
+    adios2::helper::CopyGetMinMaxThreads(copy.data(), data.data(), elements,
+                                         min, max, 4, &pool);
+    EXPECT_EQ(min, -600000);
+    EXPECT_EQ(max, 600000);
+    EXPECT_EQ(copy, data);
+
+    std::vector<char> buffer(elements * sizeof(int64_t) + 8);
+    size_t position = 8;
+    adios2::helper::CopyToBufferThreads(buffer, position, data.data(),
+                                        elements, 4, &pool);
+    EXPECT_EQ(position, buffer.size());
+    EXPECT_EQ(std::memcmp(buffer.data() + 8, data.data(),
+                          elements * sizeof(int64_t)),
+              0);
+}
+
+int main(int argc, char **argv)
+{
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+    return result;
+}
@@ -0,0 +1,149 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * PerfBP5ManyVars.cpp measures the per-variable cost of writing and reading
+ * steps with many small variables in BP5 and BP4, where looking up the
+ * variable records rather than moving the data dominates. The first step also
+ * creates the records and the metadata format, so it is reported apart from
+ * the following ones. Times are microseconds per variable and step.
+ *
+ * Usage: PerfBP5ManyVars [variables per step (default 10000)]
+ *                        [steps (default 10)]
+ */
+#include <cstdlib>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <adios2.h>
+
+namespace
+{
+
+size_t Variables = 10000;
+size_t Steps = 10;
+const size_t Elements = 4;
+
+using Clock = std::chrono::steady_clock;
+
+double Microseconds(const Clock::duration d)
+{
+    return std::chrono::duration<double, std::micro>(d).count();
+}
+
+void Run(adios2::ADIOS &adios, const std::string &engine)
+{
+    const std::string fname = "PerfBP5ManyVars_" + engine + ".bp";
+    std::vector<std::string> names(Variables);
+    for (size_t v = 0; v < Variables; ++v)
+    {
+        names[v] = "variable_" + std::to_string(v);
+    }
+    std::vector<double> data(Elements);
+
+    Clock::duration firstPut(0), firstEndStep(0), put(0), endStep(0), get(0);
+    {
+        adios2::IO io = adios.DeclareIO("Write" + engine);
+        io.SetEngine(engine);
+        std::vector<adios2::Variable<double>> vars(Variables);
+        for (size_t v = 0; v < Variables; ++v)
+        {
+            vars[v] = io.DefineVariable<double>(names[v], {Elements}, {0},
+                                                {Elements});
+        }
+
+        adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+        for (size_t step = 0; step < Steps; ++step)
+        {
+            for (size_t i = 0; i < Elements; ++i)
+            {
+                data[i] = static_cast<double>(step * Elements + i);
+            }
+            writer.BeginStep();
+            const auto t0 = Clock::now();
+            for (size_t v = 0; v < Variables; ++v)
+            {
+                writer.Put(vars[v], data.data(), adios2::Mode::Sync);
+            }
+            const auto t1 = Clock::now();
+            writer.EndStep();
+            const auto t2 = Clock::now();
+            (step == 0 ? firstPut : put) += t1 - t0;
+            (step == 0 ? firstEndStep : endStep) += t2 - t1;
+        }
+        writer.Close();
+    }
+
+    bool ok = true;
+    {
+        adios2::IO io = adios.DeclareIO("Read" + engine);
+        io.SetEngine(engine);
+        adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+        size_t step = 0;
+        while (reader.BeginStep() == adios2::StepStatus::OK)
+        {
+            const auto t0 = Clock::now();
+            for (size_t v = 0; v < Variables; ++v)
+            {
+                adios2::Variable<double> var =
+                    io.InquireVariable<double>(names[v]);
+                reader.Get(var, data.data());
+            }
+            reader.EndStep();
+            get += Clock::now() - t0;
+            ok = ok && (data[Elements - 1] ==
+                        static_cast<double>(step * Elements + Elements - 1));
+            ++step;
+        }
+        ok = ok && (step == Steps);
+        reader.Close();
+    }
+
+    const double perVar = 1.0 / static_cast<double>(Variables);
+    const double perNextVar =
+        Steps > 1 ? perVar / static_cast<double>(Steps - 1) : 0.0;
+    std::cout << std::setw(8) << engine << std::fixed << std::setprecision(3)
+              << std::setw(12) << Microseconds(firstPut) * perVar
+              << std::setw(12) << Microseconds(firstEndStep) * perVar
+              << std::setw(12) << Microseconds(put) * perNextVar
+              << std::setw(12) << Microseconds(endStep) * perNextVar
+              << std::setw(12)
+              << Microseconds(get) * perVar / static_cast<double>(Steps)
+              << (ok ? "" : "  MISMATCH") << std::endl;
+}
+
+} // end anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc > 1)
+    {
+        Variables = std::strtoull(argv[1], nullptr, 10);
+    }
+    if (argc > 2)
+    {
+        Steps = std::strtoull(argv[2], nullptr, 10);
+    }
+    if (Variables == 0 || Steps == 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [variables] [steps]"
+                  << std::endl;
+        return 1;
+    }
+
+    std::cout << Variables << " variables of " << Elements
+              << " doubles per step, " << Steps << " steps" << std::endl;
+    std::cout << std::setw(8) << "engine" << std::setw(12) << "first put"
+              << std::setw(12) << "first end" << std::setw(12) << "put"
+              << std::setw(12) << "end step" << std::setw(12) << "get"
+              << std::endl;
+
+    adios2::ADIOS adios;
+    Run(adios, "BP4");
+    Run(adios, "BP5");
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * PerfDataManMetadata.cpp compares the DataMan metadata serialization methods
+ * on steps with many small variables, where metadata rather than payload
+ * dominates the cost of a step. binary/delta sends the full binary metadata
+ * with the first step only and the changes relative to it afterwards, the
+ * metadata size reported being that of the last step
+ *
+ * Usage: PerfDataManMetadata [variables per step (default 10000)]
+ *                            [steps (default 20)]
+ */
+#include <cstdlib>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "adios2/helper/adiosCommDummy.h"
+#include "adios2/toolkit/format/dataman/DataManSerializer.h"
+#include "adios2/toolkit/format/dataman/DataManSerializer.tcc"
+
+namespace
+{
+
+size_t Variables = 10000;
+size_t Steps = 20;
+const size_t Elements = 16;
+
+void Run(const std::string &method, const size_t fullMetadataInterval = 0)
+{
+    adios2::helper::Comm comm = adios2::helper::CommDummy();
+    adios2::format::DataManSerializer writer(comm, true);
+    adios2::format::DataManSerializer reader(comm, true);
+    writer.SetSerializationMethod(method);
+    reader.SetSerializationMethod(method);
+    writer.SetFullMetadataInterval(fullMetadataInterval);
+
+    std::vector<std::string> names(Variables);
+    for (size_t v = 0; v < Variables; ++v)
+    {
+        names[v] = "variable_" + std::to_string(v);
+    }
+    std::vector<double> data(Elements);
+    const adios2::Dims shape = {Elements * 4};
+    const adios2::Dims start = {Elements};
+    const adios2::Dims count = {Elements};
+    const std::vector<adios2::core::VariableBase::Operation> ops;
+
+    std::chrono::duration<double> writeTime(0);
+    std::chrono::duration<double> readTime(0);
+    size_t metadataSize = 0;
+    bool ok = true;
+
+    for (size_t step = 0; step < Steps; ++step)
+    {
+        for (size_t i = 0; i < Elements; ++i)
+        {
+            data[i] = static_cast<double>(step * Elements + i);
+        }
+
+        auto t0 = std::chrono::steady_clock::now();
+        writer.NewWriterBuffer(Variables * Elements * sizeof(double) * 2);
+        for (size_t v = 0; v < Variables; ++v)
+        {
+            writer.PutData(data.data(), names[v], shape, start, count, {}, {},
+                           "", step, 0, "", ops);
+        }
+        auto pack = writer.GetLocalPack();
+        auto t1 = std::chrono::steady_clock::now();
+        reader.PutPack(pack, false);
+        auto vars = reader.GetFullMetadataMap()[step];
+        auto t2 = std::chrono::steady_clock::now();
+
+        writeTime += t1 - t0;
+        readTime += t2 - t1;
+        metadataSize = reinterpret_cast<const uint64_t *>(pack->data())[1];
+
+        if (vars == nullptr || vars->size() != Variables ||
+            vars->back().name != names.back() ||
+            vars->back().count != count)
+        {
+            ok = false;
+        }
+        reader.Erase(step);
+    }
+
+    const double usPerVar = 1e6 / static_cast<double>(Steps * Variables);
+    const std::string label =
+        fullMetadataInterval > 0 ? method + "/delta" : method;
+    std::cout << std::setw(14) << label << std::setw(14) << metadataSize
+              << std::fixed << std::setprecision(3) << std::setw(14)
+              << writeTime.count() * usPerVar << std::setw(14)
+              << readTime.count() * usPerVar << (ok ? "" : "  MISMATCH")
+              << std::endl;
+}
+
+} // end anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc > 1)
+    {
+        Variables = std::strtoull(argv[1], nullptr, 10);
+    }
+    if (argc > 2)
+    {
+        Steps = std::strtoull(argv[2], nullptr, 10);
+    }
+    if (Variables == 0 || Steps == 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [variables] [steps]"
+                  << std::endl;
+        return 1;
+    }
+
+    std::cout << Variables << " variables of " << Elements
+              << " doubles per step, " << Steps << " steps" << std::endl;
+    std::cout << std::setw(14) << "method" << std::setw(14) << "meta bytes"
+              << std::setw(14) << "put us/var" << std::setw(14)
+              << "get us/var" << std::endl;
+
+    for (const std::string method :
+         {"string", "msgpack", "cbor", "ubjson", "binary"})
+    {
+        Run(method);
+    }
+    Run("binary", Steps);
+    return 0;
+}
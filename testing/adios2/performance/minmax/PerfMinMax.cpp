@@ -0,0 +1,116 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * PerfMinMax.cpp compares helper::GetMinMax against std::minmax_element, the
+ * scalar single pass it replaced, for every type with a vectorized kernel
+ *
+ * Usage: PerfMinMax [elements per array (default 16M)] [repetitions (10)]
+ */
+#include <cstdint>
+#include <cstdlib>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "adios2/helper/adiosMath.h"
+
+namespace
+{
+
+size_t Elements = 16 * 1024 * 1024;
+size_t Repetitions = 10;
+
+/** best time in seconds out of Repetitions calls of f */
+template <class F>
+double BestTime(F f)
+{
+    double best = 1e30;
+    for (size_t r = 0; r < Repetitions; ++r)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto end = std::chrono::steady_clock::now();
+        const std::chrono::duration<double> elapsed = end - start;
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+template <class T>
+void Run(const std::string &name)
+{
+    std::vector<T> data(Elements);
+    for (size_t i = 0; i < Elements; ++i)
+    {
+        data[i] = static_cast<T>((i * 2654435761U) % 1000003);
+    }
+    const double gb = static_cast<double>(Elements * sizeof(T)) / 1e9;
+
+    T min1, max1, min2, max2, min3, max3;
+    const double tStd = BestTime([&]() {
+        auto bounds = std::minmax_element(data.begin(), data.end());
+        min1 = *bounds.first;
+        max1 = *bounds.second;
+    });
+    const double tSimd = BestTime([&]() {
+        adios2::helper::GetMinMax(data.data(), Elements, min2, max2);
+    });
+    const unsigned int threads =
+        std::max(1U, std::thread::hardware_concurrency());
+    static adios2::helper::ThreadPool pool;
+    const double tThreads = BestTime([&]() {
+        adios2::helper::GetMinMaxThreads(data.data(), Elements, min3, max3,
+                                         threads, &pool);
+    });
+
+    const bool ok = min1 == min2 && max1 == max2 && min1 == min3 &&
+                    max1 == max3;
+    std::cout << std::setw(10) << name << std::fixed << std::setprecision(2)
+              << std::setw(14) << gb / tStd << std::setw(14) << gb / tSimd
+              << std::setw(14) << gb / tThreads << std::setw(10)
+              << tStd / tSimd << (ok ? "" : "  MISMATCH") << std::endl;
+}
+
+} // end anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc > 1)
+    {
+        Elements = std::strtoull(argv[1], nullptr, 10);
+    }
+    if (argc > 2)
+    {
+        Repetitions = std::strtoull(argv[2], nullptr, 10);
+    }
+    if (Elements == 0 || Repetitions == 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [elements] [repetitions]"
+                  << std::endl;
+        return 1;
+    }
+
+    std::cout << Elements << " elements, best of " << Repetitions
+              << " runs, GB/s" << std::endl;
+    std::cout << std::setw(10) << "type" << std::setw(14) << "minmax_elem"
+              << std::setw(14) << "GetMinMax" << std::setw(14)
+              << "GetMinMaxThr" << std::setw(10) << "speedup" << std::endl;
+
+    Run<int8_t>("int8_t");
+    Run<int16_t>("int16_t");
+    Run<int32_t>("int32_t");
+    Run<int64_t>("int64_t");
+    Run<uint8_t>("uint8_t");
+    Run<uint16_t>("uint16_t");
+    Run<uint32_t>("uint32_t");
+    Run<uint64_t>("uint64_t");
+    Run<float>("float");
+    Run<double>("double");
+    return 0;
+}
@@ -7,6 +7,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <numeric> //std::iota
 #include <stdexcept>
 
@@ -100,10 +101,11 @@ void BPQueryTest::QueryIntVar(const std::string &fname, adios2::ADIOS &adios,
     std::string queryFile = "./" + ioName + "test.xml"; //"./test.xml";
     std::cout << ioName << std::endl;
     WriteXmlQuery1D(queryFile, ioName, "intV");
-    adios2::QueryWorker w = adios2::QueryWorker(queryFile, bpReader);
+    // BP5 defines the variables in BeginStep, the worker needs them
+    std::unique_ptr<adios2::QueryWorker> w;
 
     std::vector<size_t> rr;
-    if (engineName.compare("BP4") == 0)
+    if (engineName.compare("BP4") == 0 || engineName.compare("BP5") == 0)
         rr = {9, 9, 9};
     else
         rr = {1, 1, 1};
@@ -112,7 +114,11 @@ void BPQueryTest::QueryIntVar(const std::string &fname, adios2::ADIOS &adios,
     {
         std::vector<adios2::Box<adios2::Dims>> touched_blocks;
         adios2::Box<adios2::Dims> empty;
-        w.GetResultCoverage(empty, touched_blocks);
+        if (!w)
+        {
+            w.reset(new adios2::QueryWorker(queryFile, bpReader));
+        }
+        w->GetResultCoverage(empty, touched_blocks);
         ASSERT_EQ(touched_blocks.size(), rr[bpReader.CurrentStep()]);
         bpReader.EndStep();
     }
@@ -137,10 +143,10 @@ void BPQueryTest::QueryDoubleVar(const std::string &fname, adios2::ADIOS &adios,
     // std::string queryFile = "./.test.xml";
     std::string queryFile = "./" + ioName + "test.xml";
     WriteXmlQuery1D(queryFile, ioName, "doubleV");
-    adios2::QueryWorker w = adios2::QueryWorker(queryFile, bpReader);
+    std::unique_ptr<adios2::QueryWorker> w;
 
     std::vector<size_t> rr; //= {0,9,9};
-    if (engineName.compare("BP4") == 0)
+    if (engineName.compare("BP4") == 0 || engineName.compare("BP5") == 0)
         rr = {0, 9, 9};
     else
         rr = {0, 1, 1};
@@ -148,7 +154,11 @@ void BPQueryTest::QueryDoubleVar(const std::string &fname, adios2::ADIOS &adios,
     {
         std::vector<adios2::Box<adios2::Dims>> touched_blocks;
         adios2::Box<adios2::Dims> empty;
-        w.GetResultCoverage(empty, touched_blocks);
+        if (!w)
+        {
+            w.reset(new adios2::QueryWorker(queryFile, bpReader));
+        }
+        w->GetResultCoverage(empty, touched_blocks);
         ASSERT_EQ(touched_blocks.size(), rr[bpReader.CurrentStep()]);
         bpReader.EndStep();
     }
@@ -197,10 +207,10 @@ void BPQueryTest::WriteFile(const std::string &fname, adios2::ADIOS &adios,
 
         io.SetParameter("AsyncThreads", "0");
 
-        if (engineName.compare("BP4") == 0)
+        if (engineName.compare("BP4") == 0 || engineName.compare("BP5") == 0)
         {
-            io.SetParameters("statslevel=1");
-            io.SetParameters("statsblocksize=10");
+            io.SetParameters("StatsLevel=1");
+            io.SetParameters("StatsBlockSize=10");
         }
         io.AddTransport("file");
 
@@ -290,6 +300,28 @@ TEST_F(BPQueryTest, BP4)
     }
 }
 
+TEST_F(BPQueryTest, BP5)
+{
+    std::string engineName = "BP5";
+    // Each process would write a 1x8 array and all processes would
+    // form a mpiSize * Nx 1D array
+    const std::string fname(engineName + "Query1D.bp");
+
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+
+    WriteFile(fname, adios, engineName);
+
+    if (mpiSize == 1)
+    {
+        QueryDoubleVar(fname, adios, engineName);
+        QueryIntVar(fname, adios, engineName);
+    }
+}
+
 //******************************************************************************
 // main
 //******************************************************************************
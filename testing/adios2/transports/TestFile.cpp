@@ -127,6 +127,23 @@ INSTANTIATE_TEST_SUITE_P(
                       std::make_tuple("fstream", "false", "fstream", "false")));
 #endif
 
+#ifdef __unix__
+INSTANTIATE_TEST_SUITE_P(
+    MMapTransportTests, BufferTest,
+    ::testing::Values(std::make_tuple("posix", "false", "mmap", "false"),
+                      std::make_tuple("fstream", "true", "mmap", "false"),
+                      std::make_tuple("stdio", "false", "mmap", "false")));
+#endif
+
+#ifdef ADIOS2_HAVE_IOURING
+INSTANTIATE_TEST_SUITE_P(
+    IOUringTransportTests, BufferTest,
+    ::testing::Values(std::make_tuple("iouring", "false", "iouring", "false"),
+                      std::make_tuple("iouring", "false", "posix", "false"),
+                      std::make_tuple("posix", "false", "iouring", "false"),
+                      std::make_tuple("fstream", "true", "iouring", "false")));
+#endif
+
 int main(int argc, char **argv)
 {
     int result;